@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_MODULE_LOADER_H
+#define OHOS_ABILITY_MODULE_LOADER_H
+
+#include <functional>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+/*
+ * Loads the lib<module>.so of a native app when one of its classes is first asked for. PerformAppInit records the
+ * modules, AbilityLoader calls LoadModuleOf when a class is not registered yet. The manifest
+ * <srcPath>/module_classes.list maps class names to modules, one "<class> <module>" pair per line, so only the
+ * owning module is opened. Classes it does not list are looked for in the remaining modules in the order of
+ * AppInfo::moduleNames. An app without a manifest has all its modules loaded by PerformAppInit with LoadAll. A module
+ * that fails to open, for example because it needs a sibling not loaded yet, is opened again on the next search.
+ */
+class AbilityModuleLoader final : public NoCopyable {
+public:
+    static AbilityModuleLoader &GetInstance();
+
+    ~AbilityModuleLoader() override;
+
+    void SetModules(const std::string &srcPath, const std::list<std::string> &moduleNames);
+
+    bool HasManifest() const;
+
+    // loads every module not loaded yet, returns false if a module that exists still can not be opened
+    bool LoadAll();
+
+    // returns true once isRegistered reports the class after its module was loaded
+    bool LoadModuleOf(const std::string &className, const std::function<bool()> &isRegistered);
+
+    void UnloadAll();
+
+    bool IsLoaded(const std::string &moduleName) const;
+
+private:
+    struct Module {
+        std::string name;
+        std::string path;
+        void *handle;
+        bool missing;
+    };
+
+    AbilityModuleLoader() = default;
+
+    void ReadManifest(const std::string &srcPath);
+    bool Load(Module &module);
+    bool LoadPending(const std::function<bool()> &isRegistered);
+
+    std::list<Module> modules_ {};
+    std::unordered_map<std::string, std::string> manifest_ {};
+    bool hasManifest_ { false };
+};
+} // namespace OHOS
+#endif // OHOS_ABILITY_MODULE_LOADER_H
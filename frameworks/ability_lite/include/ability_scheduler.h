@@ -51,12 +51,14 @@ public:
     static int32_t AmsCallback(uint32_t code, IpcIo *data, IpcIo *reply, MessageOption option);
 
 private:
+    void PostTask(AbilityEventTask &&task, AbilityEventHandler::TaskPriority priority);
     void PerformAppInit(const AppInfo& appInfo);
-    void PerformTransactAbilityState(const Want &want, int state, uint64_t token, int abilityType);
-    void PerformConnectAbility(const Want &want, uint64_t token);
-    void PerformDisconnectAbility(const Want &want, uint64_t token);
+    /* the methods taking a Want take over its content and leave it empty */
+    void PerformTransactAbilityState(Want &want, int state, uint64_t token, int abilityType);
+    void PerformConnectAbility(Want &want, uint64_t token);
+    void PerformDisconnectAbility(Want &want, uint64_t token);
     void PerformAppExit();
-    void PerformDumpAbility(const Want &want, uint64_t token);
+    void PerformDumpAbility(Want &want, uint64_t token);
 
     AbilityEventHandler &eventHandler_;
     Scheduler &scheduler_;
@@ -34,6 +34,7 @@ public:
     void OnAbilityStop();
 
     void Present(const AbilitySlice &caller, AbilitySlice &target, const Want &want);
+    void Present(const AbilitySlice &caller, const std::string &sliceName, const Want &want);
     void Terminate(AbilitySlice &slice);
 
     void SetMainRoute(const std::string &entry);
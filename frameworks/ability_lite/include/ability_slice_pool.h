@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_SLICE_POOL_H
+#define OHOS_ABILITY_SLICE_POOL_H
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+class AbilitySlice;
+
+/*
+ * Process wide cache of stopped slices that called SetReusable(true). Only slices created by name are pooled, the
+ * name is the key a later Acquire matches. The name and the reusable flag of a slice are kept here by its address,
+ * so AbilitySlice does not carry them. A pooled slice is reset to STATE_UNINITIALIZED but keeps its members and
+ * its root view, so starting it again does not have to rebuild its UI tree. At most ABILITY_SLICE_POOL_CAPACITY slices
+ * are kept, the one recycled longest ago is destroyed first.
+ */
+class AbilitySlicePool final : public NoCopyable {
+public:
+    static AbilitySlicePool &GetInstance();
+
+    ~AbilitySlicePool() override;
+
+    // returns a pooled slice named sliceName, or a new one from AbilityLoader
+    AbilitySlice *Acquire(const std::string &sliceName);
+
+    void SetReusable(const AbilitySlice *slice, bool reusable);
+
+    // whether the slice was created by Acquire, those belong to the framework and are destroyed by the pool
+    bool IsNamed(const AbilitySlice *slice) const;
+
+    // drops what the pool knows about a slice being destroyed
+    void Forget(const AbilitySlice *slice);
+
+    // takes the slice if it can be pooled, the caller keeps it otherwise
+    bool Keep(AbilitySlice *slice);
+
+    // pools the slice if it can be pooled, destroys it otherwise
+    void Recycle(AbilitySlice *slice);
+
+    // destroys the pooled slices, must run before the modules they come from are unloaded
+    void Clear();
+
+    uint32_t GetCapacity() const;
+
+    std::string GetInfo() const;
+
+private:
+    struct SliceTag {
+        std::string name {};
+        bool reusable { false };
+    };
+
+    AbilitySlicePool() = default;
+
+    void Destroy(AbilitySlice *slice);
+
+    // most recently recycled first
+    std::list<AbilitySlice *> slices_ {};
+    // slices created by Acquire or that called SetReusable, removed once they are destroyed
+    std::unordered_map<const AbilitySlice *, SliceTag> tags_ {};
+    uint32_t created_ { 0 };
+    uint32_t reused_ { 0 };
+    uint32_t destroyed_ { 0 };
+};
+} // namespace OHOS
+#endif // OHOS_ABILITY_SLICE_POOL_H
@@ -16,6 +16,8 @@
 #ifndef OHOS_ABILITY_SLICE_SCHEDULER_H
 #define OHOS_ABILITY_SLICE_SCHEDULER_H
 
+#include <chrono>
+#include <vector>
 #include <want.h>
 
 #include "ability_slice_manager.h"
@@ -35,6 +37,7 @@ public:
     void HandleStopAbilitySlice();
 
     void AddAbilitySlice(const AbilitySlice &caller, AbilitySlice &target, const Want &want);
+    void AddAbilitySlice(const AbilitySlice &caller, const std::string &sliceName, const Want &want);
     void RemoveAbilitySlice(AbilitySlice &slice);
 
     void SetMainRoute(const std::string &entry);
@@ -43,13 +46,24 @@ public:
     const std::string GetSliceStackInfo() const;
 private:
     AbilitySlice *GetTargetAbilitySlice() const;
+    bool PushAbilitySlice(const AbilitySlice &caller, AbilitySlice &target, const Want &want,
+        std::chrono::steady_clock::time_point begin);
     bool CheckLegalForAdd(const AbilitySlice &caller, AbilitySlice &target, const Want &want);
     bool CheckLegalForRemove(const AbilitySlice &slice);
+    void DestroyLater(AbilitySlice &slice);
+    void DestroyStopped();
+    void RecordNavigation(std::chrono::steady_clock::time_point begin);
 
     AbilitySliceRoute *abilitySliceRoute_ { nullptr };
     AbilitySliceStack *abilitySliceStack_ { nullptr };
     AbilitySlice *topAbilitySlice_ { nullptr };
     AbilitySliceManager &abilitySliceManager_;
+    // stopped slices DestroyLater could not post, destroyed on the next lifecycle transition of the ability
+    std::vector<AbilitySlice *> stoppedSlices_ {};
+    uint32_t navigations_ { 0 };
+    uint64_t lastNavigationUs_ { 0 };
+    uint64_t maxNavigationUs_ { 0 };
+    uint64_t totalNavigationUs_ { 0 };
 };
 } // namespace OHOS
 
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_TASK_QUEUE_H
+#define OHOS_ABILITY_TASK_QUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "ability_event_task.h"
+#include "nocopyable.h"
+
+namespace OHOS {
+/**
+ * Bounded lock-free queue with many producers and a single consumer. Every slot carries a sequence number, a producer
+ * claims a slot by advancing the enqueue position and publishes it by bumping the slot sequence, so producers never
+ * block each other and the consumer never takes a lock.
+ */
+class AbilityTaskQueue : public NoCopyable {
+public:
+    explicit AbilityTaskQueue(uint32_t capacity);
+
+    ~AbilityTaskQueue() override;
+
+    /* may be called from any thread, returns false and leaves the task untouched when the queue is full */
+    bool Push(AbilityEventTask &&task);
+
+    /* must only be called from the consumer thread */
+    bool Pop(AbilityEventTask &task);
+
+    /* must only be called from the consumer thread */
+    bool IsEmpty() const;
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> sequence { 0 };
+        AbilityEventTask task;
+    };
+
+    static constexpr uint32_t CACHE_LINE_SIZE = 64;
+
+    Slot *slots_ { nullptr };
+    uint32_t mask_ { 0 };
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> enqueuePos_ { 0 };
+    alignas(CACHE_LINE_SIZE) uint32_t dequeuePos_ { 0 };
+};
+
+/**
+ * Min-heap of delayed and periodic tasks ordered by deadline, tasks with the same deadline keep their posting order.
+ * Tasks are move-only, so a due periodic task leaves the heap while it runs and is put back by Rearm. Not thread
+ * safe, the owner serializes access.
+ */
+class AbilityTimerHeap : public NoCopyable {
+public:
+    struct Timer {
+        uint64_t deadline;
+        uint64_t sequence;
+        uint32_t id;
+        uint32_t intervalMs;
+        AbilityEventTask task;
+    };
+
+    AbilityTimerHeap() = default;
+
+    ~AbilityTimerHeap() override = default;
+
+    /* returns the id of the new timer, intervalMs of zero means one-shot */
+    uint32_t Add(AbilityEventTask &&task, uint64_t deadline, uint32_t intervalMs);
+
+    /* a periodic timer that is running right now is not put back by Rearm once removed */
+    bool Remove(uint32_t timerId);
+
+    /* hands out the earliest timer due at now, a periodic timer must be passed back to Rearm after it ran */
+    bool PopExpired(uint64_t now, Timer &timer);
+
+    void Rearm(Timer &&timer, uint64_t now);
+
+    /* returns UINT64_MAX when the heap is empty */
+    uint64_t GetNextDeadline() const;
+
+private:
+    static bool Later(const Timer &left, const Timer &right);
+
+    std::vector<Timer> timers_;
+    uint64_t nextSequence_ { 0 };
+    uint32_t nextId_ { 0 };
+    uint32_t runningId_ { 0 };
+};
+} // namespace OHOS
+#endif // OHOS_ABILITY_TASK_QUEUE_H
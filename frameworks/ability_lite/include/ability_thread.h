@@ -41,10 +41,12 @@ private:
     void PerformDumpAbility(const Want &want, uint64_t token) override;
 
 #ifdef ABILITY_WINDOW_SUPPORT
-    static void *UITaskPost(void *arg);
     void InitUITaskEnv();
+    /* arms the UI task timer while a page ability is in the foreground and removes it otherwise */
+    void UpdateUITaskTimer();
 #endif
     void StartAbilityCallback(const Want &want);
+    void ReportLifecycleDone(uint64_t token, int state);
     static void HandleLifecycleTransaction(Ability &ability, const Want &want, int state);
     void AttachBundle(uint64_t token);
     void Run();
@@ -53,9 +55,10 @@ private:
     AbilityScheduler *abilityScheduler_ { nullptr };
     std::map<uint64_t, Ability *> abilities_ {};
     SvcIdentity *identity_ { nullptr };
-    std::list<void *> handle_ {};
+#ifdef ABILITY_WINDOW_SUPPORT
+    uint32_t uiTimerId_ { 0 };
+#endif
     static bool isNativeApp_;
-    static bool isAppRunning_;
     static bool isDisplayInited_;
     IpcObjectStub objectStub_;
 };
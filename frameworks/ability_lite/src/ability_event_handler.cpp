@@ -15,65 +15,368 @@
 
 #include "ability_event_handler.h"
 
+#include <atomic>
+#include <ctime>
+#include <deque>
+#include <new>
+
+#include "ability_task_queue.h"
+#include "log.h"
+
 namespace OHOS {
 namespace {
     thread_local AbilityEventHandler* g_currentHandler;
-    constexpr static uint16_t TASK_QUEUE_CAPACITY = 10240;
+    constexpr static uint8_t TASK_PRIORITY_NUM = 3;
+    constexpr static uint32_t TASK_QUEUE_CAPACITY[] = { 64, 512, 64 };
+    // tasks beyond the lock-free lanes wait in the overflow lists, all together no more than the old single queue
+    constexpr static uint32_t MAX_PENDING_TASKS = 10240;
+    constexpr static uint32_t TASK_OVERFLOW_CAPACITY =
+        MAX_PENDING_TASKS - TASK_QUEUE_CAPACITY[0] - TASK_QUEUE_CAPACITY[1] - TASK_QUEUE_CAPACITY[2];
+    constexpr static uint32_t TASK_BATCH_SIZE = 32;
+    constexpr static uint64_t MS_PER_SECOND = 1000;
+    constexpr static uint64_t NS_PER_MS = 1000000;
+
+    uint64_t GetMonotonicTimeMs()
+    {
+        struct timespec now = { 0, 0 };
+        (void) clock_gettime(CLOCK_MONOTONIC, &now);
+        return static_cast<uint64_t>(now.tv_sec) * MS_PER_SECOND + static_cast<uint64_t>(now.tv_nsec) / NS_PER_MS;
+    }
 }
 
-AbilityEventHandler::AbilityEventHandler()
+struct AbilityEventHandler::Impl {
+    Impl();
+    ~Impl();
+
+    bool IsValid() const;
+    bool Push(AbilityEventTask &&task, uint8_t lane);
+    bool Pop(AbilityEventTask &task);
+    uint32_t AddTimerTask(AbilityEventTask &&task, uint32_t delayMs, uint32_t intervalMs);
+    uint32_t RunExpiredTimers();
+    uint32_t RunQueuedTasks();
+    bool IsQueueEmpty() const;
+    void WaitForTask();
+    void Quit();
+
+    AbilityTaskQueue *taskQueues_[TASK_PRIORITY_NUM] { nullptr };
+    // a lane takes the slow path while its overflow list is not empty, so tasks of one poster keep their order
+    std::deque<AbilityEventTask> overflows_[TASK_PRIORITY_NUM];
+    std::atomic<uint32_t> overflowSizes_[TASK_PRIORITY_NUM] {};
+    uint32_t overflowTotal_ { 0 };
+    AbilityTimerHeap timerHeap_;
+
+    pthread_cond_t pthreadCond_ = PTHREAD_COND_INITIALIZER;
+    pthread_mutex_t queueMutex_ = PTHREAD_MUTEX_INITIALIZER;
+
+    std::atomic<bool> quit_ { false };
+    std::atomic<bool> waiting_ { false };
+    std::atomic<uint64_t> nextDeadline_ { UINT64_MAX };
+    std::atomic<uint64_t> postedTasks_ { 0 };
+    std::atomic<uint64_t> executedTasks_ { 0 };
+};
+
+AbilityEventHandler::Impl::Impl()
 {
-    g_currentHandler = this;
     (void) pthread_mutex_init(&queueMutex_, nullptr);
-    (void) pthread_cond_init(&pthreadCond_, nullptr);
+    // timed waits follow the monotonic clock so that wall clock changes do not shift timer tasks
+    pthread_condattr_t condAttr;
+    (void) pthread_condattr_init(&condAttr);
+    (void) pthread_condattr_setclock(&condAttr, CLOCK_MONOTONIC);
+    (void) pthread_cond_init(&pthreadCond_, &condAttr);
+    (void) pthread_condattr_destroy(&condAttr);
+    for (uint8_t i = 0; i < TASK_PRIORITY_NUM; i++) {
+        overflowSizes_[i].store(0, std::memory_order_relaxed);
+        taskQueues_[i] = new (std::nothrow) AbilityTaskQueue(TASK_QUEUE_CAPACITY[i]);
+        if (taskQueues_[i] == nullptr) {
+            HILOG_ERROR(HILOG_MODULE_APP, "AbilityEventHandler fail to create task queue %{public}u", i);
+        }
+    }
 }
 
-AbilityEventHandler::~AbilityEventHandler()
+AbilityEventHandler::Impl::~Impl()
 {
+    for (uint8_t i = 0; i < TASK_PRIORITY_NUM; i++) {
+        delete taskQueues_[i];
+        taskQueues_[i] = nullptr;
+    }
     (void) pthread_mutex_destroy(&queueMutex_);
     (void) pthread_cond_destroy(&pthreadCond_);
+}
 
-    g_currentHandler = nullptr;
+bool AbilityEventHandler::Impl::IsValid() const
+{
+    for (uint8_t i = 0; i < TASK_PRIORITY_NUM; i++) {
+        if (taskQueues_[i] == nullptr) {
+            return false;
+        }
+    }
+    return true;
 }
 
-void AbilityEventHandler::Run()
+bool AbilityEventHandler::Impl::Push(AbilityEventTask &&task, uint8_t lane)
 {
-    (void) pthread_mutex_lock(&queueMutex_);
-    while (!quit_) {
-        if (taskQueue_.empty()) {
-            (void) pthread_cond_wait(&pthreadCond_, &queueMutex_);
+    if (overflowSizes_[lane].load(std::memory_order_acquire) == 0 && taskQueues_[lane]->Push(std::move(task))) {
+        postedTasks_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting_.load(std::memory_order_relaxed)) {
+            (void) pthread_mutex_lock(&queueMutex_);
+            (void) pthread_cond_signal(&pthreadCond_);
+            (void) pthread_mutex_unlock(&queueMutex_);
         }
-        Task task = std::move(taskQueue_.front());
-        taskQueue_.pop();
+        return true;
+    }
+
+    // the event loop checks the overflow lists under the mutex before it sleeps, so the signal cannot be lost
+    (void) pthread_mutex_lock(&queueMutex_);
+    if (overflowTotal_ >= TASK_OVERFLOW_CAPACITY) {
         (void) pthread_mutex_unlock(&queueMutex_);
-        task();
+        HILOG_ERROR(HILOG_MODULE_APP, "AbilityEventHandler has too many pending tasks, drop task of lane %{public}u",
+            lane);
+        return false;
+    }
+    overflows_[lane].push_back(std::move(task));
+    overflowSizes_[lane].fetch_add(1, std::memory_order_release);
+    overflowTotal_++;
+    postedTasks_.fetch_add(1, std::memory_order_relaxed);
+    if (waiting_.load(std::memory_order_relaxed)) {
+        (void) pthread_cond_signal(&pthreadCond_);
+    }
+    (void) pthread_mutex_unlock(&queueMutex_);
+    return true;
+}
+
+bool AbilityEventHandler::Impl::Pop(AbilityEventTask &task)
+{
+    for (uint8_t i = 0; i < TASK_PRIORITY_NUM; i++) {
+        if (taskQueues_[i]->Pop(task)) {
+            return true;
+        }
+        // the lane only spills over once it is full, so its ring is drained before the overflow list
+        if (overflowSizes_[i].load(std::memory_order_acquire) == 0) {
+            continue;
+        }
         (void) pthread_mutex_lock(&queueMutex_);
+        task = std::move(overflows_[i].front());
+        overflows_[i].pop_front();
+        overflowSizes_[i].fetch_sub(1, std::memory_order_release);
+        overflowTotal_--;
+        (void) pthread_mutex_unlock(&queueMutex_);
+        return true;
+    }
+    return false;
+}
+
+uint32_t AbilityEventHandler::Impl::AddTimerTask(AbilityEventTask &&task, uint32_t delayMs, uint32_t intervalMs)
+{
+    (void) pthread_mutex_lock(&queueMutex_);
+    uint32_t timerId = timerHeap_.Add(std::move(task), GetMonotonicTimeMs() + delayMs, intervalMs);
+    nextDeadline_.store(timerHeap_.GetNextDeadline(), std::memory_order_release);
+    // the event loop checks the timer heap under the mutex before it sleeps, so the signal cannot be lost
+    if (waiting_.load(std::memory_order_relaxed)) {
+        (void) pthread_cond_signal(&pthreadCond_);
     }
     (void) pthread_mutex_unlock(&queueMutex_);
+    return timerId;
 }
 
-void AbilityEventHandler::PostTask(const Task& task)
+uint32_t AbilityEventHandler::Impl::RunExpiredTimers()
 {
-    if (taskQueue_.size() >= TASK_QUEUE_CAPACITY) {
-        return;
+    // the deadline is cached so that the common case of no due timer does not take the mutex
+    if (nextDeadline_.load(std::memory_order_acquire) > GetMonotonicTimeMs()) {
+        return 0;
     }
+    uint32_t executed = 0;
+    AbilityTimerHeap::Timer timer = {};
+    while (executed < TASK_BATCH_SIZE && !quit_) {
+        (void) pthread_mutex_lock(&queueMutex_);
+        bool expired = timerHeap_.PopExpired(GetMonotonicTimeMs(), timer);
+        nextDeadline_.store(timerHeap_.GetNextDeadline(), std::memory_order_release);
+        (void) pthread_mutex_unlock(&queueMutex_);
+        if (!expired) {
+            break;
+        }
+        timer.task();
+        executed++;
+        if (timer.intervalMs == 0) {
+            timer.task = nullptr;
+            continue;
+        }
+        (void) pthread_mutex_lock(&queueMutex_);
+        timerHeap_.Rearm(std::move(timer), GetMonotonicTimeMs());
+        nextDeadline_.store(timerHeap_.GetNextDeadline(), std::memory_order_release);
+        (void) pthread_mutex_unlock(&queueMutex_);
+    }
+    return executed;
+}
+
+uint32_t AbilityEventHandler::Impl::RunQueuedTasks()
+{
+    uint32_t executed = 0;
+    AbilityEventTask task;
+    // look at the lanes again after every task, so a high priority task never waits for a whole batch
+    while (executed < TASK_BATCH_SIZE && !quit_ && Pop(task)) {
+        task();
+        task = nullptr;
+        executed++;
+    }
+    if (executed > 0) {
+        executedTasks_.fetch_add(executed, std::memory_order_relaxed);
+    }
+    return executed;
+}
+
+bool AbilityEventHandler::Impl::IsQueueEmpty() const
+{
+    for (uint8_t i = 0; i < TASK_PRIORITY_NUM; i++) {
+        if (!taskQueues_[i]->IsEmpty() || overflowSizes_[i].load(std::memory_order_relaxed) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void AbilityEventHandler::Impl::WaitForTask()
+{
     (void) pthread_mutex_lock(&queueMutex_);
-    taskQueue_.push(task);
+    waiting_.store(true, std::memory_order_relaxed);
+    // pairs with the fence in Push, either the poster sees waiting_ or this check sees the posted task
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!quit_ && IsQueueEmpty()) {
+        uint64_t deadline = timerHeap_.GetNextDeadline();
+        if (deadline == UINT64_MAX) {
+            (void) pthread_cond_wait(&pthreadCond_, &queueMutex_);
+        } else if (deadline > GetMonotonicTimeMs()) {
+            struct timespec abstime = {
+                static_cast<time_t>(deadline / MS_PER_SECOND),
+                static_cast<long>((deadline % MS_PER_SECOND) * NS_PER_MS)
+            };
+            (void) pthread_cond_timedwait(&pthreadCond_, &queueMutex_, &abstime);
+        }
+    }
+    waiting_.store(false, std::memory_order_relaxed);
+    (void) pthread_mutex_unlock(&queueMutex_);
+}
 
+void AbilityEventHandler::Impl::Quit()
+{
+    (void) pthread_mutex_lock(&queueMutex_);
+    quit_ = true;
     (void) pthread_cond_signal(&pthreadCond_);
     (void) pthread_mutex_unlock(&queueMutex_);
 }
 
+AbilityEventHandler::AbilityEventHandler()
+{
+    g_currentHandler = this;
+    impl_ = new (std::nothrow) Impl();
+    if (impl_ == nullptr) {
+        HILOG_ERROR(HILOG_MODULE_APP, "AbilityEventHandler fail to create task queues");
+    }
+}
+
+AbilityEventHandler::~AbilityEventHandler()
+{
+    delete impl_;
+    impl_ = nullptr;
+
+    g_currentHandler = nullptr;
+}
+
+void AbilityEventHandler::Run()
+{
+    if (impl_ == nullptr || !impl_->IsValid()) {
+        HILOG_ERROR(HILOG_MODULE_APP, "AbilityEventHandler task queue is nullptr, fail to run");
+        return;
+    }
+    while (!impl_->quit_) {
+        uint32_t executed = impl_->RunExpiredTimers();
+        executed += impl_->RunQueuedTasks();
+        if (executed == 0) {
+            impl_->WaitForTask();
+        }
+    }
+}
+
+bool AbilityEventHandler::PostTask(const Task& task)
+{
+    return PostTask(task, TaskPriority::DEFAULT);
+}
+
+bool AbilityEventHandler::PostTask(const Task& task, TaskPriority priority)
+{
+    if (!task) {
+        return false;
+    }
+    return PostTask(AbilityEventTask(task), priority);
+}
+
+bool AbilityEventHandler::PostTask(AbilityEventTask &&task, TaskPriority priority)
+{
+    auto lane = static_cast<uint8_t>(priority);
+    if (!task || lane >= TASK_PRIORITY_NUM || impl_ == nullptr || !impl_->IsValid()) {
+        return false;
+    }
+    return impl_->Push(std::move(task), lane);
+}
+
+uint32_t AbilityEventHandler::PostDelayedTask(const Task &task, uint32_t delayMs)
+{
+    if (!task || impl_ == nullptr) {
+        return 0;
+    }
+    return impl_->AddTimerTask(AbilityEventTask(task), delayMs, 0);
+}
+
+uint32_t AbilityEventHandler::PostTimerTask(const Task &task, uint32_t delayMs, uint32_t intervalMs)
+{
+    if (!task || impl_ == nullptr) {
+        return 0;
+    }
+    if (intervalMs == 0) {
+        HILOG_ERROR(HILOG_MODULE_APP, "AbilityEventHandler timer task interval is invalid");
+        return 0;
+    }
+    return impl_->AddTimerTask(AbilityEventTask(task), delayMs, intervalMs);
+}
+
+void AbilityEventHandler::RemoveTimerTask(uint32_t timerId)
+{
+    if (impl_ == nullptr) {
+        return;
+    }
+    (void) pthread_mutex_lock(&impl_->queueMutex_);
+    if (impl_->timerHeap_.Remove(timerId)) {
+        impl_->nextDeadline_.store(impl_->timerHeap_.GetNextDeadline(), std::memory_order_release);
+    }
+    (void) pthread_mutex_unlock(&impl_->queueMutex_);
+}
+
 void AbilityEventHandler::PostQuit()
 {
-    Task task = [this]() {
-        quit_ = true;
-    };
-    PostTask(task);
+    if (impl_ == nullptr) {
+        return;
+    }
+    Impl *impl = impl_;
+    if (!PostTask(AbilityEventTask([impl]() {
+        impl->quit_ = true;
+    }), TaskPriority::DEFAULT)) {
+        // the loop must still end when the queues are full, it does so right after the running task
+        impl_->Quit();
+    }
 }
 
 AbilityEventHandler* AbilityEventHandler::GetCurrentHandler()
 {
     return g_currentHandler;
 }
-}  // namespace OHOS
\ No newline at end of file
+
+uint64_t AbilityEventHandler::GetPostedTaskCount() const
+{
+    return (impl_ == nullptr) ? 0 : impl_->postedTasks_.load(std::memory_order_relaxed);
+}
+
+uint64_t AbilityEventHandler::GetExecutedTaskCount() const
+{
+    return (impl_ == nullptr) ? 0 : impl_->executedTasks_.load(std::memory_order_relaxed);
+}
+}  // namespace OHOS
@@ -14,9 +14,173 @@
 */
 
 #include "ability_loader.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "ability_module_loader.h"
 #include "log.h"
 
 namespace OHOS {
+namespace {
+constexpr uint32_t FNV_OFFSET_BASIS = 2166136261;
+constexpr uint32_t FNV_PRIME = 16777619;
+constexpr uint32_t HASH_FOLD_SHIFT = 16;
+constexpr int32_t MAX_BUCKET_SEED = 4096;
+constexpr size_t SLOT_GROWTH_DIVISOR = 4;
+
+uint32_t HashName(const char *name, uint32_t seed)
+{
+    uint32_t hash = FNV_OFFSET_BASIS ^ (seed * FNV_PRIME);
+    for (; *name != '\0'; name++) {
+        hash ^= static_cast<uint8_t>(*name);
+        hash *= FNV_PRIME;
+    }
+    // fold the high bits in, the indexes are small
+    return hash ^ (hash >> HASH_FOLD_SHIFT);
+}
+}
+
+template<typename T>
+void LoaderEntryTable<T>::AddSection(LoaderSection<T> &section)
+{
+    if (section.begin == section.end) {
+        return;
+    }
+    // every class registered by a library brings a node for the same section, link only the first one
+    LoaderSection<T> **link = &sections_;
+    for (; *link != nullptr; link = &(*link)->next) {
+        if ((*link == &section) || ((*link)->begin == section.begin)) {
+            return;
+        }
+    }
+    section.next = nullptr;
+    *link = &section;
+    dirty_ = true;
+}
+
+template<typename T>
+void LoaderEntryTable<T>::RemoveSection(LoaderSection<T> &section)
+{
+    // only the list is touched, this may run from library destructors after the loader itself was destroyed
+    for (LoaderSection<T> **link = &sections_; *link != nullptr; link = &(*link)->next) {
+        if (*link == &section) {
+            *link = section.next;
+            dirty_ = true;
+            return;
+        }
+    }
+}
+
+template<typename T>
+bool LoaderEntryTable<T>::Place(const std::vector<const LoaderEntry<T> *> &entries, size_t slotCount)
+{
+    size_t bucketCount = entries.size();
+    std::vector<std::vector<const LoaderEntry<T> *>> buckets(bucketCount);
+    for (const auto entry : entries) {
+        buckets[HashName(entry->name, 0) % bucketCount].push_back(entry);
+    }
+    // the largest buckets are the hardest to place, so they pick their seeds while most slots are free
+    std::vector<size_t> order(bucketCount);
+    for (size_t bucket = 0; bucket < bucketCount; bucket++) {
+        order[bucket] = bucket;
+    }
+    std::stable_sort(order.begin(), order.end(), [&buckets](size_t left, size_t right) {
+        return buckets[left].size() > buckets[right].size();
+    });
+
+    slots_.assign(slotCount, nullptr);
+    seeds_.assign(bucketCount, 0);
+    std::vector<size_t> targets;
+    size_t freeSlot = 0;
+    for (const auto bucket : order) {
+        const auto &names = buckets[bucket];
+        if (names.size() == 1) {
+            // a single name takes any free slot, the negative seed records which one
+            while (slots_[freeSlot] != nullptr) {
+                freeSlot++;
+            }
+            slots_[freeSlot] = names[0];
+            seeds_[bucket] = -static_cast<int32_t>(freeSlot) - 1;
+            continue;
+        }
+        if (names.empty()) {
+            break;
+        }
+        int32_t seed = 1;
+        for (; seed <= MAX_BUCKET_SEED; seed++) {
+            targets.clear();
+            for (const auto entry : names) {
+                size_t slot = HashName(entry->name, static_cast<uint32_t>(seed)) % slotCount;
+                if ((slots_[slot] != nullptr) || (std::find(targets.begin(), targets.end(), slot) != targets.end())) {
+                    break;
+                }
+                targets.push_back(slot);
+            }
+            if (targets.size() == names.size()) {
+                break;
+            }
+        }
+        if (seed > MAX_BUCKET_SEED) {
+            return false;
+        }
+        for (size_t i = 0; i < names.size(); i++) {
+            slots_[targets[i]] = names[i];
+        }
+        seeds_[bucket] = seed;
+    }
+    return true;
+}
+
+template<typename T>
+void LoaderEntryTable<T>::Build()
+{
+    std::vector<const LoaderEntry<T> *> entries;
+    for (const LoaderSection<T> *section = sections_; section != nullptr; section = section->next) {
+        for (const LoaderEntry<T> *entry = section->begin; entry < section->end; entry++) {
+            if (entry->name != nullptr) {
+                entries.push_back(entry);
+            }
+        }
+    }
+    // the first registration of a name wins, as it did with the map
+    std::stable_sort(entries.begin(), entries.end(), [](const LoaderEntry<T> *left, const LoaderEntry<T> *right) {
+        return strcmp(left->name, right->name) < 0;
+    });
+    entries.erase(std::unique(entries.begin(), entries.end(), [](const LoaderEntry<T> *left,
+        const LoaderEntry<T> *right) {
+        return strcmp(left->name, right->name) == 0;
+    }), entries.end());
+    dirty_ = false;
+    if (entries.empty()) {
+        slots_.clear();
+        seeds_.clear();
+        return;
+    }
+    size_t slotCount = entries.size();
+    while (!Place(entries, slotCount)) {
+        slotCount += slotCount / SLOT_GROWTH_DIVISOR + 1;
+    }
+    HILOG_INFO(HILOG_MODULE_APP, "%{public}u classes hashed into %{public}u slots",
+        static_cast<uint32_t>(entries.size()), static_cast<uint32_t>(slotCount));
+}
+
+template<typename T>
+const LoaderEntry<T> *LoaderEntryTable<T>::Find(const char *name)
+{
+    if (dirty_) {
+        Build();
+    }
+    if (slots_.empty()) {
+        return nullptr;
+    }
+    int32_t seed = seeds_[HashName(name, 0) % seeds_.size()];
+    size_t slot = (seed < 0) ? static_cast<size_t>(-(seed + 1)) :
+        (HashName(name, static_cast<uint32_t>(seed)) % slots_.size());
+    const LoaderEntry<T> *entry = slots_[slot];
+    return ((entry != nullptr) && (strcmp(entry->name, name) == 0)) ? entry : nullptr;
+}
+
 AbilityLoader &AbilityLoader::GetInstance()
 {
     static AbilityLoader abilityLoader;
@@ -29,15 +193,50 @@ void AbilityLoader::RegisterAbility(const std::string &abilityName, const Create
     HILOG_INFO(HILOG_MODULE_APP, "RegisterAbility %s", abilityName.c_str());
 }
 
-Ability *AbilityLoader::GetAbilityByName(const std::string &abilityName)
+void AbilityLoader::AddAbilitySection(AbilitySection &section)
 {
+    abilityTable_.AddSection(section);
+}
+
+void AbilityLoader::RemoveAbilitySection(AbilitySection &section)
+{
+    abilityTable_.RemoveSection(section);
+}
+
+Ability *AbilityLoader::NewAbility(const char *abilityName)
+{
+    const AbilityEntry *entry = abilityTable_.Find(abilityName);
+    if (entry != nullptr) {
+        return entry->create();
+    }
+    if (abilities_.empty()) {
+        return nullptr;
+    }
     auto it = abilities_.find(abilityName);
-    if (it == abilities_.end()) {
-        HILOG_ERROR(HILOG_MODULE_APP, "GetAbilityByName failed: %s", abilityName.c_str());
+    return (it == abilities_.end()) ? nullptr : it->second();
+}
+
+Ability *AbilityLoader::GetAbilityByName(const std::string &abilityName)
+{
+    return GetAbilityByName(abilityName.c_str());
+}
+
+Ability *AbilityLoader::GetAbilityByName(const char *abilityName)
+{
+    if (abilityName == nullptr) {
         return nullptr;
-    } else {
-        return it->second();
     }
+    Ability *ability = NewAbility(abilityName);
+    if ((ability == nullptr) && AbilityModuleLoader::GetInstance().LoadModuleOf(abilityName, [&]() {
+        ability = NewAbility(abilityName);
+        return ability != nullptr;
+    })) {
+        HILOG_INFO(HILOG_MODULE_APP, "%s registered by its module on first use", abilityName);
+    }
+    if (ability == nullptr) {
+        HILOG_ERROR(HILOG_MODULE_APP, "GetAbilityByName failed: %s", abilityName);
+    }
+    return ability;
 }
 
 #ifdef ABILITY_WINDOW_SUPPORT
@@ -47,15 +246,50 @@ void AbilityLoader::RegisterAbilitySlice(const std::string &sliceName, const Cre
     HILOG_INFO(HILOG_MODULE_APP, "RegisterAbilitySlice %s", sliceName.c_str());
 }
 
-AbilitySlice *AbilityLoader::GetAbilitySliceByName(const std::string &sliceName)
+void AbilityLoader::AddAbilitySliceSection(AbilitySliceSection &section)
 {
+    sliceTable_.AddSection(section);
+}
+
+void AbilityLoader::RemoveAbilitySliceSection(AbilitySliceSection &section)
+{
+    sliceTable_.RemoveSection(section);
+}
+
+AbilitySlice *AbilityLoader::NewAbilitySlice(const char *sliceName)
+{
+    const AbilitySliceEntry *entry = sliceTable_.Find(sliceName);
+    if (entry != nullptr) {
+        return entry->create();
+    }
+    if (slices_.empty()) {
+        return nullptr;
+    }
     auto it = slices_.find(sliceName);
-    if (it == slices_.end()) {
-        HILOG_ERROR(HILOG_MODULE_APP, "GetAbilitySliceByName failed: %s", sliceName.c_str());
+    return (it == slices_.end()) ? nullptr : it->second();
+}
+
+AbilitySlice *AbilityLoader::GetAbilitySliceByName(const std::string &sliceName)
+{
+    return GetAbilitySliceByName(sliceName.c_str());
+}
+
+AbilitySlice *AbilityLoader::GetAbilitySliceByName(const char *sliceName)
+{
+    if (sliceName == nullptr) {
         return nullptr;
-    } else {
-        return it->second();
     }
+    AbilitySlice *slice = NewAbilitySlice(sliceName);
+    if ((slice == nullptr) && AbilityModuleLoader::GetInstance().LoadModuleOf(sliceName, [&]() {
+        slice = NewAbilitySlice(sliceName);
+        return slice != nullptr;
+    })) {
+        HILOG_INFO(HILOG_MODULE_APP, "%s registered by its module on first use", sliceName);
+    }
+    if (slice == nullptr) {
+        HILOG_ERROR(HILOG_MODULE_APP, "GetAbilitySliceByName failed: %s", sliceName);
+    }
+    return slice;
 }
 #endif
 } //  namespace OHOS
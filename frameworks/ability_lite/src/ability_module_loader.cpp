@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_module_loader.h"
+
+#include <climits>
+#include <cstdlib>
+#include <dlfcn.h>
+#include <fstream>
+#include <sstream>
+
+#include "log.h"
+
+namespace OHOS {
+namespace {
+constexpr static char PATH_SEPARATOR[] = "/";
+constexpr static char LIB_PREFIX[] = "/lib";
+constexpr static char LIB_SUFFIX[] = ".so";
+constexpr static char MANIFEST_NAME[] = "module_classes.list";
+}
+
+AbilityModuleLoader &AbilityModuleLoader::GetInstance()
+{
+    static AbilityModuleLoader moduleLoader;
+    return moduleLoader;
+}
+
+AbilityModuleLoader::~AbilityModuleLoader()
+{
+    UnloadAll();
+}
+
+void AbilityModuleLoader::SetModules(const std::string &srcPath, const std::list<std::string> &moduleNames)
+{
+    UnloadAll();
+    modules_.clear();
+    manifest_.clear();
+    hasManifest_ = false;
+    for (const auto &module : moduleNames) {
+        std::string modulePath = srcPath + PATH_SEPARATOR + module + LIB_PREFIX + module + LIB_SUFFIX;
+        if (modulePath.size() > PATH_MAX) {
+            continue;
+        }
+        modules_.push_back({ module, modulePath, nullptr, false });
+    }
+    ReadManifest(srcPath);
+    HILOG_INFO(HILOG_MODULE_APP, "%{public}d modules, %{public}d classes in manifest",
+        static_cast<int>(modules_.size()), static_cast<int>(manifest_.size()));
+}
+
+bool AbilityModuleLoader::HasManifest() const
+{
+    return hasManifest_;
+}
+
+void AbilityModuleLoader::ReadManifest(const std::string &srcPath)
+{
+    std::ifstream manifest(srcPath + PATH_SEPARATOR + MANIFEST_NAME);
+    if (!manifest.is_open()) {
+        return;
+    }
+    hasManifest_ = true;
+    std::string line;
+    while (std::getline(manifest, line)) {
+        std::istringstream fields(line);
+        std::string className;
+        std::string moduleName;
+        if ((fields >> className >> moduleName) && (className[0] != '#')) {
+            manifest_[className] = moduleName;
+        }
+    }
+}
+
+bool AbilityModuleLoader::Load(Module &module)
+{
+    char realPath[PATH_MAX + 1] = { 0 };
+    if (realpath(module.path.c_str(), realPath) == nullptr) {
+        HILOG_ERROR(HILOG_MODULE_APP, "Fail to get realpath of %{public}s", module.path.c_str());
+        // a module without a library is not looked at again
+        module.missing = true;
+        return false;
+    }
+    module.handle = dlopen(static_cast<char *>(realPath), RTLD_NOW | RTLD_GLOBAL);
+    if (module.handle == nullptr) {
+        HILOG_ERROR(HILOG_MODULE_APP, "Fail to dlopen %{public}s, [%{public}s]", module.path.c_str(), dlerror());
+        return false;
+    }
+    HILOG_INFO(HILOG_MODULE_APP, "module %{public}s loaded", module.name.c_str());
+    return true;
+}
+
+bool AbilityModuleLoader::LoadModuleOf(const std::string &className, const std::function<bool()> &isRegistered)
+{
+    auto entry = manifest_.find(className);
+    if (entry != manifest_.end()) {
+        for (auto &module : modules_) {
+            if (module.name == entry->second) {
+                if (module.handle == nullptr && !module.missing && Load(module) && isRegistered()) {
+                    return true;
+                }
+                break;
+            }
+        }
+    }
+    // not listed, or the listed module does not register it: try the modules still unloaded
+    return LoadPending(isRegistered);
+}
+
+bool AbilityModuleLoader::LoadPending(const std::function<bool()> &isRegistered)
+{
+    // a module may need a sibling that comes after it, so the modules are walked again while one more opens
+    bool opened = true;
+    while (opened) {
+        opened = false;
+        for (auto &module : modules_) {
+            if (module.handle != nullptr || module.missing || !Load(module)) {
+                continue;
+            }
+            opened = true;
+            if (isRegistered()) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool AbilityModuleLoader::LoadAll()
+{
+    (void) LoadPending([]() { return false; });
+    for (const auto &module : modules_) {
+        // a module without a library is skipped, one that can not be opened is an error
+        if (module.handle == nullptr && !module.missing) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void AbilityModuleLoader::UnloadAll()
+{
+    for (auto it = modules_.rbegin(); it != modules_.rend(); ++it) {
+        if (it->handle != nullptr) {
+            dlclose(it->handle);
+            it->handle = nullptr;
+        }
+        it->missing = false;
+    }
+}
+
+bool AbilityModuleLoader::IsLoaded(const std::string &moduleName) const
+{
+    for (const auto &module : modules_) {
+        if (module.name == moduleName) {
+            return module.handle != nullptr;
+        }
+    }
+    return false;
+}
+} // namespace OHOS
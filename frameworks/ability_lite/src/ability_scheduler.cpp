@@ -21,11 +21,56 @@
 #include "ability_errors.h"
 #include "ability_kit_command.h"
 #include "ability_service_interface.h"
+#include "abilityms_client.h"
 #include "ipc_skeleton.h"
 #include "want_utils.h"
 
 namespace OHOS {
 const int MAX_MODULE_SIZE = 16;
+namespace {
+/*
+ * Owns a deserialized Want on its way to the ability thread. The Want is moved along with the task and released
+ * exactly once when the task is destroyed, whether or not it ever ran.
+ */
+template<typename F>
+class WantTask {
+public:
+    WantTask(Want &want, const F &func) : want_(want), func_(func)
+    {
+        want = {};
+    }
+
+    WantTask(WantTask &&other) noexcept : want_(other.want_), func_(std::move(other.func_))
+    {
+        other.want_ = {};
+    }
+
+    ~WantTask()
+    {
+        ClearWant(&want_);
+    }
+
+    void operator()()
+    {
+        func_(want_);
+    }
+
+private:
+    Want want_;
+    F func_;
+
+    WantTask(const WantTask &) = delete;
+    WantTask &operator=(const WantTask &) = delete;
+    WantTask &operator=(WantTask &&) = delete;
+};
+
+template<typename F>
+AbilityEventTask MakeWantTask(Want &want, const F &func)
+{
+    return AbilityEventTask(WantTask<F>(want, func));
+}
+}
+
 AbilityScheduler::AbilityScheduler(AbilityEventHandler &eventHandler, Scheduler &scheduler)
     : eventHandler_(eventHandler), scheduler_(scheduler)
 {
@@ -66,6 +111,8 @@ int32_t AbilityScheduler::AmsCallback(uint32_t code, IpcIo *data, IpcIo *reply,
                     appInfo.moduleNames.emplace_front(moduleName);
                 }
             }
+            // app init comes from the AMS, the want data it is sent goes to the same uid
+            AbilityMsClient::GetInstance().SetAmsUid(GetCallingUid());
             scheduler->PerformAppInit(appInfo);
             break;
         }
@@ -130,39 +177,44 @@ int32_t AbilityScheduler::AmsCallback(uint32_t code, IpcIo *data, IpcIo *reply,
     return result;
 }
 
+void AbilityScheduler::PostTask(AbilityEventTask &&task, AbilityEventHandler::TaskPriority priority)
+{
+    if (!eventHandler_.PostTask(std::move(task), priority)) {
+        HILOG_ERROR(HILOG_MODULE_APP, "AbilityScheduler fail to post task, priority: %{public}u",
+            static_cast<uint32_t>(priority));
+    }
+}
+
 void AbilityScheduler::PerformAppInit(const AppInfo &appInfo)
 {
     auto task = [this, appInfo] {
         scheduler_.PerformAppInit(appInfo);
     };
-    eventHandler_.PostTask(task);
+    PostTask(AbilityEventTask(std::move(task)), AbilityEventHandler::TaskPriority::HIGH);
 }
 
-void AbilityScheduler::PerformTransactAbilityState(const Want &want, int state, uint64_t token, int abilityType)
+void AbilityScheduler::PerformTransactAbilityState(Want &want, int state, uint64_t token, int abilityType)
 {
-    auto task = [this, want, state, token, abilityType] {
-        scheduler_.PerformTransactAbilityState(want, state, token, abilityType);
-        ClearWant(const_cast<Want *>(&want));
+    auto task = [this, state, token, abilityType](const Want &ownedWant) {
+        scheduler_.PerformTransactAbilityState(ownedWant, state, token, abilityType);
     };
-    eventHandler_.PostTask(task);
+    PostTask(MakeWantTask(want, task), AbilityEventHandler::TaskPriority::HIGH);
 }
 
-void AbilityScheduler::PerformConnectAbility(const Want &want, uint64_t token)
+void AbilityScheduler::PerformConnectAbility(Want &want, uint64_t token)
 {
-    auto task = [this, want, token] {
-        scheduler_.PerformConnectAbility(want, token);
-        ClearWant(const_cast<Want *>(&want));
+    auto task = [this, token](const Want &ownedWant) {
+        scheduler_.PerformConnectAbility(ownedWant, token);
     };
-    eventHandler_.PostTask(task);
+    PostTask(MakeWantTask(want, task), AbilityEventHandler::TaskPriority::HIGH);
 }
 
-void AbilityScheduler::PerformDisconnectAbility(const Want &want, uint64_t token)
+void AbilityScheduler::PerformDisconnectAbility(Want &want, uint64_t token)
 {
-    auto task = [this, want, token] {
-        scheduler_.PerformDisconnectAbility(want, token);
-        ClearWant(const_cast<Want *>(&want));
+    auto task = [this, token](const Want &ownedWant) {
+        scheduler_.PerformDisconnectAbility(ownedWant, token);
     };
-    eventHandler_.PostTask(task);
+    PostTask(MakeWantTask(want, task), AbilityEventHandler::TaskPriority::HIGH);
 }
 
 void AbilityScheduler::PerformAppExit()
@@ -170,19 +222,19 @@ void AbilityScheduler::PerformAppExit()
     auto task = [this] {
         scheduler_.PerformAppExit();
     };
-    eventHandler_.PostTask(task);
+    PostTask(AbilityEventTask(std::move(task)), AbilityEventHandler::TaskPriority::HIGH);
 }
 
-void AbilityScheduler::PerformDumpAbility(const Want &want, uint64_t token)
+void AbilityScheduler::PerformDumpAbility(Want &want, uint64_t token)
 {
     if (want.sid == nullptr) {
         HILOG_ERROR(HILOG_MODULE_APP, "svcId is invalid when dump ability");
+        ClearWant(&want);
         return;
     }
-    auto task = [this, want, token] {
-        scheduler_.PerformDumpAbility(want, token);
-        ClearWant(const_cast<Want *>(&want));
+    auto task = [this, token](const Want &ownedWant) {
+        scheduler_.PerformDumpAbility(ownedWant, token);
     };
-    eventHandler_.PostTask(task);
+    PostTask(MakeWantTask(want, task), AbilityEventHandler::TaskPriority::LOW);
 }
 } // namespace OHOS
@@ -20,8 +20,14 @@
 
 #include "ability_loader.h"
 #include "ability_slice_manager.h"
+#include "ability_slice_pool.h"
 
 namespace OHOS {
+AbilitySlice::~AbilitySlice()
+{
+    AbilitySlicePool::GetInstance().Forget(this);
+}
+
 void AbilitySlice::Init(AbilitySliceManager &abilitySliceManager)
 {
     HILOG_INFO(HILOG_MODULE_APP, "AbilitySlice Init");
@@ -39,6 +45,15 @@ void AbilitySlice::Present(AbilitySlice &abilitySlice, const Want &want)
     abilitySliceManager_->Present(*this, abilitySlice, want);
 }
 
+void AbilitySlice::Present(const std::string &sliceName, const Want &want)
+{
+    if (abilitySliceManager_ == nullptr) {
+        HILOG_ERROR(HILOG_MODULE_APP, "AbilitySlice Present failed");
+        return;
+    }
+    abilitySliceManager_->Present(*this, sliceName, want);
+}
+
 void AbilitySlice::Terminate()
 {
     if (abilitySliceManager_ == nullptr) {
@@ -58,6 +73,11 @@ void AbilitySlice::SetUIContent(RootView *rootView)
     abilitySliceManager_->SetUIContent(rootView);
 }
 
+void AbilitySlice::SetReusable(bool reusable)
+{
+    AbilitySlicePool::GetInstance().SetReusable(this, reusable);
+}
+
 void AbilitySlice::OnStart(const Want &want)
 {
     HILOG_INFO(HILOG_MODULE_APP, "AbilitySlice OnStart");
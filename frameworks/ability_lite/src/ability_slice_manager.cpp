@@ -62,6 +62,11 @@ void AbilitySliceManager::Present(const AbilitySlice &caller, AbilitySlice &targ
     abilitySliceScheduler_->AddAbilitySlice(caller, target, want);
 }
 
+void AbilitySliceManager::Present(const AbilitySlice &caller, const std::string &sliceName, const Want &want)
+{
+    abilitySliceScheduler_->AddAbilitySlice(caller, sliceName, want);
+}
+
 void AbilitySliceManager::Terminate(AbilitySlice &slice)
 {
     abilitySliceScheduler_->RemoveAbilitySlice(slice);
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_slice_pool.h"
+
+#include <ability_state.h>
+#include <log.h>
+
+#include "ability_loader.h"
+#include "ability_slice.h"
+
+#ifndef ABILITY_SLICE_POOL_CAPACITY
+#define ABILITY_SLICE_POOL_CAPACITY 4
+#endif
+
+namespace OHOS {
+AbilitySlicePool &AbilitySlicePool::GetInstance()
+{
+    static AbilitySlicePool slicePool;
+    return slicePool;
+}
+
+AbilitySlicePool::~AbilitySlicePool()
+{
+    Clear();
+}
+
+AbilitySlice *AbilitySlicePool::Acquire(const std::string &sliceName)
+{
+    // the pool holds a handful of slices, a scan is cheaper than keeping an index in step
+    for (auto it = slices_.begin(); it != slices_.end(); ++it) {
+        auto tag = tags_.find(*it);
+        if ((tag != tags_.end()) && (tag->second.name == sliceName)) {
+            AbilitySlice *slice = *it;
+            slices_.erase(it);
+            reused_++;
+            HILOG_INFO(HILOG_MODULE_APP, "reuse slice [%{public}s]", sliceName.c_str());
+            return slice;
+        }
+    }
+    AbilitySlice *slice = AbilityLoader::GetInstance().GetAbilitySliceByName(sliceName);
+    if (slice != nullptr) {
+        // the constructor may already have called SetReusable
+        tags_[slice].name = sliceName;
+        created_++;
+    }
+    return slice;
+}
+
+void AbilitySlicePool::SetReusable(const AbilitySlice *slice, bool reusable)
+{
+    if (slice != nullptr) {
+        tags_[slice].reusable = reusable;
+    }
+}
+
+bool AbilitySlicePool::IsNamed(const AbilitySlice *slice) const
+{
+    auto it = tags_.find(slice);
+    return (it != tags_.end()) && !it->second.name.empty();
+}
+
+void AbilitySlicePool::Forget(const AbilitySlice *slice)
+{
+    (void)tags_.erase(slice);
+}
+
+bool AbilitySlicePool::Keep(AbilitySlice *slice)
+{
+    auto it = tags_.find(slice);
+    if ((it == tags_.end()) || !it->second.reusable || it->second.name.empty() || (ABILITY_SLICE_POOL_CAPACITY == 0)) {
+        return false;
+    }
+    while (slices_.size() >= ABILITY_SLICE_POOL_CAPACITY) {
+        Destroy(slices_.back());
+        slices_.pop_back();
+    }
+    slice->abilitySliceManager_ = nullptr;
+    slice->sliceState_ = STATE_UNINITIALIZED;
+    slices_.push_front(slice);
+    return true;
+}
+
+void AbilitySlicePool::Recycle(AbilitySlice *slice)
+{
+    if ((slice != nullptr) && !Keep(slice)) {
+        Destroy(slice);
+    }
+}
+
+void AbilitySlicePool::Clear()
+{
+    for (auto slice : slices_) {
+        Destroy(slice);
+    }
+    slices_.clear();
+}
+
+void AbilitySlicePool::Destroy(AbilitySlice *slice)
+{
+    // the destructor forgets the slice too, this keeps the tags clean when the pool itself is being destroyed
+    Forget(slice);
+    delete slice;
+    destroyed_++;
+}
+
+uint32_t AbilitySlicePool::GetCapacity() const
+{
+    return ABILITY_SLICE_POOL_CAPACITY;
+}
+
+std::string AbilitySlicePool::GetInfo() const
+{
+    return "    slice pool: cached " + std::to_string(slices_.size()) + "/" +
+        std::to_string(ABILITY_SLICE_POOL_CAPACITY) + ", created " + std::to_string(created_) + ", reused " +
+        std::to_string(reused_) + ", destroyed " + std::to_string(destroyed_) + "\n";
+}
+} // namespace OHOS
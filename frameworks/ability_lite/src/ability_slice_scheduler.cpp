@@ -16,10 +16,12 @@
 #include "ability_slice_scheduler.h"
 
 #include <ability_state.h>
+#include <algorithm>
 #include <log.h>
 
-#include "ability_loader.h"
+#include "ability_event_handler.h"
 #include "ability_slice_manager.h"
+#include "ability_slice_pool.h"
 
 namespace OHOS {
 AbilitySliceScheduler::AbilitySliceScheduler(AbilitySliceManager &abilitySliceManager)
@@ -31,6 +33,7 @@ AbilitySliceScheduler::AbilitySliceScheduler(AbilitySliceManager &abilitySliceMa
 
 AbilitySliceScheduler::~AbilitySliceScheduler()
 {
+    DestroyStopped();
     delete abilitySliceRoute_;
     abilitySliceRoute_ = nullptr;
     delete abilitySliceStack_;
@@ -39,6 +42,7 @@ AbilitySliceScheduler::~AbilitySliceScheduler()
 
 void AbilitySliceScheduler::HandleStartAbilitySlice(const Want &want)
 {
+    auto begin = std::chrono::steady_clock::now();
     if (topAbilitySlice_ == nullptr) {
         topAbilitySlice_ = GetTargetAbilitySlice();
         if (topAbilitySlice_ == nullptr) {
@@ -49,10 +53,12 @@ void AbilitySliceScheduler::HandleStartAbilitySlice(const Want &want)
     topAbilitySlice_->Init(abilitySliceManager_);
 
     topAbilitySlice_->OnStart(want);
+    RecordNavigation(begin);
 }
 
 void AbilitySliceScheduler::HandleInactiveAbilitySlice()
 {
+    DestroyStopped();
     if (topAbilitySlice_ == nullptr) {
         return;
     }
@@ -62,6 +68,7 @@ void AbilitySliceScheduler::HandleInactiveAbilitySlice()
 
 void AbilitySliceScheduler::HandleActiveAbilitySlice(const Want &want)
 {
+    DestroyStopped();
     if (topAbilitySlice_ == nullptr) {
         HILOG_ERROR(HILOG_MODULE_APP, "top ability slice is null, active slice error");
         return;
@@ -74,6 +81,7 @@ void AbilitySliceScheduler::HandleActiveAbilitySlice(const Want &want)
 
 void AbilitySliceScheduler::HandleMoveAbilitySliceToBackground()
 {
+    DestroyStopped();
     if (topAbilitySlice_ == nullptr) {
         return;
     }
@@ -83,6 +91,7 @@ void AbilitySliceScheduler::HandleMoveAbilitySliceToBackground()
 
 void AbilitySliceScheduler::HandleStopAbilitySlice()
 {
+    DestroyStopped();
     if (topAbilitySlice_ == nullptr) {
         return;
     }
@@ -92,18 +101,42 @@ void AbilitySliceScheduler::HandleStopAbilitySlice()
         auto abilitySlice = abilitySliceStack_->Pop();
         if (abilitySlice != nullptr) {
             abilitySlice->OnStop();
+            // slices created by name belong to the framework, the ones an app presented by reference stay its own
+            if (AbilitySlicePool::GetInstance().IsNamed(abilitySlice)) {
+                AbilitySlicePool::GetInstance().Recycle(abilitySlice);
+            }
         }
     }
-    delete topAbilitySlice_;
+    AbilitySlicePool::GetInstance().Recycle(topAbilitySlice_);
     topAbilitySlice_ = nullptr;
 }
 
 void AbilitySliceScheduler::AddAbilitySlice(const AbilitySlice &caller, AbilitySlice &target, const Want &want)
+{
+    (void)PushAbilitySlice(caller, target, want, std::chrono::steady_clock::now());
+}
+
+void AbilitySliceScheduler::AddAbilitySlice(const AbilitySlice &caller, const std::string &sliceName,
+    const Want &want)
+{
+    auto begin = std::chrono::steady_clock::now();
+    AbilitySlice *target = AbilitySlicePool::GetInstance().Acquire(sliceName);
+    if (target == nullptr) {
+        HILOG_ERROR(HILOG_MODULE_APP, "Cannot get slice [%{public}s]", sliceName.c_str());
+        return;
+    }
+    if (!PushAbilitySlice(caller, *target, want, begin)) {
+        AbilitySlicePool::GetInstance().Recycle(target);
+    }
+}
+
+bool AbilitySliceScheduler::PushAbilitySlice(const AbilitySlice &caller, AbilitySlice &target, const Want &want,
+    std::chrono::steady_clock::time_point begin)
 {
     // Check if this jump is legal.
     if (!CheckLegalForAdd(caller, target, want)) {
         HILOG_WARN(HILOG_MODULE_APP, "Cannot jump to target AbilitySlice");
-        return;
+        return false;
     }
 
     // Scheduler top slice to inactive.
@@ -128,10 +161,13 @@ void AbilitySliceScheduler::AddAbilitySlice(const AbilitySlice &caller, AbilityS
     // Update the topAbilitySlice and stack.
     abilitySliceStack_->Push(topAbilitySlice_);
     topAbilitySlice_ = &target;
+    RecordNavigation(begin);
+    return true;
 }
 
 void AbilitySliceScheduler::RemoveAbilitySlice(AbilitySlice &slice)
 {
+    auto begin = std::chrono::steady_clock::now();
     // Check if this slice is legal.
     if (!CheckLegalForRemove(slice)) {
         HILOG_WARN(HILOG_MODULE_APP, "Cannot terminate target AbilitySlice");
@@ -162,6 +198,35 @@ void AbilitySliceScheduler::RemoveAbilitySlice(AbilitySlice &slice)
         slice.OnStop();
         abilitySliceStack_->Remove(&slice);
     }
+    // the slice may be the caller of Terminate, so a named one the pool does not keep is destroyed once it returned
+    AbilitySlicePool &slicePool = AbilitySlicePool::GetInstance();
+    if (!slicePool.Keep(&slice) && slicePool.IsNamed(&slice)) {
+        DestroyLater(slice);
+    }
+    RecordNavigation(begin);
+}
+
+void AbilitySliceScheduler::DestroyLater(AbilitySlice &slice)
+{
+    AbilitySlice *stopped = &slice;
+    AbilityEventHandler *eventHandler = AbilityEventHandler::GetCurrentHandler();
+    if ((eventHandler != nullptr) && eventHandler->PostTask([stopped] {
+        AbilitySlicePool::GetInstance().Recycle(stopped);
+    })) {
+        return;
+    }
+    HILOG_WARN(HILOG_MODULE_APP, "Slice [%{public}s] is destroyed with the next ability transition",
+        typeid(slice).name());
+    stoppedSlices_.push_back(stopped);
+}
+
+void AbilitySliceScheduler::DestroyStopped()
+{
+    std::vector<AbilitySlice *> stopped;
+    stopped.swap(stoppedSlices_);
+    for (auto slice : stopped) {
+        AbilitySlicePool::GetInstance().Recycle(slice);
+    }
 }
 
 void AbilitySliceScheduler::SetMainRoute(const std::string &entry)
@@ -178,7 +243,7 @@ AbilitySlice *AbilitySliceScheduler::GetTargetAbilitySlice() const
 {
     std::string mainEntry = abilitySliceRoute_->GetMainRoute();
 
-    return AbilityLoader::GetInstance().GetAbilitySliceByName(mainEntry);
+    return AbilitySlicePool::GetInstance().Acquire(mainEntry);
 }
 
 bool AbilitySliceScheduler::CheckLegalForAdd(const AbilitySlice &caller, AbilitySlice &target, const Want &want)
@@ -236,6 +301,19 @@ const std::string AbilitySliceScheduler::GetSliceStackInfo() const
     for (auto slice : slices) {
         buff += "    [" + std::string(typeid(*slice).name()) + "] State: [" + std::to_string(slice->GetState()) + "]\n";
     }
+    uint64_t averageUs = (navigations_ == 0) ? 0 : (totalNavigationUs_ / navigations_);
+    buff += "    navigation: " + std::to_string(navigations_) + " times, last " + std::to_string(lastNavigationUs_) +
+        " us, average " + std::to_string(averageUs) + " us, max " + std::to_string(maxNavigationUs_) + " us\n";
+    buff += AbilitySlicePool::GetInstance().GetInfo();
     return buff;
 }
+
+void AbilitySliceScheduler::RecordNavigation(std::chrono::steady_clock::time_point begin)
+{
+    auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+    lastNavigationUs_ = static_cast<uint64_t>(cost.count());
+    maxNavigationUs_ = std::max(maxNavigationUs_, lastNavigationUs_);
+    totalNavigationUs_ += lastNavigationUs_;
+    navigations_++;
+}
 } // namespace OHOS
\ No newline at end of file
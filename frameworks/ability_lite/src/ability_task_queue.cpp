@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_task_queue.h"
+
+#include <algorithm>
+#include <new>
+
+namespace OHOS {
+namespace {
+    constexpr uint32_t MIN_TASK_QUEUE_CAPACITY = 2;
+}
+
+AbilityTaskQueue::AbilityTaskQueue(uint32_t capacity)
+{
+    uint32_t slotNum = MIN_TASK_QUEUE_CAPACITY;
+    while (slotNum < capacity) {
+        slotNum <<= 1;
+    }
+    slots_ = new (std::nothrow) Slot[slotNum];
+    if (slots_ == nullptr) {
+        return;
+    }
+    mask_ = slotNum - 1;
+    for (uint32_t i = 0; i < slotNum; i++) {
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+AbilityTaskQueue::~AbilityTaskQueue()
+{
+    delete[] slots_;
+    slots_ = nullptr;
+}
+
+bool AbilityTaskQueue::Push(AbilityEventTask &&task)
+{
+    if (slots_ == nullptr) {
+        return false;
+    }
+    uint32_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    Slot *slot = nullptr;
+    while (true) {
+        slot = &slots_[pos & mask_];
+        uint32_t sequence = slot->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<int32_t>(sequence - pos);
+        if (diff == 0) {
+            // the slot is free for this lap, try to claim it
+            if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // the consumer has not released this slot since the previous lap
+            return false;
+        } else {
+            pos = enqueuePos_.load(std::memory_order_relaxed);
+        }
+    }
+    slot->task = std::move(task);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool AbilityTaskQueue::Pop(AbilityEventTask &task)
+{
+    if (slots_ == nullptr) {
+        return false;
+    }
+    Slot *slot = &slots_[dequeuePos_ & mask_];
+    if (slot->sequence.load(std::memory_order_acquire) != dequeuePos_ + 1) {
+        return false;
+    }
+    task = std::move(slot->task);
+    slot->sequence.store(dequeuePos_ + mask_ + 1, std::memory_order_release);
+    dequeuePos_++;
+    return true;
+}
+
+bool AbilityTaskQueue::IsEmpty() const
+{
+    if (slots_ == nullptr) {
+        return true;
+    }
+    const Slot *slot = &slots_[dequeuePos_ & mask_];
+    return slot->sequence.load(std::memory_order_acquire) != dequeuePos_ + 1;
+}
+
+bool AbilityTimerHeap::Later(const Timer &left, const Timer &right)
+{
+    if (left.deadline != right.deadline) {
+        return left.deadline > right.deadline;
+    }
+    return left.sequence > right.sequence;
+}
+
+uint32_t AbilityTimerHeap::Add(AbilityEventTask &&task, uint64_t deadline, uint32_t intervalMs)
+{
+    nextId_++;
+    if (nextId_ == 0) {
+        nextId_++;
+    }
+    timers_.push_back(Timer { deadline, nextSequence_++, nextId_, intervalMs, std::move(task) });
+    std::push_heap(timers_.begin(), timers_.end(), Later);
+    return nextId_;
+}
+
+bool AbilityTimerHeap::Remove(uint32_t timerId)
+{
+    if (timerId != 0 && timerId == runningId_) {
+        runningId_ = 0;
+        return true;
+    }
+    auto iter = std::find_if(timers_.begin(), timers_.end(), [timerId](const Timer &timer) {
+        return timer.id == timerId;
+    });
+    if (iter == timers_.end()) {
+        return false;
+    }
+    *iter = std::move(timers_.back());
+    timers_.pop_back();
+    std::make_heap(timers_.begin(), timers_.end(), Later);
+    return true;
+}
+
+bool AbilityTimerHeap::PopExpired(uint64_t now, Timer &timer)
+{
+    if (timers_.empty() || timers_.front().deadline > now) {
+        return false;
+    }
+    std::pop_heap(timers_.begin(), timers_.end(), Later);
+    timer = std::move(timers_.back());
+    timers_.pop_back();
+    runningId_ = (timer.intervalMs == 0) ? 0 : timer.id;
+    return true;
+}
+
+void AbilityTimerHeap::Rearm(Timer &&timer, uint64_t now)
+{
+    if (timer.id != runningId_) {
+        return;
+    }
+    runningId_ = 0;
+    // a late periodic task skips the ticks it missed instead of firing them back to back
+    timer.deadline += timer.intervalMs;
+    if (timer.deadline <= now) {
+        timer.deadline = now + timer.intervalMs;
+    }
+    timer.sequence = nextSequence_++;
+    timers_.push_back(std::move(timer));
+    std::push_heap(timers_.begin(), timers_.end(), Later);
+}
+
+uint64_t AbilityTimerHeap::GetNextDeadline() const
+{
+    return timers_.empty() ? UINT64_MAX : timers_.front().deadline;
+}
+} // namespace OHOS
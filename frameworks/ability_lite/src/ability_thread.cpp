@@ -19,22 +19,23 @@
 #include <ability_kit_command.h>
 #include <ability_service_interface.h>
 #include <ability_state.h>
-#include <climits>
 #include <cstring>
 #ifdef ABILITY_WINDOW_SUPPORT
 #include <common/graphic_startup.h>
 #include <common/task_manager.h>
 #include <dock/screen_device_proxy.h>
 #include <font/ui_font_header.h>
-#include <sys/prctl.h>
 #endif
-#include <dlfcn.h>
 #include <kvstore_env.h>
 
 #include "ability_env.h"
 #include "ability_env_impl.h"
 #include "ability_info.h"
 #include "ability_loader.h"
+#include "ability_module_loader.h"
+#ifdef ABILITY_WINDOW_SUPPORT
+#include "ability_slice_pool.h"
+#endif
 #include "ability_service_interface.h"
 #include "adapter.h"
 #include "element_name_utils.h"
@@ -44,9 +45,6 @@
 
 namespace OHOS {
 namespace {
-constexpr static char PATH_SEPARATOR[] = "/";
-constexpr static char LIB_PREFIX[] = "/lib";
-constexpr static char LIB_SUFFIX[] = ".so";
 constexpr static char ACE_ABILITY_NAME[] = "AceAbility";
 #ifdef ABILITY_WINDOW_SUPPORT
 #ifdef OPENHARMONY_FONT_PATH
@@ -54,12 +52,10 @@ constexpr static char FONT_PATH[] = "/storage/data/";
 #else
 constexpr static char FONT_PATH[] = "/sdcard/data/";
 #endif
-constexpr static int UI_TASK_HANDLER_PERIOD = 10 * 1000; // UI task execute period is 10ms
-constexpr static char UI_TASK_THREAD_NAME[] = "UITaskPost";
+constexpr static uint32_t UI_TASK_HANDLER_PERIOD = 10; // UI task execute period is 10ms
 static uint32_t g_fontPsramBaseAddr[MIN_FONT_PSRAM_LENGTH / 4];
 #endif
 }
-bool AbilityThread::isAppRunning_ = true;
 bool AbilityThread::isNativeApp_ = true;
 bool AbilityThread::isDisplayInited_ = false;
 
@@ -84,31 +80,6 @@ void AbilityThread::ThreadMain(uint64_t token)
 }
 
 #ifdef ABILITY_WINDOW_SUPPORT
-void *AbilityThread::UITaskPost(void *arg)
-{
-    prctl(PR_SET_NAME, UI_TASK_THREAD_NAME);
-
-    auto handler = static_cast<AbilityEventHandler *>(arg);
-    if (handler == nullptr) {
-        HILOG_ERROR(HILOG_MODULE_APP, "EventHandler is nullptr, fail to start loop");
-        return nullptr;
-    }
-
-    int ret = pthread_detach(pthread_self());
-    if (ret != 0) {
-        HILOG_WARN(HILOG_MODULE_APP, "UITaskPost detach failed: %{public}d", ret);
-    }
-
-    HILOG_INFO(HILOG_MODULE_APP, "start UITaskPost loop");
-    while (isAppRunning_) {
-        handler->PostTask([] {
-            TaskManager::GetInstance()->TaskHandler();
-        });
-        usleep(UI_TASK_HANDLER_PERIOD);
-    }
-    return nullptr;
-}
-
 void AbilityThread::InitUITaskEnv()
 {
     if (isDisplayInited_) {
@@ -121,15 +92,39 @@ void AbilityThread::InitUITaskEnv()
         const_cast<char *>(FONT_PATH), DEFAULT_VECTOR_FONT_FILENAME);
     auto screenDevice = new ScreenDevice();
     ScreenDeviceProxy::GetInstance()->SetDevice(screenDevice);
+    isDisplayInited_ = true;
+}
 
-    HILOG_INFO(HILOG_MODULE_APP, "Create UITaskPost thread");
-    pthread_t tid;
-    int ret = pthread_create(&tid, nullptr, AbilityThread::UITaskPost, eventHandler_);
-    if (ret != 0) {
-        HILOG_ERROR(HILOG_MODULE_APP, "create UI post thread error, %{public}d", ret);
-        exit(-1);
+void AbilityThread::UpdateUITaskTimer()
+{
+    if (!isDisplayInited_) {
+        return;
+    }
+    // rendering and input polling only have work while a page is in the foreground, a background app stays asleep
+    bool foreground = false;
+    for (const auto &entry : abilities_) {
+        const Ability *ability = entry.second;
+        if ((ability != nullptr) && (ability->abilityType_ == PAGE) &&
+            ((ability->GetState() == STATE_ACTIVE) || (ability->GetState() == STATE_INACTIVE))) {
+            foreground = true;
+            break;
+        }
+    }
+    if (foreground && (uiTimerId_ == 0)) {
+        HILOG_INFO(HILOG_MODULE_APP, "Start UI task timer");
+        // UI tasks share the ability thread, the timer replaces the thread that used to post them every period
+        uiTimerId_ = eventHandler_->PostTimerTask([] {
+            TaskManager::GetInstance()->TaskHandler();
+        }, 0, UI_TASK_HANDLER_PERIOD);
+        if (uiTimerId_ == 0) {
+            HILOG_ERROR(HILOG_MODULE_APP, "start UI task timer error");
+            exit(-1);
+        }
+    } else if (!foreground && (uiTimerId_ != 0)) {
+        HILOG_INFO(HILOG_MODULE_APP, "Stop UI task timer");
+        eventHandler_->RemoveTimerTask(uiTimerId_);
+        uiTimerId_ = 0;
     }
-    isDisplayInited_ = true;
 }
 #endif
 
@@ -168,23 +163,13 @@ void AbilityThread::PerformAppInit(const AppInfo &appInfo)
     AbilityEnvImpl::GetInstance().SetAppInfo(appInfo);
     AbilityThread::isNativeApp_ = appInfo.isNativeApp;
 
-    for (const auto &module : appInfo.moduleNames) {
-        if (appInfo.isNativeApp) {
-            std::string modulePath = appInfo.srcPath + PATH_SEPARATOR + module + LIB_PREFIX + module + LIB_SUFFIX;
-            if (modulePath.size() > PATH_MAX) {
-                continue;
-            }
-            char realPath[PATH_MAX + 1] = { 0 };
-            if (realpath(modulePath.c_str(), realPath) == nullptr) {
-                HILOG_ERROR(HILOG_MODULE_APP, "Fail to get realpath of %{public}s", modulePath.c_str());
-                continue;
-            }
-            void *handle = dlopen(static_cast<char *>(realPath), RTLD_NOW | RTLD_GLOBAL);
-            if (handle == nullptr) {
-                HILOG_ERROR(HILOG_MODULE_APP, "Fail to dlopen %{public}s, [%{public}s]", modulePath.c_str(), dlerror());
-                exit(-1);
-            }
-            handle_.emplace_front(handle);
+    // native modules are opened by AbilityLoader when one of their classes is first looked up
+    if (appInfo.isNativeApp) {
+        AbilityModuleLoader &moduleLoader = AbilityModuleLoader::GetInstance();
+        moduleLoader.SetModules(appInfo.srcPath, appInfo.moduleNames);
+        // without a manifest a class can not be traced to its module, so all are loaded up front
+        if (!moduleLoader.HasManifest() && !moduleLoader.LoadAll()) {
+            exit(-1);
         }
     }
 
@@ -199,14 +184,16 @@ void AbilityThread::PerformAppExit()
         return;
     }
     
-    eventHandler_->PostTask([] {
-        AbilityThread::isAppRunning_ = false;
-    });
-    for (auto handle : handle_) {
-        dlclose(handle);
+#ifdef ABILITY_WINDOW_SUPPORT
+    if (uiTimerId_ != 0) {
+        eventHandler_->RemoveTimerTask(uiTimerId_);
+        uiTimerId_ = 0;
     }
+    // pooled slices run destructors from the app modules
+    AbilitySlicePool::GetInstance().Clear();
+#endif
+    AbilityModuleLoader::GetInstance().UnloadAll();
     eventHandler_->PostQuit();
-    handle_.clear();
 }
 
 void AbilityThread::PerformTransactAbilityState(const Want &want, int state, uint64_t token, int abilityType)
@@ -217,14 +204,14 @@ void AbilityThread::PerformTransactAbilityState(const Want &want, int state, uin
     if ((iter == abilities_.end()) || (iter->second == nullptr)) {
         if (want.element == nullptr) {
             HILOG_ERROR(HILOG_MODULE_APP, "element name is null, fail to load ability");
-            AbilityMsClient::GetInstance().SchedulerLifecycleDone(token, STATE_INITIAL);
+            ReportLifecycleDone(token, STATE_INITIAL);
             return;
         }
         auto abilityName = isNativeApp_ ? want.element->abilityName : ACE_ABILITY_NAME;
         ability = AbilityLoader::GetInstance().GetAbilityByName(abilityName);
         if (ability == nullptr) {
             HILOG_ERROR(HILOG_MODULE_APP, "fail to load ability: %{public}s", abilityName);
-            AbilityMsClient::GetInstance().SchedulerLifecycleDone(token, STATE_INITIAL);
+            ReportLifecycleDone(token, STATE_INITIAL);
             return;
         }
         HILOG_INFO(HILOG_MODULE_APP, "Create ability success [%{public}s]", want.element->abilityName);
@@ -246,7 +233,7 @@ void AbilityThread::PerformTransactAbilityState(const Want &want, int state, uin
     }
 
     HILOG_INFO(HILOG_MODULE_APP, "perform transact ability state done [%{public}d]", ability->GetState());
-    AbilityMsClient::GetInstance().SchedulerLifecycleDone(token, ability->GetState());
+    ReportLifecycleDone(token, ability->GetState());
     if (ability->GetState() == STATE_ACTIVE) {
         StartAbilityCallback(want);
     }
@@ -255,6 +242,29 @@ void AbilityThread::PerformTransactAbilityState(const Want &want, int state, uin
         abilities_.erase(token);
         delete ability;
     }
+#ifdef ABILITY_WINDOW_SUPPORT
+    UpdateUITaskTimer();
+#endif
+}
+
+void AbilityThread::ReportLifecycleDone(uint64_t token, int state)
+{
+    if (!AbilityMsClient::GetInstance().QueueLifecycleDone(token, state)) {
+        return;
+    }
+    if (eventHandler_ == nullptr) {
+        (void) AbilityMsClient::GetInstance().FlushLifecycleDone();
+        return;
+    }
+    // lifecycle tasks share the high priority lane, so the flush runs after every transaction already queued and
+    // reports them to AMS in one request
+    bool posted = eventHandler_->PostTask(AbilityEventTask([] {
+        (void) AbilityMsClient::GetInstance().FlushLifecycleDone();
+    }), AbilityEventHandler::TaskPriority::HIGH);
+    if (!posted) {
+        // later results are only held while a flush is on its way, so a flush that cannot be posted runs right here
+        (void) AbilityMsClient::GetInstance().FlushLifecycleDone();
+    }
 }
 
 void AbilityThread::PerformConnectAbility(const Want &want, uint64_t token)
@@ -15,10 +15,260 @@
 
 #include "ability_saved_data.h"
 #include "adapter.h"
+#include "securec.h"
 #include "utils.h"
+#ifdef ABILITY_SAVED_DATA_DIR
+#include "utils_file.h"
+#endif
 
 namespace OHOS {
 namespace AbilitySlite {
+namespace {
+constexpr uint32_t MIN_MATCH = 4;
+constexpr uint32_t MAX_OFFSET = UINT16_MAX;
+constexpr uint32_t RUN_MASK = 15;
+constexpr uint32_t EXTEND_BYTE = 255;
+constexpr uint32_t HASH_BITS = 8;
+constexpr uint32_t HASH_MULTIPLIER = 2654435761U;
+constexpr uint32_t TOKEN_SHIFT = 4;
+constexpr uint32_t BYTE_BITS = 8;
+constexpr uint32_t OFFSET_BYTES = 2;
+constexpr uint32_t FNV_OFFSET_BASIS = 2166136261U;
+constexpr uint32_t FNV_PRIME = 16777619U;
+#ifdef ABILITY_SAVED_DATA_DIR
+constexpr uint32_t SPILL_PATH_MAX = 128;
+// no bundle file, those end with .sav
+constexpr char GENERATION_FILE[] = ABILITY_SAVED_DATA_DIR "/generation";
+#endif
+
+struct SavedDataImageHeader {
+    uint32_t checksum;
+    uint16_t savedDataSize;
+    uint16_t userSavedDataSize;
+    uint16_t payloadSize;
+    uint8_t compressed;
+    uint8_t reserved;
+};
+
+constexpr uint32_t MAX_IMAGE_SIZE = sizeof(SavedDataImageHeader) + SAVED_DATA_LIMIT * 2;
+
+// leads a spill file, the files of an earlier boot carry an older generation and are stale
+struct SpillFileHeader {
+    uint32_t generation;
+};
+
+uint32_t Checksum(const uint8_t *data, uint32_t size)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+    for (uint32_t i = 0; i < size; ++i) {
+        hash = (hash ^ data[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+uint32_t HashSequence(const uint8_t *data)
+{
+    uint32_t sequence = 0;
+    (void) memcpy_s(&sequence, sizeof(sequence), data, MIN_MATCH);
+    return (sequence * HASH_MULTIPLIER) >> (sizeof(uint32_t) * BYTE_BITS - HASH_BITS);
+}
+
+bool PutLength(uint8_t *dst, uint32_t capacity, uint32_t &pos, uint32_t length)
+{
+    // the part of a length not fitting its token nibble, in 255 steps
+    for (; length >= EXTEND_BYTE; length -= EXTEND_BYTE) {
+        if (pos >= capacity) {
+            return false;
+        }
+        dst[pos++] = EXTEND_BYTE;
+    }
+    if (pos >= capacity) {
+        return false;
+    }
+    dst[pos++] = static_cast<uint8_t>(length);
+    return true;
+}
+
+bool GetLength(const uint8_t *src, uint32_t srcSize, uint32_t &pos, uint32_t &length)
+{
+    uint8_t byte = EXTEND_BYTE;
+    while (byte == EXTEND_BYTE) {
+        if (pos >= srcSize) {
+            return false;
+        }
+        byte = src[pos++];
+        length += byte;
+    }
+    return true;
+}
+
+bool PutSequence(uint8_t *dst, uint32_t capacity, uint32_t &pos, const uint8_t *literals, uint32_t literalSize,
+    uint32_t offset, uint32_t matchSize)
+{
+    if (pos >= capacity) {
+        return false;
+    }
+    uint32_t tokenPos = pos++;
+    uint32_t literalRun = (literalSize < RUN_MASK) ? literalSize : RUN_MASK;
+    if (literalSize >= RUN_MASK && !PutLength(dst, capacity, pos, literalSize - RUN_MASK)) {
+        return false;
+    }
+    if (capacity - pos < literalSize) {
+        return false;
+    }
+    if (literalSize > 0 && memcpy_s(dst + pos, capacity - pos, literals, literalSize) != EOK) {
+        return false;
+    }
+    pos += literalSize;
+    uint32_t matchRun = 0;
+    if (matchSize > 0) {
+        if (capacity - pos < OFFSET_BYTES) {
+            return false;
+        }
+        dst[pos++] = static_cast<uint8_t>(offset);
+        dst[pos++] = static_cast<uint8_t>(offset >> BYTE_BITS);
+        matchRun = ((matchSize - MIN_MATCH) < RUN_MASK) ? (matchSize - MIN_MATCH) : RUN_MASK;
+        if (matchSize - MIN_MATCH >= RUN_MASK && !PutLength(dst, capacity, pos, matchSize - MIN_MATCH - RUN_MASK)) {
+            return false;
+        }
+    }
+    dst[tokenPos] = static_cast<uint8_t>((literalRun << TOKEN_SHIFT) | matchRun);
+    return true;
+}
+
+// LZ77 in the LZ4 block layout: a token with literal and match run lengths, the literals, a 16-bit backward offset
+// and the match, the last sequence has literals only. Returns 0 if the result would not be smaller than the input.
+uint32_t CompressBlock(const uint8_t *src, uint32_t srcSize, uint8_t *dst, uint32_t capacity, uint16_t *table)
+{
+    if (memset_s(table, sizeof(uint16_t) << HASH_BITS, 0, sizeof(uint16_t) << HASH_BITS) != EOK) {
+        return 0;
+    }
+    uint32_t pos = 0;
+    uint32_t anchor = 0;
+    uint32_t cursor = 0;
+    while (cursor + MIN_MATCH <= srcSize) {
+        uint32_t hash = HashSequence(src + cursor);
+        uint32_t candidate = table[hash];
+        // table entries are position + 1, 0 marks an empty slot
+        table[hash] = static_cast<uint16_t>(cursor + 1);
+        if (candidate == 0 || cursor - (candidate - 1) > MAX_OFFSET ||
+            memcmp(src + candidate - 1, src + cursor, MIN_MATCH) != 0) {
+            cursor++;
+            continue;
+        }
+        uint32_t reference = candidate - 1;
+        uint32_t matchSize = MIN_MATCH;
+        while (cursor + matchSize < srcSize && src[reference + matchSize] == src[cursor + matchSize]) {
+            matchSize++;
+        }
+        if (!PutSequence(dst, capacity, pos, src + anchor, cursor - anchor, cursor - reference, matchSize)) {
+            return 0;
+        }
+        cursor += matchSize;
+        anchor = cursor;
+    }
+    if (!PutSequence(dst, capacity, pos, src + anchor, srcSize - anchor, 0, 0)) {
+        return 0;
+    }
+    return (pos < srcSize) ? pos : 0;
+}
+
+bool DecompressBlock(const uint8_t *src, uint32_t srcSize, uint8_t *dst, uint32_t dstSize)
+{
+    uint32_t pos = 0;
+    uint32_t out = 0;
+    while (pos < srcSize) {
+        uint8_t token = src[pos++];
+        uint32_t literalSize = token >> TOKEN_SHIFT;
+        if (literalSize == RUN_MASK && !GetLength(src, srcSize, pos, literalSize)) {
+            return false;
+        }
+        if (srcSize - pos < literalSize || dstSize - out < literalSize) {
+            return false;
+        }
+        if (literalSize > 0 && memcpy_s(dst + out, dstSize - out, src + pos, literalSize) != EOK) {
+            return false;
+        }
+        pos += literalSize;
+        out += literalSize;
+        if (pos == srcSize) {
+            break;
+        }
+        if (srcSize - pos < OFFSET_BYTES) {
+            return false;
+        }
+        uint32_t offset = src[pos] | (static_cast<uint32_t>(src[pos + 1]) << BYTE_BITS);
+        pos += OFFSET_BYTES;
+        uint32_t matchSize = token & RUN_MASK;
+        if (matchSize == RUN_MASK && !GetLength(src, srcSize, pos, matchSize)) {
+            return false;
+        }
+        matchSize += MIN_MATCH;
+        if (offset == 0 || offset > out || dstSize - out < matchSize) {
+            return false;
+        }
+        // byte by byte, a match may overlap the bytes it produces
+        for (uint32_t i = 0; i < matchSize; ++i, ++out) {
+            dst[out] = dst[out - offset];
+        }
+    }
+    return out == dstSize;
+}
+
+#ifdef ABILITY_SAVED_DATA_DIR
+// counted up once per boot in the saved data directory, 0 if the count cannot be kept and nothing is spilled
+uint32_t GetBootGeneration()
+{
+    static bool loaded = false;
+    static uint32_t generation = 0;
+    if (loaded) {
+        return generation;
+    }
+    loaded = true;
+    uint32_t previous = 0;
+    int32_t fd = UtilsFileOpen(GENERATION_FILE, O_RDONLY_FS, 0);
+    if (fd >= 0) {
+        if (UtilsFileRead(fd, reinterpret_cast<char *>(&previous), sizeof(previous)) !=
+            static_cast<int32_t>(sizeof(previous))) {
+            previous = 0;
+        }
+        (void) UtilsFileClose(fd);
+    }
+    uint32_t next = (previous == UINT32_MAX) ? 1 : previous + 1;
+    fd = UtilsFileOpen(GENERATION_FILE, O_CREAT_FS | O_TRUNC_FS | O_WRONLY_FS, 0);
+    if (fd < 0) {
+        return generation;
+    }
+    int32_t written = UtilsFileWrite(fd, reinterpret_cast<const char *>(&next), sizeof(next));
+    (void) UtilsFileClose(fd);
+    if (written == static_cast<int32_t>(sizeof(next))) {
+        generation = next;
+    }
+    return generation;
+}
+
+bool IsCurrentSpillFile(const char *path)
+{
+    SpillFileHeader header = { 0 };
+    int32_t fd = UtilsFileOpen(path, O_RDONLY_FS, 0);
+    if (fd < 0) {
+        return false;
+    }
+    int32_t readSize = UtilsFileRead(fd, reinterpret_cast<char *>(&header), sizeof(header));
+    (void) UtilsFileClose(fd);
+    uint32_t generation = GetBootGeneration();
+    return readSize == static_cast<int32_t>(sizeof(header)) && generation != 0 && header.generation == generation;
+}
+
+bool GetSpillPath(const char *bundleName, char *path, uint32_t size)
+{
+    if (bundleName == nullptr || *bundleName == '\0' || strchr(bundleName, '/') != nullptr) {
+        return false;
+    }
+    return snprintf_s(path, size, size - 1, "%s/%s.sav", ABILITY_SAVED_DATA_DIR, bundleName) > 0;
+}
+#endif
+}
 
 AbilitySavedData::AbilitySavedData() = default;
 
@@ -26,6 +276,8 @@ AbilitySavedData::~AbilitySavedData()
 {
     AdapterFree(savedData);
     AdapterFree(userSavedData);
+    AdapterFree(packedData);
+    ReleaseSpillFile(!keepSpillFile);
 }
 
 SavedResultCode AbilitySavedData::SetSavedData(const void *buffer, uint16_t bufferSize)
@@ -36,6 +288,10 @@ SavedResultCode AbilitySavedData::SetSavedData(const void *buffer, uint16_t buff
     if (bufferSize > SAVED_DATA_LIMIT) {
         return SavedResultCode::SAVED_RESULT_EXCEED_UPPER_LIMIT;
     }
+    SavedResultCode result = Restore();
+    if (result != SavedResultCode::SAVED_RESULT_OK && result != SavedResultCode::SAVED_RESULT_NO_DATA) {
+        return result;
+    }
     void *dumpBuffer = Utils::Memdup(buffer, bufferSize);
     if (dumpBuffer == nullptr) {
         return SavedResultCode::SAVED_RESULT_ALLOC_ERROR;
@@ -54,6 +310,10 @@ SavedResultCode AbilitySavedData::SetUserSavedData(const void *buffer, uint16_t
     if (bufferSize > SAVED_DATA_LIMIT) {
         return SavedResultCode::SAVED_RESULT_EXCEED_UPPER_LIMIT;
     }
+    SavedResultCode result = Restore();
+    if (result != SavedResultCode::SAVED_RESULT_OK && result != SavedResultCode::SAVED_RESULT_NO_DATA) {
+        return result;
+    }
     void *dumpBuffer = Utils::Memdup(buffer, bufferSize);
     if (dumpBuffer == nullptr) {
         return SavedResultCode::SAVED_RESULT_ALLOC_ERROR;
@@ -69,6 +329,11 @@ SavedResultCode AbilitySavedData::GetSavedData(void *buffer, uint16_t bufferSize
     if (getDataSize == nullptr) {
         return SavedResultCode::SAVED_RESULT_INVALID_PARAM;
     }
+    SavedResultCode result = Restore();
+    if (result != SavedResultCode::SAVED_RESULT_OK && result != SavedResultCode::SAVED_RESULT_NO_DATA) {
+        *getDataSize = 0;
+        return result;
+    }
     if (buffer == nullptr || bufferSize < savedDataSize) {
         *getDataSize = 0;
         return SavedResultCode::SAVED_RESULT_INVALID_PARAM;
@@ -91,6 +356,11 @@ SavedResultCode AbilitySavedData::GetUserSavedData(void *buffer, uint16_t buffer
     if (getDataSize == nullptr) {
         return SavedResultCode::SAVED_RESULT_INVALID_PARAM;
     }
+    SavedResultCode result = Restore();
+    if (result != SavedResultCode::SAVED_RESULT_OK && result != SavedResultCode::SAVED_RESULT_NO_DATA) {
+        *getDataSize = 0;
+        return result;
+    }
     if (buffer == nullptr || bufferSize < userSavedDataSize) {
         *getDataSize = 0;
         return SavedResultCode::SAVED_RESULT_INVALID_PARAM;
@@ -122,10 +392,268 @@ void AbilitySavedData::Reset()
 {
     AdapterFree(savedData);
     AdapterFree(userSavedData);
+    AdapterFree(packedData);
+    ReleaseSpillFile(true);
     savedDataSize = 0;
     userSavedDataSize = 0;
+    packedDataSize = 0;
     savedResult = SavedResultCode::SAVED_RESULT_NO_DATA;
 }
 
+SavedResultCode AbilitySavedData::Compress()
+{
+    if (packedData != nullptr || spillPath != nullptr) {
+        return SavedResultCode::SAVED_RESULT_OK;
+    }
+    uint32_t rawSize = savedDataSize + userSavedDataSize;
+    if (rawSize == 0) {
+        return SavedResultCode::SAVED_RESULT_NO_DATA;
+    }
+    // the hash table of the compressor, then the raw bytes of both buffers, then the image
+    uint32_t tableSize = sizeof(uint16_t) << HASH_BITS;
+    uint32_t imageCapacity = sizeof(SavedDataImageHeader) + rawSize;
+    auto work = static_cast<uint8_t *>(AdapterMalloc(tableSize + rawSize + imageCapacity));
+    if (work == nullptr) {
+        return SavedResultCode::SAVED_RESULT_ALLOC_ERROR;
+    }
+    auto table = reinterpret_cast<uint16_t *>(work);
+    uint8_t *raw = work + tableSize;
+    uint8_t *image = raw + rawSize;
+    if ((savedDataSize > 0 && memcpy_s(raw, rawSize, savedData, savedDataSize) != EOK) ||
+        (userSavedDataSize > 0 &&
+        memcpy_s(raw + savedDataSize, rawSize - savedDataSize, userSavedData, userSavedDataSize) != EOK)) {
+        AdapterFree(work);
+        return SavedResultCode::SAVED_RESULT_INVALID_PARAM;
+    }
+    SavedDataImageHeader header = { Checksum(raw, rawSize), savedDataSize, userSavedDataSize, 0, 1, 0 };
+    uint8_t *payload = image + sizeof(header);
+    uint32_t payloadSize = CompressBlock(raw, rawSize, payload, rawSize, table);
+    if (payloadSize == 0) {
+        // incompressible, the image carries the raw bytes
+        header.compressed = 0;
+        payloadSize = rawSize;
+        (void) memcpy_s(payload, rawSize, raw, rawSize);
+    }
+    header.payloadSize = static_cast<uint16_t>(payloadSize);
+    (void) memcpy_s(image, imageCapacity, &header, sizeof(header));
+    uint16_t imageSize = static_cast<uint16_t>(sizeof(header) + payloadSize);
+    packedData = Utils::Memdup(image, imageSize);
+    AdapterFree(work);
+    if (packedData == nullptr) {
+        return SavedResultCode::SAVED_RESULT_ALLOC_ERROR;
+    }
+    packedDataSize = imageSize;
+    AdapterFree(savedData);
+    AdapterFree(userSavedData);
+    return SavedResultCode::SAVED_RESULT_OK;
+}
+
+SavedResultCode AbilitySavedData::Spill(const char *bundleName)
+{
+    SavedResultCode result = Compress();
+    if (result != SavedResultCode::SAVED_RESULT_OK || packedData == nullptr) {
+        return result;
+    }
+#ifdef ABILITY_SAVED_DATA_DIR
+    char path[SPILL_PATH_MAX] = { 0 };
+    if (!GetSpillPath(bundleName, path, sizeof(path))) {
+        return SavedResultCode::SAVED_RESULT_INVALID_PARAM;
+    }
+    SpillFileHeader fileHeader = { GetBootGeneration() };
+    int32_t fd = (fileHeader.generation == 0) ? -1 : UtilsFileOpen(path, O_CREAT_FS | O_TRUNC_FS | O_WRONLY_FS, 0);
+    if (fd < 0) {
+        // the compressed image stays in RAM
+        return SavedResultCode::SAVED_RESULT_OK;
+    }
+    bool written = UtilsFileWrite(fd, reinterpret_cast<const char *>(&fileHeader), sizeof(fileHeader)) ==
+        static_cast<int32_t>(sizeof(fileHeader)) &&
+        UtilsFileWrite(fd, static_cast<const char *>(packedData), packedDataSize) == packedDataSize;
+    (void) UtilsFileClose(fd);
+    if (!written) {
+        (void) UtilsFileDelete(path);
+        return SavedResultCode::SAVED_RESULT_OK;
+    }
+    char *pathCopy = Utils::Strdup(path);
+    if (pathCopy == nullptr) {
+        (void) UtilsFileDelete(path);
+        return SavedResultCode::SAVED_RESULT_OK;
+    }
+    spillPath = pathCopy;
+    keepSpillFile = false;
+    AdapterFree(packedData);
+    packedDataSize = 0;
+#else
+    (void) bundleName;
+#endif
+    return SavedResultCode::SAVED_RESULT_OK;
+}
+
+SavedResultCode AbilitySavedData::Attach(const char *bundleName)
+{
+#ifdef ABILITY_SAVED_DATA_DIR
+    char path[SPILL_PATH_MAX] = { 0 };
+    if (!GetSpillPath(bundleName, path, sizeof(path))) {
+        return SavedResultCode::SAVED_RESULT_INVALID_PARAM;
+    }
+    unsigned int fileSize = 0;
+    if (UtilsFileStat(path, &fileSize) != 0 || fileSize == 0) {
+        return SavedResultCode::SAVED_RESULT_NO_DATA;
+    }
+    if (!IsCurrentSpillFile(path)) {
+        // left by an earlier boot, the bundle may have been updated since
+        (void) UtilsFileDelete(path);
+        return SavedResultCode::SAVED_RESULT_NO_DATA;
+    }
+    char *pathCopy = Utils::Strdup(path);
+    if (pathCopy == nullptr) {
+        return SavedResultCode::SAVED_RESULT_ALLOC_ERROR;
+    }
+    Reset();
+    spillPath = pathCopy;
+    keepSpillFile = false;
+    return SavedResultCode::SAVED_RESULT_OK;
+#else
+    (void) bundleName;
+    return SavedResultCode::SAVED_RESULT_NO_DATA;
+#endif
+}
+
+SavedResultCode AbilitySavedData::Restore()
+{
+    if (packedData != nullptr) {
+        SavedResultCode result = Unpack(packedData, packedDataSize);
+        if (result == SavedResultCode::SAVED_RESULT_OK) {
+            AdapterFree(packedData);
+            packedDataSize = 0;
+        }
+        return result;
+    }
+    if (spillPath != nullptr) {
+        return LoadSpillFile();
+    }
+    return (savedData == nullptr && userSavedData == nullptr) ? SavedResultCode::SAVED_RESULT_NO_DATA :
+        SavedResultCode::SAVED_RESULT_OK;
+}
+
+void AbilitySavedData::Persist()
+{
+    keepSpillFile = true;
+}
+
+uint32_t AbilitySavedData::GetResidentSize() const
+{
+    if (packedData != nullptr) {
+        return packedDataSize;
+    }
+    uint32_t size = 0;
+    if (savedData != nullptr) {
+        size += savedDataSize;
+    }
+    if (userSavedData != nullptr) {
+        size += userSavedDataSize;
+    }
+    return size;
+}
+
+SavedResultCode AbilitySavedData::Unpack(const void *image, uint16_t imageSize)
+{
+    SavedDataImageHeader header = {};
+    if (imageSize < sizeof(header) || memcpy_s(&header, sizeof(header), image, sizeof(header)) != EOK) {
+        return SavedResultCode::SAVED_RESULT_INVALID_PARAM;
+    }
+    uint32_t rawSize = header.savedDataSize + header.userSavedDataSize;
+    if (header.savedDataSize > SAVED_DATA_LIMIT || header.userSavedDataSize > SAVED_DATA_LIMIT ||
+        header.payloadSize != imageSize - sizeof(header) || rawSize == 0) {
+        return SavedResultCode::SAVED_RESULT_INVALID_PARAM;
+    }
+    const uint8_t *payload = static_cast<const uint8_t *>(image) + sizeof(header);
+    const uint8_t *raw = payload;
+    uint8_t *expanded = nullptr;
+    if (header.compressed != 0) {
+        expanded = static_cast<uint8_t *>(AdapterMalloc(rawSize));
+        if (expanded == nullptr) {
+            return SavedResultCode::SAVED_RESULT_ALLOC_ERROR;
+        }
+        if (!DecompressBlock(payload, header.payloadSize, expanded, rawSize)) {
+            AdapterFree(expanded);
+            return SavedResultCode::SAVED_RESULT_INVALID_PARAM;
+        }
+        raw = expanded;
+    } else if (header.payloadSize != rawSize) {
+        return SavedResultCode::SAVED_RESULT_INVALID_PARAM;
+    }
+    if (Checksum(raw, rawSize) != header.checksum) {
+        AdapterFree(expanded);
+        return SavedResultCode::SAVED_RESULT_INVALID_PARAM;
+    }
+    void *saved = (header.savedDataSize == 0) ? nullptr : Utils::Memdup(raw, header.savedDataSize);
+    void *userSaved = (header.userSavedDataSize == 0) ? nullptr :
+        Utils::Memdup(raw + header.savedDataSize, header.userSavedDataSize);
+    AdapterFree(expanded);
+    if ((header.savedDataSize > 0 && saved == nullptr) || (header.userSavedDataSize > 0 && userSaved == nullptr)) {
+        AdapterFree(saved);
+        AdapterFree(userSaved);
+        return SavedResultCode::SAVED_RESULT_ALLOC_ERROR;
+    }
+    AdapterFree(savedData);
+    AdapterFree(userSavedData);
+    savedData = saved;
+    userSavedData = userSaved;
+    savedDataSize = header.savedDataSize;
+    userSavedDataSize = header.userSavedDataSize;
+    return SavedResultCode::SAVED_RESULT_OK;
+}
+
+SavedResultCode AbilitySavedData::LoadSpillFile()
+{
+#ifdef ABILITY_SAVED_DATA_DIR
+    unsigned int fileSize = 0;
+    if (UtilsFileStat(spillPath, &fileSize) != 0 ||
+        fileSize < sizeof(SpillFileHeader) + sizeof(SavedDataImageHeader) ||
+        fileSize > sizeof(SpillFileHeader) + MAX_IMAGE_SIZE) {
+        ReleaseSpillFile(true);
+        return SavedResultCode::SAVED_RESULT_NO_DATA;
+    }
+    auto image = static_cast<char *>(AdapterMalloc(fileSize));
+    if (image == nullptr) {
+        return SavedResultCode::SAVED_RESULT_ALLOC_ERROR;
+    }
+    int32_t fd = UtilsFileOpen(spillPath, O_RDONLY_FS, 0);
+    int32_t readSize = (fd < 0) ? -1 : UtilsFileRead(fd, image, fileSize);
+    if (fd >= 0) {
+        (void) UtilsFileClose(fd);
+    }
+    SavedResultCode result = SavedResultCode::SAVED_RESULT_NO_DATA;
+    if (readSize == static_cast<int32_t>(fileSize)) {
+        result = Unpack(image + sizeof(SpillFileHeader), static_cast<uint16_t>(fileSize - sizeof(SpillFileHeader)));
+    }
+    AdapterFree(image);
+    if (result != SavedResultCode::SAVED_RESULT_ALLOC_ERROR) {
+        // the data is in RAM now, or the file is unusable
+        ReleaseSpillFile(true);
+    }
+    return result;
+#else
+    ReleaseSpillFile(false);
+    return SavedResultCode::SAVED_RESULT_NO_DATA;
+#endif
+}
+
+void AbilitySavedData::ReleaseSpillFile(bool remove)
+{
+    if (spillPath == nullptr) {
+        return;
+    }
+#ifdef ABILITY_SAVED_DATA_DIR
+    if (remove) {
+        (void) UtilsFileDelete(spillPath);
+    }
+#else
+    (void) remove;
+#endif
+    AdapterFree(spillPath);
+    keepSpillFile = false;
+}
+
 } // namespace AbilitySlite
 } // namespace OHOS
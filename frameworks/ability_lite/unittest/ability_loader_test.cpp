@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ability_loader.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+    // enough names that the hash leaves several of them in one bucket, so those buckets need a seed of their own
+    constexpr int MANY_NAME_COUNT = 512;
+
+    class LoaderTestAbility : public Ability {
+    public:
+        explicit LoaderTestAbility(int tag) : tag_(tag) {}
+        ~LoaderTestAbility() override = default;
+
+        int tag_;
+    };
+
+    Ability *CreateFirst()
+    {
+        return new LoaderTestAbility(1);
+    }
+
+    Ability *CreateSecond()
+    {
+        return new LoaderTestAbility(2);
+    }
+
+    class AbilityLoaderTest : public testing::Test {
+    public:
+        void TearDown() override
+        {
+            for (auto section : sections_) {
+                AbilityLoader::GetInstance().RemoveAbilitySection(*section);
+            }
+            sections_.clear();
+        }
+
+        void Add(AbilitySection &section)
+        {
+            AbilityLoader::GetInstance().AddAbilitySection(section);
+            sections_.push_back(&section);
+        }
+
+        // returns the tag of the ability created for name, or 0 if there is none
+        static int Lookup(const char *name)
+        {
+            Ability *ability = AbilityLoader::GetInstance().GetAbilityByName(name);
+            if (ability == nullptr) {
+                return 0;
+            }
+            int tag = static_cast<LoaderTestAbility *>(ability)->tag_;
+            delete ability;
+            return tag;
+        }
+
+        std::vector<AbilitySection *> sections_;
+        // sections stay linked until TearDown, so they live in the fixture
+        std::vector<std::string> manyNames_;
+        std::vector<AbilityEntry> manyEntries_;
+        AbilitySection manySections_[3] {};
+    };
+
+    /**
+     * @tc.name: AbilityLoader001
+     * @tc.desc: test lookups in an empty table, also once every section was removed again.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilityLoaderTest, AbilityLoader001, TestSize.Level0)
+    {
+        EXPECT_EQ(Lookup("MissingAbility"), 0);
+        static const AbilityEntry entries[] = { { "FirstAbility", CreateFirst } };
+        static AbilitySection emptySection = { entries, entries, nullptr };
+        Add(emptySection);
+        EXPECT_EQ(Lookup("FirstAbility"), 0);
+
+        static AbilitySection section = { entries, entries + 1, nullptr };
+        Add(section);
+        EXPECT_EQ(Lookup("FirstAbility"), 1);
+        AbilityLoader::GetInstance().RemoveAbilitySection(section);
+        EXPECT_EQ(Lookup("FirstAbility"), 0);
+        EXPECT_EQ(Lookup(""), 0);
+    }
+
+    /**
+     * @tc.name: AbilityLoader002
+     * @tc.desc: test the first section registering a name wins, and the next one takes over once it is removed.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilityLoaderTest, AbilityLoader002, TestSize.Level0)
+    {
+        static const AbilityEntry firstEntries[] = {
+            { "SharedAbility", CreateFirst }, { "FirstAbility", CreateFirst }
+        };
+        static const AbilityEntry secondEntries[] = {
+            { "SecondAbility", CreateSecond }, { "SharedAbility", CreateSecond }
+        };
+        static AbilitySection firstSection = { firstEntries, firstEntries + 2, nullptr };
+        static AbilitySection secondSection = { secondEntries, secondEntries + 2, nullptr };
+        Add(firstSection);
+        Add(secondSection);
+        EXPECT_EQ(Lookup("SharedAbility"), 1);
+        EXPECT_EQ(Lookup("FirstAbility"), 1);
+        EXPECT_EQ(Lookup("SecondAbility"), 2);
+
+        AbilityLoader::GetInstance().RemoveAbilitySection(firstSection);
+        EXPECT_EQ(Lookup("SharedAbility"), 2);
+        EXPECT_EQ(Lookup("FirstAbility"), 0);
+    }
+
+    /**
+     * @tc.name: AbilityLoader003
+     * @tc.desc: test removing a section in the middle of the list and hashing many names.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilityLoaderTest, AbilityLoader003, TestSize.Level0)
+    {
+        for (int i = 0; i < MANY_NAME_COUNT; i++) {
+            manyNames_.push_back("Ability" + std::to_string(i));
+        }
+        for (const auto &name : manyNames_) {
+            manyEntries_.push_back({ name.c_str(), (manyEntries_.size() % 2 == 0) ? CreateFirst : CreateSecond });
+        }
+        // three sections, the middle one is removed
+        const int third = MANY_NAME_COUNT / 3;
+        const AbilityEntry *entries = manyEntries_.data();
+        manySections_[0] = { entries, entries + third, nullptr };
+        manySections_[1] = { entries + third, entries + 2 * third, nullptr };
+        manySections_[2] = { entries + 2 * third, entries + MANY_NAME_COUNT, nullptr };
+        for (auto &section : manySections_) {
+            Add(section);
+        }
+        for (int i = 0; i < MANY_NAME_COUNT; i++) {
+            EXPECT_EQ(Lookup(manyNames_[i].c_str()), (i % 2 == 0) ? 1 : 2);
+        }
+        EXPECT_EQ(Lookup("Ability"), 0);
+        EXPECT_EQ(Lookup("Ability512"), 0);
+
+        AbilityLoader::GetInstance().RemoveAbilitySection(manySections_[1]);
+        for (int i = 0; i < MANY_NAME_COUNT; i++) {
+            bool removed = (i >= third) && (i < 2 * third);
+            EXPECT_EQ(Lookup(manyNames_[i].c_str()), removed ? 0 : ((i % 2 == 0) ? 1 : 2));
+        }
+    }
+} // namespace OHOS
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <dlfcn.h>
+#include <fstream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ability_module_loader.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+    const std::string SRC_PATH = "/data/AbilityModuleLoaderTest";
+
+    class AbilityModuleLoaderTest : public testing::Test {
+    public:
+        void SetUp() override
+        {
+            (void)mkdir(SRC_PATH.c_str(), S_IRWXU);
+        }
+
+        void TearDown() override
+        {
+            AbilityModuleLoader::GetInstance().SetModules(SRC_PATH, {});
+            for (const auto &module : { "entry", "feature", "broken" }) {
+                std::string moduleDir = SRC_PATH + "/" + module;
+                (void)unlink((moduleDir + "/lib" + module + ".so").c_str());
+                (void)rmdir(moduleDir.c_str());
+            }
+            (void)unlink((SRC_PATH + "/module_classes.list").c_str());
+            (void)rmdir(SRC_PATH.c_str());
+        }
+
+        // any library the process already uses loads without side effects
+        static void AddModule(const std::string &module)
+        {
+            Dl_info info = {};
+            ASSERT_NE(dladdr(reinterpret_cast<void *>(&strlen), &info), 0);
+            std::string moduleDir = SRC_PATH + "/" + module;
+            (void)mkdir(moduleDir.c_str(), S_IRWXU);
+            ASSERT_EQ(symlink(info.dli_fname, (moduleDir + "/lib" + module + ".so").c_str()), 0);
+        }
+
+        static void WriteManifest(const std::string &content)
+        {
+            std::ofstream manifest(SRC_PATH + "/module_classes.list");
+            manifest << content;
+        }
+    };
+
+    /**
+     * @tc.name: AbilityModuleLoader001
+     * @tc.desc: test a class listed in the manifest only opens its module, others are searched in module order.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilityModuleLoaderTest, AbilityModuleLoader001, TestSize.Level0)
+    {
+        AddModule("entry");
+        AddModule("feature");
+        WriteManifest("# class module\n\nFeatureAbility feature\nMalformedLine\n");
+        AbilityModuleLoader &moduleLoader = AbilityModuleLoader::GetInstance();
+        moduleLoader.SetModules(SRC_PATH, { "entry", "feature" });
+        EXPECT_TRUE(moduleLoader.HasManifest());
+
+        EXPECT_TRUE(moduleLoader.LoadModuleOf("FeatureAbility", []() { return true; }));
+        EXPECT_FALSE(moduleLoader.IsLoaded("entry"));
+        EXPECT_TRUE(moduleLoader.IsLoaded("feature"));
+
+        moduleLoader.UnloadAll();
+        std::vector<bool> entryLoaded;
+        EXPECT_FALSE(moduleLoader.LoadModuleOf("MalformedLine", [&]() {
+            entryLoaded.push_back(moduleLoader.IsLoaded("entry") && !moduleLoader.IsLoaded("feature"));
+            return false;
+        }));
+        ASSERT_EQ(entryLoaded.size(), 2);
+        EXPECT_TRUE(entryLoaded[0]);
+        EXPECT_FALSE(entryLoaded[1]);
+    }
+
+    /**
+     * @tc.name: AbilityModuleLoader002
+     * @tc.desc: test an app without a manifest loads all modules, fails on a library that can not be opened, and opens
+     *          it again on the next load.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilityModuleLoaderTest, AbilityModuleLoader002, TestSize.Level0)
+    {
+        AddModule("entry");
+        AbilityModuleLoader &moduleLoader = AbilityModuleLoader::GetInstance();
+        moduleLoader.SetModules(SRC_PATH, { "entry", "feature" });
+        EXPECT_FALSE(moduleLoader.HasManifest());
+        EXPECT_TRUE(moduleLoader.LoadAll());
+        EXPECT_TRUE(moduleLoader.IsLoaded("entry"));
+        EXPECT_FALSE(moduleLoader.IsLoaded("feature"));
+
+        std::string brokenDir = SRC_PATH + "/broken";
+        (void)mkdir(brokenDir.c_str(), S_IRWXU);
+        std::ofstream(brokenDir + "/libbroken.so") << "not a library";
+        moduleLoader.SetModules(SRC_PATH, { "entry", "broken" });
+        EXPECT_FALSE(moduleLoader.LoadAll());
+        EXPECT_FALSE(moduleLoader.IsLoaded("broken"));
+
+        (void)unlink((brokenDir + "/libbroken.so").c_str());
+        AddModule("broken");
+        EXPECT_TRUE(moduleLoader.LoadAll());
+        EXPECT_TRUE(moduleLoader.IsLoaded("broken"));
+    }
+} // namespace OHOS
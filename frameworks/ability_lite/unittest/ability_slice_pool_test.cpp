@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ability_loader.h"
+#include "ability_slice.h"
+#include "ability_slice_pool.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+    // slices of this class still alive, so a test can tell the pool destroyed one
+    static int g_liveSlices = 0;
+
+    class PoolTestSlice : public AbilitySlice {
+    public:
+        PoolTestSlice()
+        {
+            g_liveSlices++;
+        }
+
+        ~PoolTestSlice() override
+        {
+            g_liveSlices--;
+        }
+    };
+
+    class AbilitySlicePoolTest : public testing::Test {
+    public:
+        static void SetUpTestCase()
+        {
+            AbilityLoader::GetInstance().RegisterAbilitySlice("PoolTestSlice", [] {
+                return static_cast<AbilitySlice *>(new PoolTestSlice());
+            });
+            AbilityLoader::GetInstance().RegisterAbilitySlice("OtherPoolTestSlice", [] {
+                return static_cast<AbilitySlice *>(new PoolTestSlice());
+            });
+        }
+
+        void TearDown() override
+        {
+            AbilitySlicePool::GetInstance().Clear();
+        }
+    };
+
+    /**
+     * @tc.name: AbilitySlicePool001
+     * @tc.desc: test acquiring slices by name, and destroying the ones that are not reusable.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilitySlicePoolTest, AbilitySlicePool001, TestSize.Level0)
+    {
+        AbilitySlicePool &slicePool = AbilitySlicePool::GetInstance();
+        EXPECT_EQ(slicePool.Acquire("MissingPoolTestSlice"), nullptr);
+
+        AbilitySlice *first = slicePool.Acquire("PoolTestSlice");
+        AbilitySlice *second = slicePool.Acquire("PoolTestSlice");
+        ASSERT_NE(first, nullptr);
+        ASSERT_NE(second, nullptr);
+        EXPECT_NE(first, second);
+        EXPECT_TRUE(slicePool.IsNamed(first));
+        EXPECT_EQ(g_liveSlices, 2);
+
+        EXPECT_FALSE(slicePool.Keep(first));
+        slicePool.Recycle(first);
+        slicePool.Recycle(second);
+        EXPECT_EQ(g_liveSlices, 0);
+
+        // a slice the app created itself is never taken, even if it is reusable
+        PoolTestSlice ownSlice;
+        ownSlice.SetReusable(true);
+        EXPECT_FALSE(slicePool.IsNamed(&ownSlice));
+        EXPECT_FALSE(slicePool.Keep(&ownSlice));
+    }
+
+    /**
+     * @tc.name: AbilitySlicePool002
+     * @tc.desc: test a recycled reusable slice is handed out again for its name only.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilitySlicePoolTest, AbilitySlicePool002, TestSize.Level0)
+    {
+        AbilitySlicePool &slicePool = AbilitySlicePool::GetInstance();
+        if (slicePool.GetCapacity() == 0) {
+            return;
+        }
+        AbilitySlice *slice = slicePool.Acquire("PoolTestSlice");
+        ASSERT_NE(slice, nullptr);
+        slice->SetReusable(true);
+        slicePool.Recycle(slice);
+        EXPECT_EQ(g_liveSlices, 1);
+
+        AbilitySlice *other = slicePool.Acquire("OtherPoolTestSlice");
+        EXPECT_NE(other, slice);
+        EXPECT_EQ(slicePool.Acquire("PoolTestSlice"), slice);
+        EXPECT_EQ(g_liveSlices, 2);
+
+        // turned off again, the slice is destroyed when it stops next
+        slice->SetReusable(false);
+        slicePool.Recycle(slice);
+        slicePool.Recycle(other);
+        EXPECT_EQ(g_liveSlices, 0);
+    }
+
+    /**
+     * @tc.name: AbilitySlicePool003
+     * @tc.desc: test the slice recycled longest ago is evicted once the pool is full.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilitySlicePoolTest, AbilitySlicePool003, TestSize.Level0)
+    {
+        AbilitySlicePool &slicePool = AbilitySlicePool::GetInstance();
+        uint32_t capacity = slicePool.GetCapacity();
+        std::vector<AbilitySlice *> slices;
+        for (uint32_t i = 0; i <= capacity; i++) {
+            AbilitySlice *slice = slicePool.Acquire("PoolTestSlice");
+            ASSERT_NE(slice, nullptr);
+            slice->SetReusable(true);
+            slices.push_back(slice);
+        }
+        for (auto slice : slices) {
+            slicePool.Recycle(slice);
+        }
+        EXPECT_EQ(g_liveSlices, static_cast<int>(capacity));
+
+        // the most recently recycled one comes back first, the oldest one was destroyed
+        if (capacity > 0) {
+            EXPECT_EQ(slicePool.Acquire("PoolTestSlice"), slices.back());
+            slicePool.Recycle(slices.back());
+        }
+        slicePool.Clear();
+        EXPECT_EQ(g_liveSlices, 0);
+    }
+}
@@ -16,6 +16,10 @@
 #ifndef OHOS_ABILITYMS_CLIENT_H
 #define OHOS_ABILITYMS_CLIENT_H
 
+#include <pthread.h>
+#include <sys/types.h>
+
+#include "ability_service_interface.h"
 #include "iproxy_client.h"
 #include "nocopyable.h"
 #include "want.h"
@@ -35,12 +39,36 @@ public:
 
     int SchedulerLifecycleDone(uint64_t token, int state) const;
 
+    /*
+     * Coalescing mode of SchedulerLifecycleDone: the result is held back until FlushLifecycleDone, which reports all
+     * held results in one request. Returns true if nothing was held before, so the caller knows to schedule a flush.
+     */
+    bool QueueLifecycleDone(uint64_t token, int state) const;
+
+    int FlushLifecycleDone() const;
+
     int ScheduleAms(const Want *want, uint64_t token, const SvcIdentity *sid, int commandType) const;
 
+    /* the uid of the AMS process, known from app init, lets wants with large data be sent to it */
+    void SetAmsUid(uid_t amsUid);
+
 private:
     AbilityMsClient() = default;
 
+    struct LifecycleDone {
+        uint64_t token;
+        int32_t state;
+    };
+
+    int SendLifecycleDone(const LifecycleDone *batch, uint32_t count) const;
+
     IClientProxy *amsProxy_ { nullptr };
+    mutable pthread_mutex_t flushDoneMutex_ = PTHREAD_MUTEX_INITIALIZER;
+    mutable pthread_mutex_t pendingDoneMutex_ = PTHREAD_MUTEX_INITIALIZER;
+    mutable LifecycleDone pendingDone_[MAX_TRANSACTION_BATCH_SIZE] {};
+    mutable uint32_t pendingDoneNum_ { 0 };
+    uid_t amsUid_ { 0 };
+    bool isAmsUidKnown_ { false };
 
     DISALLOW_COPY_AND_MOVE(AbilityMsClient);
 };
@@ -17,6 +17,7 @@
 #define OHOS_ABILITY_SLITE_ABILITYMS_SLITE_CLIENT_H
 
 #include "ability_service_interface.h"
+#include "ability_eviction_policy.h"
 #include "ability_record_observer.h"
 #include "mission_info.h"
 #include "nocopyable.h"
@@ -62,8 +63,14 @@ public:
     int32_t AddAbilityRecordObserver(AbilityRecordObserver *observer);
     int32_t RemoveAbilityRecordObserver(AbilityRecordObserver *observer);
 
+    int32_t SetAbilityEvictionPolicy(AbilityEvictionPolicy *policy);
+
+    int32_t NotifyAbilityThreadDrained() const;
+
     MissionInfoList *GetMissionInfos(uint32_t maxNum) const;
 
+    uint32_t DumpOperationStat(char *buffer, uint32_t size) const;
+
 private:
     AbilityMsClient() = default;
 
@@ -71,11 +71,69 @@ int AbilityMsClient::SchedulerLifecycleDone(uint64_t token, int state) const
     return amsProxy_->Invoke(amsProxy_, ABILITY_TRANSACTION_DONE, &req, nullptr, Callback);
 }
 
+bool AbilityMsClient::QueueLifecycleDone(uint64_t token, int state) const
+{
+    (void) pthread_mutex_lock(&pendingDoneMutex_);
+    while (pendingDoneNum_ == MAX_TRANSACTION_BATCH_SIZE) {
+        (void) pthread_mutex_unlock(&pendingDoneMutex_);
+        (void) FlushLifecycleDone();
+        (void) pthread_mutex_lock(&pendingDoneMutex_);
+    }
+    bool first = (pendingDoneNum_ == 0);
+    pendingDone_[pendingDoneNum_].token = token;
+    pendingDone_[pendingDoneNum_].state = state;
+    pendingDoneNum_++;
+    (void) pthread_mutex_unlock(&pendingDoneMutex_);
+    return first;
+}
+
+int AbilityMsClient::FlushLifecycleDone() const
+{
+    // the flush mutex keeps batches in order, the pending mutex is not held during the request so that queueing a
+    // result never waits for AMS
+    (void) pthread_mutex_lock(&flushDoneMutex_);
+    LifecycleDone batch[MAX_TRANSACTION_BATCH_SIZE];
+    (void) pthread_mutex_lock(&pendingDoneMutex_);
+    uint32_t count = pendingDoneNum_;
+    for (uint32_t i = 0; i < count; i++) {
+        batch[i] = pendingDone_[i];
+    }
+    pendingDoneNum_ = 0;
+    (void) pthread_mutex_unlock(&pendingDoneMutex_);
+    int ret = SendLifecycleDone(batch, count);
+    (void) pthread_mutex_unlock(&flushDoneMutex_);
+    return ret;
+}
+
+int AbilityMsClient::SendLifecycleDone(const LifecycleDone *batch, uint32_t count) const
+{
+    if (count == 0) {
+        return ERR_OK;
+    }
+    if (count == 1) {
+        return SchedulerLifecycleDone(batch[0].token, batch[0].state);
+    }
+    if (amsProxy_ == nullptr) {
+        return PARAM_NULL_ERROR;
+    }
+    IpcIo req;
+    char data[MAX_IO_SIZE];
+    IpcIoInit(&req, data, MAX_IO_SIZE, 0);
+    WriteUint32(&req, count);
+    for (uint32_t i = 0; i < count; i++) {
+        WriteUint64(&req, batch[i].token);
+        WriteInt32(&req, batch[i].state);
+    }
+    return amsProxy_->Invoke(amsProxy_, ABILITY_TRANSACTION_DONE_BATCH, &req, nullptr, Callback);
+}
+
 int AbilityMsClient::ScheduleAms(const Want *want, uint64_t token, const SvcIdentity *sid, int commandType) const
 {
     if (amsProxy_ == nullptr) {
         return PARAM_NULL_ERROR;
     }
+    // held lifecycle results go first, AMS must not see a request that depends on a state it was not told about
+    (void) FlushLifecycleDone();
     IpcIo req;
     char data[MAX_IO_SIZE];
     IpcIoInit(&req, data, MAX_IO_SIZE, 3);
@@ -94,9 +152,18 @@ int AbilityMsClient::ScheduleAms(const Want *want, uint64_t token, const SvcIden
         }
 #endif
     }
-    if (want != nullptr && !SerializeWant(&req, want)) {
-        return SERIALIZE_ERROR;
+    if (want != nullptr) {
+        bool ret = isAmsUidKnown_ ? SerializeWantTo(&req, want, amsUid_) : SerializeWant(&req, want);
+        if (!ret) {
+            return SERIALIZE_ERROR;
+        }
     }
     return amsProxy_->Invoke(amsProxy_, commandType, &req, nullptr, Callback);
 }
+
+void AbilityMsClient::SetAmsUid(uid_t amsUid)
+{
+    amsUid_ = amsUid;
+    isAmsUidKnown_ = true;
+}
 } //  namespace OHOS
@@ -34,6 +34,11 @@ void AbilityManagerClient::RemoveAbilityRecordObserver(AbilityRecordObserver *ob
     AbilityMsClient::GetInstance().RemoveAbilityRecordObserver(observer);
 }
 
+void AbilityManagerClient::SetAbilityEvictionPolicy(AbilityEvictionPolicy *policy)
+{
+    AbilityMsClient::GetInstance().SetAbilityEvictionPolicy(policy);
+}
+
 int32_t AbilityManagerClient::TerminateAll(const char* excludedBundleName)
 {
     return AbilityMsClient::GetInstance().TerminateAll(excludedBundleName);
@@ -15,6 +15,8 @@
 
 #include "ability_manager_inner.h"
 #include "abilityms_slite_client.h"
+#include "ability_mem_pool.h"
+#include "ability_trace.h"
 
 StartCheckFunc CALLBACKFUNC = nullptr;
 bool cleanAbilityDataFlag = false;
@@ -55,4 +57,24 @@ bool GetCleanAbilityDataFlag()
 {
     return cleanAbilityDataFlag;
 }
+
+uint32_t DumpAbilityTrace(char *buffer, uint32_t size)
+{
+    return OHOS::AbilityTrace::GetInstance().Dump(buffer, size);
+}
+
+uint32_t DumpAbilityOperationStat(char *buffer, uint32_t size)
+{
+    return OHOS::AbilitySlite::AbilityMsClient::GetInstance().DumpOperationStat(buffer, size);
+}
+
+uint32_t ExportAbilityTrace(char *buffer, uint32_t size)
+{
+    return OHOS::AbilityTrace::GetInstance().ExportChromeTrace(buffer, size);
+}
+
+uint32_t DumpAbilityMemPool(char *buffer, uint32_t size)
+{
+    return OHOS::AbilityMemPool::GetInstance().Dump(buffer, size);
+}
 }
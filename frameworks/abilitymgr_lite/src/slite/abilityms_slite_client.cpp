@@ -16,6 +16,7 @@
 #include "abilityms_slite_client.h"
 
 #include "ability_errors.h"
+#include "ability_mem_pool.h"
 #include "abilityms_log.h"
 #include "adapter.h"
 #include "cmsis_os2.h"
@@ -78,22 +79,23 @@ int32_t AbilityMsClient::StartAbility(const Want *want) const
     }
 
     // The data and info will be freed in the service
-    auto *data = static_cast<StartAbilityData *>(AdapterMalloc(sizeof(StartAbilityData)));
+    AbilityMemPool &pool = AbilityMemPool::GetInstance();
+    auto *data = static_cast<StartAbilityData *>(pool.Alloc(sizeof(StartAbilityData)));
     if (data == nullptr) {
         return MEMORY_MALLOC_ERROR;
     }
-    Want *info = static_cast<Want *>(AdapterMalloc(sizeof(Want)));
+    Want *info = static_cast<Want *>(pool.Alloc(sizeof(Want)));
     if (info == nullptr) {
+        pool.Free(data);
         return MEMORY_MALLOC_ERROR;
     }
-    info->element = nullptr;
+    info->element = pool.CopyElement(*(want->element));
     info->data = nullptr;
     info->dataLength = 0;
     info->appPath = nullptr;
     info->mission = want->mission;
     info->actions = nullptr;
     info->entities = nullptr;
-    SetWantElement(info, *(want->element));
     if (want->data != nullptr) {
         HILOG_INFO(HILOG_MODULE_APP, "start ability with input data");
         SetWantData(info, want->data, want->dataLength);
@@ -144,7 +146,7 @@ int32_t AbilityMsClient::TerminateAll(const char* excludedBundleName) const
     }
     void *data = nullptr;
     if (excludedBundleName != nullptr) {
-        data = Utils::Strdup(excludedBundleName);
+        data = AbilityMemPool::GetInstance().Strdup(excludedBundleName);
     }
     Request request = {
         .msgId = TERMINATE_ALL,
@@ -197,17 +199,19 @@ int32_t AbilityMsClient::ForceStop(const char *bundleName) const
     if (identity_ == nullptr) {
         return PARAM_CHECK_ERROR;
     }
-    Want *want = static_cast<Want *>(AdapterMalloc(sizeof(Want)));
+    AbilityMemPool &pool = AbilityMemPool::GetInstance();
+    Want *want = static_cast<Want *>(pool.Alloc(sizeof(Want)));
     if (want == nullptr) {
         return MEMORY_MALLOC_ERROR;
     }
-    want->element = reinterpret_cast<ElementName *>(AdapterMalloc(sizeof(ElementName)));
+    want->element = static_cast<ElementName *>(pool.Alloc(sizeof(ElementName)));
     if (want->element == nullptr) {
+        pool.Free(want);
         return MEMORY_MALLOC_ERROR;
     }
     HILOG_INFO(HILOG_MODULE_APP, "ForceStop with bundleName");
     want->element->deviceId = nullptr;
-    want->element->bundleName = Utils::Strdup(bundleName);
+    want->element->bundleName = pool.Strdup(bundleName);
     want->element->abilityName = nullptr;
     want->data = nullptr;
     want->dataLength = 0;
@@ -231,15 +235,17 @@ int32_t AbilityMsClient::ForceStop(const Want *want) const
     if (want == nullptr || want->element == nullptr || want->element->bundleName == nullptr) {
         return PARAM_CHECK_ERROR;
     }
-    Want *info = static_cast<Want *>(AdapterMalloc(sizeof(Want)));
+    Want *info = static_cast<Want *>(AbilityMemPool::GetInstance().Alloc(sizeof(Want)));
     if (info == nullptr) {
         return MEMORY_MALLOC_ERROR;
     }
-    info->element = nullptr;
+    info->element = AbilityMemPool::GetInstance().CopyElement(*(want->element));
     info->data = nullptr;
     info->dataLength = 0;
     info->appPath = nullptr;
-    SetWantElement(info, *(want->element));
+    info->mission = want->mission;
+    info->actions = nullptr;
+    info->entities = nullptr;
     SetWantData(info, want->data, want->dataLength);
     if (want->data != nullptr) {
         HILOG_INFO(HILOG_MODULE_APP, "ForceStop with data");
@@ -284,6 +290,36 @@ int32_t AbilityMsClient::RemoveAbilityRecordObserver(AbilityRecordObserver *obse
     return SendRequestToAms(request);
 }
 
+int32_t AbilityMsClient::SetAbilityEvictionPolicy(AbilityEvictionPolicy *policy)
+{
+    if (identity_ == nullptr) {
+        return PARAM_CHECK_ERROR;
+    }
+    Request request = {
+        .msgId = SET_ABILITY_EVICTION_POLICY,
+        .len = 0,
+        .data = nullptr,
+        .msgValue = reinterpret_cast<uint32>(policy),
+    };
+
+    return SendRequestToAms(request);
+}
+
+int32_t AbilityMsClient::NotifyAbilityThreadDrained() const
+{
+    if (identity_ == nullptr) {
+        return PARAM_CHECK_ERROR;
+    }
+    Request request = {
+        .msgId = ABILITY_THREAD_DRAINED,
+        .len = 0,
+        .data = nullptr,
+        .msgValue = 0,
+    };
+
+    return SendRequestToAms(request);
+}
+
 MissionInfoList *AbilityMsClient::GetMissionInfos(uint32_t maxNum) const
 {
     if (!Initialize()) {
@@ -292,6 +328,14 @@ MissionInfoList *AbilityMsClient::GetMissionInfos(uint32_t maxNum) const
     return static_cast<MissionInfoList *>(amsProxy_->GetMissionInfos(maxNum));
 }
 
+uint32_t AbilityMsClient::DumpOperationStat(char *buffer, uint32_t size) const
+{
+    if (!Initialize()) {
+        return 0;
+    }
+    return amsProxy_->DumpOperationStat(buffer, size);
+}
+
 void AbilityMsClient::SetServiceIdentity(const Identity *identity)
 {
     identity_ = identity;
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_WANT_SHARED_DATA_H
+#define OHOS_WANT_SHARED_DATA_H
+
+#include <cstdint>
+#include <sys/types.h>
+
+namespace OHOS {
+/**
+ * Want data larger than the inline IPC limit travels in a shared memory segment: SerializeWantTo writes the segment
+ * handle instead of the bytes and DeserializeWant maps the segment and points want->data into it.
+ *
+ * A segment is created owner-only and then handed to the uid of its single receiver, read-only. The receiver only
+ * maps a handle that was created by the calling uid and handed to itself, and marks the segment removed as soon as
+ * it is mapped, so the kernel frees it with the last mapping, also when the receiver crashes. Wants in the receiving
+ * process pointing at the same payload share the mapping, the holds are counted in that process only, and forwarding
+ * such a Want copies the payload into a new segment for the next receiver. Segments whose message is never delivered,
+ * because the send failed or the creator died, are reclaimed by the next Create of their creator or receiver uid once
+ * their header shows they hold want data.
+ */
+class WantSharedData {
+public:
+    /* returns true if data points to the payload of a segment mapped by this process */
+    static bool IsShared(const void *data);
+
+    /* places a copy of data in a new segment handed to receiverUid, the handle must be attached once by it */
+    static bool Create(const void *data, uint16_t length, uid_t receiverUid, int32_t &handle);
+
+    /* maps the segment of handle if senderUid created it for this process, returns the read-only payload */
+    static void *Attach(int32_t handle, uint16_t length, uid_t senderUid);
+
+    /* takes one more hold on the mapping for another Want pointing at the same payload */
+    static void *Ref(void *data);
+
+    /* drops one hold if data is shared, otherwise frees it like AdapterFree */
+    static void Release(void *data);
+
+    /* removes a created segment whose message will not be delivered */
+    static void ReleaseHandle(int32_t handle);
+};
+} // namespace OHOS
+#endif // OHOS_WANT_SHARED_DATA_H
@@ -18,14 +18,9 @@
 
 #include "want.h"
 
-typedef struct {
-    uint8_t type = 0;
-    void *entity = nullptr;
-    uint8_t totalLen = 0;
-} Tlv;
-
 #ifdef OHOS_APPEXECFWK_BMS_BUNDLEMANAGER
 #include <serializer.h>
+#include <sys/types.h>
 #endif
 #ifdef __cplusplus
 #if __cplusplus
@@ -34,6 +29,8 @@ extern "C" {
 #endif // __cplusplus
 #ifdef OHOS_APPEXECFWK_BMS_BUNDLEMANAGER
 bool SerializeWant(IpcIo *io, const Want *want);
+/* also sends data over the inline limit, in shared memory that only the process of receiverUid can map */
+bool SerializeWantTo(IpcIo *io, const Want *want, uid_t receiverUid);
 bool DeserializeWant(Want *want, IpcIo *io);
 #endif
 #ifdef __cplusplus
@@ -19,7 +19,9 @@
 #include <securec.h>
 #ifdef OHOS_APPEXECFWK_BMS_BUNDLEMANAGER
 #include <string>
+#include <unistd.h>
 #include "ipc_skeleton.h"
+#include "want_shared_data.h"
 #endif
 
 #include "log.h"
@@ -52,11 +54,29 @@ constexpr static char URI_SEPARATOR = ';';
 constexpr static int VALUE_NULL = 0;
 constexpr static int VALUE_OBJECT = 1;
 constexpr static int DATA_LENGTH = 2048;
+constexpr static int32_t INVALID_DATA_HANDLE = -1;
 #endif
 
-constexpr uint8_t INT_VALUE_TYPE = 6;
-constexpr uint8_t STRING_VALUE_TYPE = 13;
+constexpr uint8_t INT_VALUE_TYPE = WANT_PARAM_INT_TYPE;
+constexpr uint8_t STRING_VALUE_TYPE = WANT_PARAM_STRING_TYPE;
 constexpr uint8_t KEY_VALUE_PAIR_TYPE = 97;
+constexpr uint8_t TLV_HEADER_LENGTH = 2;
+constexpr uint8_t INT_VALUE_LENGTH = 4;
+constexpr uint8_t BITS_PER_BYTE = 8;
+constexpr uint16_t MIN_PARAM_INDEX_SLOTS = 8;
+constexpr uint16_t MAX_PARAM_INDEX_SLOTS = 0x8000;
+constexpr uint16_t EMPTY_PARAM_INDEX_SLOT = UINT16_MAX;
+constexpr uint32_t FNV_OFFSET_BASIS = 2166136261u;
+constexpr uint32_t FNV_PRIME = 16777619u;
+
+static void FreeWantData(void *data)
+{
+#ifdef OHOS_APPEXECFWK_BMS_BUNDLEMANAGER
+    OHOS::WantSharedData::Release(data);
+#else
+    AdapterFree(data);
+#endif
+}
 
 void ClearWant(Want *want)
 {
@@ -70,7 +90,7 @@ void ClearWant(Want *want)
     AdapterFree(want->sid);
 #endif
     AdapterFree(want->appPath);
-    AdapterFree(want->data);
+    FreeWantData(want->data);
 #ifndef OHOS_APPEXECFWK_BMS_BUNDLEMANAGER
     AdapterFree(want->actions);
     AdapterFree(want->entities);
@@ -95,151 +115,458 @@ bool SetWantElement(Want *want, ElementName element)
     return true;
 }
 
-Tlv *EncapTlv(uint8_t type, uint8_t length, const void *value, uint8_t valueLen)
+static uint16_t KeyValueTlvLength(uint8_t keyLen, uint8_t valueLen)
 {
-    void *entity = nullptr;
+    // the pair length is stored in one byte, so key and value tlvs together must fit in it
+    uint16_t pairLen = TLV_HEADER_LENGTH + keyLen + TLV_HEADER_LENGTH + valueLen;
+    if (pairLen > UINT8_MAX) {
+        return 0;
+    }
+    return TLV_HEADER_LENGTH + pairLen;
+}
 
-    // Tlv header can only has 2 bytes.
-    uint8_t totalLen = valueLen + 2;
-    entity = AdapterMalloc(totalLen);
-    if (entity == nullptr) {
-        return nullptr;
+static bool WriteKeyValueTlv(uint8_t *buffer, uint16_t bufferSize, const char *key, uint8_t keyLen,
+    uint8_t valueType, const void *value, uint8_t valueLen)
+{
+    uint16_t tlvLen = KeyValueTlvLength(keyLen, valueLen);
+    if (tlvLen == 0 || tlvLen > bufferSize) {
+        return false;
+    }
+    uint8_t *keyTlv = buffer + TLV_HEADER_LENGTH;
+    uint8_t *valueTlv = keyTlv + TLV_HEADER_LENGTH + keyLen;
+    buffer[0] = KEY_VALUE_PAIR_TYPE;
+    buffer[1] = static_cast<uint8_t>(tlvLen - TLV_HEADER_LENGTH);
+    keyTlv[0] = STRING_VALUE_TYPE;
+    keyTlv[1] = keyLen;
+    valueTlv[0] = valueType;
+    valueTlv[1] = valueLen;
+    if (memcpy_s(keyTlv + TLV_HEADER_LENGTH, keyLen, key, keyLen) != EOK ||
+        memcpy_s(valueTlv + TLV_HEADER_LENGTH, valueLen, value, valueLen) != EOK) {
+        return false;
     }
+    return true;
+}
 
-    if (memcpy_s((unsigned char *)entity, totalLen, &type, 1) != 0 ||
-        memcpy_s((unsigned char *)entity + 1, totalLen - 1, &length, 1) != 0 ||
-        memcpy_s((unsigned char *)entity + 2, valueLen, value, valueLen) != 0) {
-        AdapterFree(entity);
-        return nullptr;
+static bool EncodeIntValue(int32_t value, uint8_t *buffer)
+{
+    if (value < 0) {
+        HILOG_ERROR(HILOG_MODULE_APP, "SetIntParam value should be positive");
+        return false;
+    }
+    for (uint8_t i = 0; i < INT_VALUE_LENGTH; i++) {
+        buffer[i] = static_cast<uint8_t>(value >> (BITS_PER_BYTE * (INT_VALUE_LENGTH - 1 - i)));
     }
+    return true;
+}
 
-    Tlv *newTlv = reinterpret_cast<Tlv *>(AdapterMalloc(sizeof(Tlv)));
-    if (newTlv == nullptr) {
-        AdapterFree(entity);
-        return nullptr;
+static bool AppendKeyValueTlv(Want *want, const char *key, uint8_t keyLen, uint8_t valueType, const void *value,
+    uint8_t valueLen)
+{
+    if (want == nullptr || key == nullptr || value == nullptr) {
+        return false;
+    }
+    uint16_t tlvLen = KeyValueTlvLength(keyLen, valueLen);
+    uint16_t oldLen = (want->data == nullptr) ? 0 : want->dataLength;
+    if (tlvLen == 0 || oldLen > UINT16_MAX - tlvLen) {
+        return false;
+    }
+    uint16_t newLen = oldLen + tlvLen;
+    uint8_t *newData = reinterpret_cast<uint8_t *>(AdapterMalloc(newLen));
+    if (newData == nullptr) {
+        return false;
     }
-    
-    newTlv->type = type;
-    newTlv->entity = entity;
-    newTlv->totalLen = totalLen;
-    return newTlv;
+    if ((oldLen > 0 && memcpy_s(newData, newLen, want->data, oldLen) != EOK) ||
+        !WriteKeyValueTlv(newData + oldLen, tlvLen, key, keyLen, valueType, value, valueLen)) {
+        AdapterFree(newData);
+        return false;
+    }
+    FreeWantData(want->data);
+    want->data = newData;
+    want->dataLength = newLen;
+    return true;
 }
 
-void FreeTlvStruct(Tlv *tlv)
+bool SetIntParam(Want *want, const char *key, uint8_t keyLen, int32_t value)
 {
-    AdapterFree(tlv->entity);
-    AdapterFree(tlv);
+    if (keyLen <= 0) {
+        return false;
+    }
+    uint8_t intBuffer[INT_VALUE_LENGTH] = { 0 };
+    if (!EncodeIntValue(value, intBuffer)) {
+        return false;
+    }
+    return AppendKeyValueTlv(want, key, keyLen, INT_VALUE_TYPE, intBuffer, INT_VALUE_LENGTH);
 }
 
-Tlv *CombineKeyValueTlv(Tlv *keyTlv, Tlv *valueTlv)
+bool SetStrParam(Want *want, const char *key, uint8_t keyLen, const char *value, uint8_t valueLen)
 {
-    uint8_t newTlvValueLen = keyTlv->totalLen + valueTlv->totalLen;
-    void *newTlvValue = AdapterMalloc(newTlvValueLen);
-    if (newTlvValue == nullptr) {
-        return nullptr;
+    if (keyLen <= 0 || valueLen <= 0) {
+        return false;
     }
-    if (memcpy_s((unsigned char *)newTlvValue, keyTlv->totalLen, keyTlv->entity, keyTlv->totalLen) != 0 ||
-        memcpy_s((unsigned char *)newTlvValue + keyTlv->totalLen, valueTlv->totalLen,
-        valueTlv->entity, valueTlv->totalLen) != 0) {
-        AdapterFree(newTlvValue);
-        return nullptr;
+    return AppendKeyValueTlv(want, key, keyLen, STRING_VALUE_TYPE, value, valueLen);
+}
+
+static bool ReserveWantBuilder(WantBuilder *builder, uint16_t size)
+{
+    if (builder->length > UINT16_MAX - size) {
+        return false;
+    }
+    uint32_t required = builder->length + size;
+    if (builder->buffer != nullptr && required <= builder->capacity) {
+        return true;
+    }
+    uint32_t capacity = (builder->capacity > 0) ? builder->capacity : required;
+    while (capacity < required) {
+        capacity <<= 1;
+    }
+    if (capacity > UINT16_MAX) {
+        capacity = UINT16_MAX;
+    }
+    uint8_t *buffer = reinterpret_cast<uint8_t *>(AdapterMalloc(capacity));
+    if (buffer == nullptr) {
+        return false;
+    }
+    if (builder->length > 0 && memcpy_s(buffer, capacity, builder->buffer, builder->length) != EOK) {
+        AdapterFree(buffer);
+        return false;
     }
+    AdapterFree(builder->buffer);
+    builder->buffer = buffer;
+    builder->capacity = static_cast<uint16_t>(capacity);
+    return true;
+}
 
-    Tlv *newTlv = EncapTlv(KEY_VALUE_PAIR_TYPE, newTlvValueLen, newTlvValue, newTlvValueLen);
-    AdapterFree(newTlvValue);
-    return newTlv;
+static bool WantBuilderAddParam(WantBuilder *builder, const char *key, uint8_t keyLen, uint8_t valueType,
+    const void *value, uint8_t valueLen)
+{
+    if (builder == nullptr || key == nullptr || keyLen == 0 || value == nullptr) {
+        return false;
+    }
+    uint16_t tlvLen = KeyValueTlvLength(keyLen, valueLen);
+    if (tlvLen == 0 || !ReserveWantBuilder(builder, tlvLen)) {
+        return false;
+    }
+    if (!WriteKeyValueTlv(builder->buffer + builder->length, builder->capacity - builder->length, key, keyLen,
+        valueType, value, valueLen)) {
+        return false;
+    }
+    builder->length += tlvLen;
+    return true;
 }
 
-bool UpdateWantData(Want *want, Tlv *tlv)
+bool InitWantBuilder(WantBuilder *builder, uint16_t capacity)
 {
-    bool result = false;
-    if (want->data != nullptr) {
-        void *newWantData = AdapterMalloc(tlv->totalLen + want->dataLength);
-        if (newWantData == nullptr) {
-            return result;
-        }
-        if (memcpy_s(newWantData, want->dataLength, want->data, want->dataLength) != 0 ||
-            memcpy_s((unsigned char*)newWantData + want->dataLength, tlv->totalLen, tlv->entity, tlv->totalLen) != 0) {
-            AdapterFree(newWantData);
-            return result;
+    if (builder == nullptr) {
+        return false;
+    }
+    builder->buffer = nullptr;
+    builder->length = 0;
+    builder->capacity = 0;
+    if (capacity == 0) {
+        return true;
+    }
+    return ReserveWantBuilder(builder, capacity);
+}
+
+bool WantBuilderAddIntParam(WantBuilder *builder, const char *key, uint8_t keyLen, int32_t value)
+{
+    uint8_t intBuffer[INT_VALUE_LENGTH] = { 0 };
+    if (!EncodeIntValue(value, intBuffer)) {
+        return false;
+    }
+    return WantBuilderAddParam(builder, key, keyLen, INT_VALUE_TYPE, intBuffer, INT_VALUE_LENGTH);
+}
+
+bool WantBuilderAddStrParam(WantBuilder *builder, const char *key, uint8_t keyLen, const char *value,
+    uint8_t valueLen)
+{
+    if (valueLen == 0) {
+        return false;
+    }
+    return WantBuilderAddParam(builder, key, keyLen, STRING_VALUE_TYPE, value, valueLen);
+}
+
+bool CommitWantBuilder(WantBuilder *builder, Want *want)
+{
+    if (builder == nullptr || want == nullptr) {
+        return false;
+    }
+    if (builder->length == 0) {
+        ClearWantBuilder(builder);
+        return true;
+    }
+    if (want->data == nullptr || want->dataLength == 0) {
+        FreeWantData(want->data);
+        want->data = builder->buffer;
+        want->dataLength = builder->length;
+        builder->buffer = nullptr;
+        ClearWantBuilder(builder);
+        return true;
+    }
+    if (want->dataLength > UINT16_MAX - builder->length) {
+        return false;
+    }
+    uint16_t newLen = want->dataLength + builder->length;
+    uint8_t *newData = reinterpret_cast<uint8_t *>(AdapterMalloc(newLen));
+    if (newData == nullptr) {
+        return false;
+    }
+    if (memcpy_s(newData, newLen, want->data, want->dataLength) != EOK ||
+        memcpy_s(newData + want->dataLength, builder->length, builder->buffer, builder->length) != EOK) {
+        AdapterFree(newData);
+        return false;
+    }
+    FreeWantData(want->data);
+    want->data = newData;
+    want->dataLength = newLen;
+    ClearWantBuilder(builder);
+    return true;
+}
+
+void ClearWantBuilder(WantBuilder *builder)
+{
+    if (builder == nullptr) {
+        return;
+    }
+    AdapterFree(builder->buffer);
+    builder->buffer = nullptr;
+    builder->length = 0;
+    builder->capacity = 0;
+}
+
+static bool ParseKeyValueTlv(const uint8_t *data, uint16_t dataLength, uint16_t offset, WantParam *param)
+{
+    if (offset + TLV_HEADER_LENGTH > dataLength || data[offset] != KEY_VALUE_PAIR_TYPE) {
+        return false;
+    }
+    uint8_t pairLen = data[offset + 1];
+    if (offset + TLV_HEADER_LENGTH + pairLen > dataLength) {
+        return false;
+    }
+    const uint8_t *pair = data + offset + TLV_HEADER_LENGTH;
+    // key tlv followed by value tlv, both inside the pair
+    if (pairLen < TLV_HEADER_LENGTH || pair[0] != STRING_VALUE_TYPE) {
+        return false;
+    }
+    uint8_t keyLen = pair[1];
+    if (TLV_HEADER_LENGTH + keyLen + TLV_HEADER_LENGTH > pairLen) {
+        return false;
+    }
+    const uint8_t *valueTlv = pair + TLV_HEADER_LENGTH + keyLen;
+    uint8_t valueLen = valueTlv[1];
+    if (TLV_HEADER_LENGTH + keyLen + TLV_HEADER_LENGTH + valueLen > pairLen) {
+        return false;
+    }
+    param->key = reinterpret_cast<const char *>(pair + TLV_HEADER_LENGTH);
+    param->keyLen = keyLen;
+    param->valueType = valueTlv[0];
+    param->value = valueTlv + TLV_HEADER_LENGTH;
+    param->valueLen = valueLen;
+    return true;
+}
+
+static bool IsParamKey(const WantParam &param, const char *key, uint8_t keyLen)
+{
+    return (param.keyLen == keyLen) && (memcmp(param.key, key, keyLen) == 0);
+}
+
+static bool DecodeIntParam(const WantParam &param, int32_t *value)
+{
+    if (param.valueType != INT_VALUE_TYPE || param.valueLen != INT_VALUE_LENGTH) {
+        return false;
+    }
+    const uint8_t *buffer = static_cast<const uint8_t *>(param.value);
+    uint32_t result = 0;
+    for (uint8_t i = 0; i < INT_VALUE_LENGTH; i++) {
+        result = (result << BITS_PER_BYTE) | buffer[i];
+    }
+    *value = static_cast<int32_t>(result);
+    return true;
+}
+
+static bool DecodeStrParam(const WantParam &param, const char **value, uint8_t *valueLen)
+{
+    if (param.valueType != STRING_VALUE_TYPE) {
+        return false;
+    }
+    *value = static_cast<const char *>(param.value);
+    *valueLen = param.valueLen;
+    return true;
+}
+
+static bool FindWantParam(const Want *want, const char *key, uint8_t keyLen, WantParam *param)
+{
+    WantParamIterator iterator;
+    InitWantParamIterator(&iterator, want);
+    while (NextWantParam(&iterator, param)) {
+        if (IsParamKey(*param, key, keyLen)) {
+            return true;
         }
-        SetWantData(want, newWantData, tlv->totalLen + want->dataLength);
-        AdapterFree(newWantData);
-        result = true;
-    } else {
-        SetWantData(want, tlv->entity, tlv->totalLen);
-        result = true;
     }
-    return result;
+    return false;
 }
 
-bool SetIntParam(Want *want, const char *key, uint8_t keyLen, int32_t value)
+void InitWantParamIterator(WantParamIterator *iterator, const Want *want)
 {
-    bool result = false;
-    if (keyLen <= 0) {
-        return result;
+    if (iterator == nullptr) {
+        return;
+    }
+    iterator->data = nullptr;
+    iterator->dataLength = 0;
+    iterator->offset = 0;
+    if (want != nullptr && want->data != nullptr) {
+        iterator->data = static_cast<const uint8_t *>(want->data);
+        iterator->dataLength = want->dataLength;
     }
+}
 
-    Tlv *keyTlv = EncapTlv(STRING_VALUE_TYPE, keyLen, (void *)key, keyLen);
-    if (keyTlv == nullptr) {
-        return result;
+bool NextWantParam(WantParamIterator *iterator, WantParam *param)
+{
+    if (iterator == nullptr || param == nullptr || iterator->data == nullptr) {
+        return false;
     }
-    if (value < 0) {
-        HILOG_ERROR(HILOG_MODULE_APP, "SetIntParam value should be positive");
-        FreeTlvStruct(keyTlv);
-        return result;
+    while (iterator->offset + TLV_HEADER_LENGTH <= iterator->dataLength) {
+        uint16_t offset = iterator->offset;
+        uint32_t next = offset + TLV_HEADER_LENGTH + iterator->data[offset + 1];
+        if (next > iterator->dataLength) {
+            break;
+        }
+        iterator->offset = static_cast<uint16_t>(next);
+        if (ParseKeyValueTlv(iterator->data, iterator->dataLength, offset, param)) {
+            return true;
+        }
     }
-    int intBufferNumber = 4;
-    unsigned char intBuffer[4] = {0};
-    for (int i = 0; i < intBufferNumber; i++) {
-        intBuffer[i] = value >> (8 * (3- i));
+    iterator->offset = iterator->dataLength;
+    return false;
+}
+
+bool GetIntParam(const Want *want, const char *key, uint8_t keyLen, int32_t *value)
+{
+    if (key == nullptr || keyLen == 0 || value == nullptr) {
+        return false;
     }
-    Tlv *valueTlv = EncapTlv(INT_VALUE_TYPE, sizeof(int), (void *)intBuffer, sizeof(int));
-    if (valueTlv == nullptr) {
-        FreeTlvStruct(keyTlv);
-        return result;
+    WantParam param;
+    return FindWantParam(want, key, keyLen, &param) && DecodeIntParam(param, value);
+}
+
+bool GetStrParam(const Want *want, const char *key, uint8_t keyLen, const char **value, uint8_t *valueLen)
+{
+    if (key == nullptr || keyLen == 0 || value == nullptr || valueLen == nullptr) {
+        return false;
     }
-    Tlv *newTlv = CombineKeyValueTlv(keyTlv, valueTlv);
-    FreeTlvStruct(keyTlv);
-    FreeTlvStruct(valueTlv);
-    if (newTlv == nullptr) {
-        return result;
+    WantParam param;
+    return FindWantParam(want, key, keyLen, &param) && DecodeStrParam(param, value, valueLen);
+}
+
+static uint32_t HashParamKey(const char *key, uint8_t keyLen)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+    for (uint8_t i = 0; i < keyLen; i++) {
+        hash ^= static_cast<uint8_t>(key[i]);
+        hash *= FNV_PRIME;
     }
-    if (UpdateWantData(want, newTlv)) {
-        result = true;
+    return hash;
+}
+
+static uint16_t *ProbeParamIndex(const WantParamIndex *index, const char *key, uint8_t keyLen, WantParam *param)
+{
+    uint16_t mask = index->slotNum - 1;
+    uint16_t slot = HashParamKey(key, keyLen) & mask;
+    while (index->slots[slot] != EMPTY_PARAM_INDEX_SLOT) {
+        if (ParseKeyValueTlv(index->data, index->dataLength, index->slots[slot], param) &&
+            IsParamKey(*param, key, keyLen)) {
+            return &index->slots[slot];
+        }
+        slot = (slot + 1) & mask;
     }
-    AdapterFree(newTlv);
-    return result;
+    return &index->slots[slot];
 }
 
-bool SetStrParam(Want *want, const char *key, uint8_t keyLen, const char *value, uint8_t valueLen)
+bool BuildWantParamIndex(WantParamIndex *index, const Want *want)
 {
-    bool result = false;
-    if (keyLen <= 0 || valueLen <= 0) {
-        return result;
+    if (index == nullptr) {
+        return false;
     }
+    index->data = nullptr;
+    index->dataLength = 0;
+    index->slots = nullptr;
+    index->slotNum = 0;
+
+    uint16_t paramNum = 0;
+    WantParam param;
+    WantParamIterator iterator;
+    InitWantParamIterator(&iterator, want);
+    while (NextWantParam(&iterator, &param)) {
+        paramNum++;
+    }
+    // keep the load factor at or below one half so probe sequences stay short
+    uint16_t slotNum = MIN_PARAM_INDEX_SLOTS;
+    while (slotNum < MAX_PARAM_INDEX_SLOTS && slotNum < (paramNum << 1)) {
+        slotNum <<= 1;
+    }
+    index->slots = reinterpret_cast<uint16_t *>(AdapterMalloc(slotNum * sizeof(uint16_t)));
+    if (index->slots == nullptr) {
+        return false;
+    }
+    if (memset_s(index->slots, slotNum * sizeof(uint16_t), 0xFF, slotNum * sizeof(uint16_t)) != EOK) {
+        AdapterFree(index->slots);
+        return false;
+    }
+    index->data = iterator.data;
+    index->dataLength = iterator.dataLength;
+    index->slotNum = slotNum;
+
+    InitWantParamIterator(&iterator, want);
+    while (NextWantParam(&iterator, &param)) {
+        // the key is preceded by the pair header and the key tlv header
+        uint16_t offset = static_cast<uint16_t>(reinterpret_cast<const uint8_t *>(param.key) - index->data -
+            TLV_HEADER_LENGTH - TLV_HEADER_LENGTH);
+        WantParam existed;
+        uint16_t *slot = ProbeParamIndex(index, param.key, param.keyLen, &existed);
+        if (*slot == EMPTY_PARAM_INDEX_SLOT) {
+            *slot = offset;
+        }
+    }
+    return true;
+}
 
-    Tlv *keyTlv = EncapTlv(STRING_VALUE_TYPE, keyLen, (void *)key, keyLen);
-    if (keyTlv == nullptr) {
-        return result;
+void ClearWantParamIndex(WantParamIndex *index)
+{
+    if (index == nullptr) {
+        return;
     }
+    AdapterFree(index->slots);
+    index->slots = nullptr;
+    index->data = nullptr;
+    index->dataLength = 0;
+    index->slotNum = 0;
+}
 
-    Tlv *valueTlv = EncapTlv(STRING_VALUE_TYPE, valueLen, (void *)value, valueLen);
-    if (valueTlv == nullptr) {
-        FreeTlvStruct(keyTlv);
-        return result;
+static bool FindWantParamByIndex(const WantParamIndex *index, const char *key, uint8_t keyLen, WantParam *param)
+{
+    if (index == nullptr || index->slots == nullptr || key == nullptr || keyLen == 0) {
+        return false;
     }
-    Tlv *newTlv = CombineKeyValueTlv(keyTlv, valueTlv);
-    FreeTlvStruct(keyTlv);
-    FreeTlvStruct(valueTlv);
-    if (newTlv == nullptr) {
-        return result;
+    return *ProbeParamIndex(index, key, keyLen, param) != EMPTY_PARAM_INDEX_SLOT;
+}
+
+bool GetIntParamByIndex(const WantParamIndex *index, const char *key, uint8_t keyLen, int32_t *value)
+{
+    if (value == nullptr) {
+        return false;
     }
-    if (UpdateWantData(want, newTlv)) {
-        result = true;
+    WantParam param;
+    return FindWantParamByIndex(index, key, keyLen, &param) && DecodeIntParam(param, value);
+}
+
+bool GetStrParamByIndex(const WantParamIndex *index, const char *key, uint8_t keyLen, const char **value,
+    uint8_t *valueLen)
+{
+    if (value == nullptr || valueLen == nullptr) {
+        return false;
     }
-    AdapterFree(newTlv);
-    return result;
+    WantParam param;
+    return FindWantParamByIndex(index, key, keyLen, &param) && DecodeStrParam(param, value, valueLen);
 }
 
 #ifdef OHOS_APPEXECFWK_BMS_BUNDLEMANAGER
@@ -269,7 +596,17 @@ bool SetWantData(Want *want, const void *data, uint16_t dataLength)
         return false;
     }
 
-    AdapterFree(want->data);
+#ifdef OHOS_APPEXECFWK_BMS_BUNDLEMANAGER
+    // data received in shared memory is shared with the new holder instead of copied
+    void *shared = OHOS::WantSharedData::Ref(const_cast<void *>(data));
+    if (shared != nullptr) {
+        FreeWantData(want->data);
+        want->data = shared;
+        want->dataLength = dataLength;
+        return true;
+    }
+#endif
+    FreeWantData(want->data);
     want->data = OHOS::Utils::Memdup(data, dataLength);
     if (want->data == nullptr) {
         want->dataLength = 0;
@@ -281,9 +618,12 @@ bool SetWantData(Want *want, const void *data, uint16_t dataLength)
 }
 
 #ifdef OHOS_APPEXECFWK_BMS_BUNDLEMANAGER
-bool SerializeWant(IpcIo *io, const Want *want)
+static bool SerializeWantData(IpcIo *io, const Want *want, bool shareable, uid_t receiverUid)
 {
-    if ((io == nullptr) || (want == nullptr) || (want->dataLength > DATA_LENGTH)) {
+    if ((io == nullptr) || (want == nullptr)) {
+        return false;
+    }
+    if (want->dataLength > DATA_LENGTH && !shareable) {
         return false;
     }
 
@@ -296,7 +636,14 @@ bool SerializeWant(IpcIo *io, const Want *want)
         }
     }
     WriteInt32(io, want->dataLength);
-    if (want->dataLength > 0) {
+    int32_t handle = INVALID_DATA_HANDLE;
+    if (want->dataLength > DATA_LENGTH) {
+        // too large for the message, send a shared memory segment handed to the receiver
+        if (!OHOS::WantSharedData::Create(want->data, want->dataLength, receiverUid, handle)) {
+            return false;
+        }
+        WriteInt32(io, handle);
+    } else if (want->dataLength > 0) {
         WriteBuffer(io, want->data, want->dataLength);
     }
     if (want->sid == nullptr) {
@@ -305,6 +652,9 @@ bool SerializeWant(IpcIo *io, const Want *want)
         WriteInt32(io, VALUE_OBJECT);
         bool ret = WriteRemoteObject(io, want->sid);
         if (!ret) {
+            if (handle != INVALID_DATA_HANDLE) {
+                OHOS::WantSharedData::ReleaseHandle(handle);
+            }
             return false;
         }
     }
@@ -312,6 +662,16 @@ bool SerializeWant(IpcIo *io, const Want *want)
     return true;
 }
 
+bool SerializeWant(IpcIo *io, const Want *want)
+{
+    return SerializeWantData(io, want, false, 0);
+}
+
+bool SerializeWantTo(IpcIo *io, const Want *want, uid_t receiverUid)
+{
+    return SerializeWantData(io, want, true, receiverUid);
+}
+
 bool DeserializeWant(Want *want, IpcIo *io)
 {
     if ((want == nullptr) || (io == nullptr)) {
@@ -331,7 +691,21 @@ bool DeserializeWant(Want *want, IpcIo *io)
     }
     uint32_t size = 0;
     ReadUint32(io, &size);
-    if (size > 0) {
+    if (size > DATA_LENGTH) {
+        int32_t handle = INVALID_DATA_HANDLE;
+        ReadInt32(io, &handle);
+        // outside of an incoming call the io was written by this process
+        pid_t callingUid = GetCallingUid();
+        uid_t senderUid = (callingUid < 0) ? geteuid() : static_cast<uid_t>(callingUid);
+        void *data = (size > UINT16_MAX) ? nullptr : OHOS::WantSharedData::Attach(handle, size, senderUid);
+        if (data == nullptr) {
+            ClearWant(want);
+            return false;
+        }
+        FreeWantData(want->data);
+        want->data = data;
+        want->dataLength = size;
+    } else if (size > 0) {
         void *data = (void*)ReadBuffer(io, (size_t)size);
         if (!SetWantData(want, data, size)) {
             ClearWant(want);
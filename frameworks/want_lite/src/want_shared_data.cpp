@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "want_shared_data.h"
+
+#include <cerrno>
+#include <csignal>
+#include <ctime>
+#include <pthread.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <unistd.h>
+#include <unordered_map>
+
+#include <securec.h>
+
+#include "adapter.h"
+#include "log.h"
+
+namespace OHOS {
+namespace {
+    struct alignas(16) SegmentHeader {
+        uint32_t magic;
+        uint32_t length;
+    };
+
+    struct Mapping {
+        SegmentHeader *header;
+        uint32_t holds;
+    };
+
+    constexpr uint32_t SEGMENT_MAGIC = 0x57414E54;
+    constexpr int CREATE_MODE = 0600;
+    // the mode of a segment handed to its receiver, which only reads it
+    constexpr mode_t HANDED_MODE = 0400;
+    constexpr mode_t PERMISSION_MASK = 0777;
+    // a handed segment nobody mapped for this long belongs to a message that was never delivered
+    constexpr time_t ORPHAN_SEGMENT_AGE = 60;
+
+    pthread_mutex_t g_mappingMutex = PTHREAD_MUTEX_INITIALIZER;
+    // payload address to the mapping of this process
+    std::unordered_map<const void *, Mapping> g_mappings;
+
+    void *GetPayload(SegmentHeader *header)
+    {
+        return reinterpret_cast<uint8_t *>(header) + sizeof(SegmentHeader);
+    }
+
+    bool IsOrphan(const struct shmid_ds &status, uid_t uid, time_t now)
+    {
+        if ((status.shm_perm.mode & PERMISSION_MASK) != HANDED_MODE || status.shm_nattch != 0) {
+            return false;
+        }
+        if (status.shm_perm.cuid != uid && status.shm_perm.uid != uid) {
+            return false;
+        }
+        bool creatorDead = kill(status.shm_cpid, 0) != 0 && errno == ESRCH;
+        return creatorDead || now - status.shm_ctime > ORPHAN_SEGMENT_AGE;
+    }
+
+    // only a segment carrying a want data header of its own size is ever removed by the reclaim
+    bool IsWantSegment(int32_t segment, const struct shmid_ds &status)
+    {
+        if (status.shm_segsz <= sizeof(SegmentHeader)) {
+            return false;
+        }
+        void *address = shmat(segment, nullptr, SHM_RDONLY);
+        if (address == reinterpret_cast<void *>(-1)) {
+            return false;
+        }
+        auto header = static_cast<const SegmentHeader *>(address);
+        bool tagged = header->magic == SEGMENT_MAGIC && sizeof(SegmentHeader) + header->length == status.shm_segsz;
+        (void) shmdt(address);
+        return tagged;
+    }
+
+    // removes the undelivered want data segments this uid created or was handed
+    void ReclaimOrphanSegments()
+    {
+        struct shm_info info = {};
+        int32_t maxIndex = shmctl(0, SHM_INFO, reinterpret_cast<struct shmid_ds *>(&info));
+        uid_t uid = geteuid();
+        time_t now = time(nullptr);
+        for (int32_t index = 0; index <= maxIndex; index++) {
+            struct shmid_ds status = {};
+            int32_t segment = shmctl(index, SHM_STAT, &status);
+            if (segment >= 0 && IsOrphan(status, uid, now) && IsWantSegment(segment, status)) {
+                HILOG_WARN(HILOG_MODULE_APP, "remove undelivered want data segment %{public}d", segment);
+                (void) shmctl(segment, IPC_RMID, nullptr);
+            }
+        }
+    }
+
+    bool CheckSegment(int32_t handle, uint16_t length, uid_t senderUid)
+    {
+        struct shmid_ds status = {};
+        if (shmctl(handle, IPC_STAT, &status) != 0) {
+            HILOG_ERROR(HILOG_MODULE_APP, "want data segment %{public}d is not accessible", handle);
+            return false;
+        }
+        if (status.shm_perm.cuid != senderUid || status.shm_perm.uid != geteuid()) {
+            HILOG_ERROR(HILOG_MODULE_APP, "want data segment %{public}d is not from the sender", handle);
+            return false;
+        }
+        // the mode of a removed segment also carries the destroy flag, it was attached by its receiver already
+        if (status.shm_perm.mode != HANDED_MODE) {
+            HILOG_ERROR(HILOG_MODULE_APP, "want data segment %{public}d is not handed over", handle);
+            return false;
+        }
+        if (status.shm_segsz < sizeof(SegmentHeader) + length) {
+            HILOG_ERROR(HILOG_MODULE_APP, "want data segment %{public}d is too short", handle);
+            return false;
+        }
+        return true;
+    }
+}
+
+bool WantSharedData::IsShared(const void *data)
+{
+    if (data == nullptr) {
+        return false;
+    }
+    (void) pthread_mutex_lock(&g_mappingMutex);
+    bool shared = g_mappings.find(data) != g_mappings.end();
+    (void) pthread_mutex_unlock(&g_mappingMutex);
+    return shared;
+}
+
+bool WantSharedData::Create(const void *data, uint16_t length, uid_t receiverUid, int32_t &handle)
+{
+    if (data == nullptr || length == 0) {
+        return false;
+    }
+    ReclaimOrphanSegments();
+    int32_t segment = shmget(IPC_PRIVATE, sizeof(SegmentHeader) + length, IPC_CREAT | IPC_EXCL | CREATE_MODE);
+    if (segment < 0) {
+        HILOG_ERROR(HILOG_MODULE_APP, "create want data segment of %{public}u bytes failed", length);
+        return false;
+    }
+    void *address = shmat(segment, nullptr, 0);
+    if (address == reinterpret_cast<void *>(-1)) {
+        (void) shmctl(segment, IPC_RMID, nullptr);
+        return false;
+    }
+    auto header = static_cast<SegmentHeader *>(address);
+    header->magic = SEGMENT_MAGIC;
+    header->length = length;
+    bool written = memcpy_s(GetPayload(header), length, data, length) == EOK;
+    // the creator keeps no mapping, the segment belongs to the message
+    (void) shmdt(header);
+
+    struct shmid_ds status = {};
+    if (!written || shmctl(segment, IPC_STAT, &status) != 0) {
+        (void) shmctl(segment, IPC_RMID, nullptr);
+        return false;
+    }
+    status.shm_perm.uid = receiverUid;
+    status.shm_perm.mode = HANDED_MODE;
+    if (shmctl(segment, IPC_SET, &status) != 0) {
+        HILOG_ERROR(HILOG_MODULE_APP, "hand want data segment to uid %{public}d failed", receiverUid);
+        (void) shmctl(segment, IPC_RMID, nullptr);
+        return false;
+    }
+    handle = segment;
+    return true;
+}
+
+void *WantSharedData::Attach(int32_t handle, uint16_t length, uid_t senderUid)
+{
+    if (handle < 0 || !CheckSegment(handle, length, senderUid)) {
+        return nullptr;
+    }
+    void *address = shmat(handle, nullptr, SHM_RDONLY);
+    if (address == reinterpret_cast<void *>(-1)) {
+        HILOG_ERROR(HILOG_MODULE_APP, "map want data segment %{public}d failed", handle);
+        return nullptr;
+    }
+    // freed by the kernel with the last mapping, and the handle can not be attached again
+    (void) shmctl(handle, IPC_RMID, nullptr);
+    auto header = static_cast<SegmentHeader *>(address);
+    if (header->magic != SEGMENT_MAGIC || header->length < length) {
+        HILOG_ERROR(HILOG_MODULE_APP, "want data segment %{public}d is malformed", handle);
+        (void) shmdt(address);
+        return nullptr;
+    }
+    void *payload = GetPayload(header);
+    (void) pthread_mutex_lock(&g_mappingMutex);
+    g_mappings[payload] = { header, 1 };
+    (void) pthread_mutex_unlock(&g_mappingMutex);
+    return payload;
+}
+
+void *WantSharedData::Ref(void *data)
+{
+    (void) pthread_mutex_lock(&g_mappingMutex);
+    auto iterator = g_mappings.find(data);
+    if (iterator == g_mappings.end()) {
+        (void) pthread_mutex_unlock(&g_mappingMutex);
+        return nullptr;
+    }
+    iterator->second.holds++;
+    (void) pthread_mutex_unlock(&g_mappingMutex);
+    return data;
+}
+
+void WantSharedData::Release(void *data)
+{
+    if (data == nullptr) {
+        return;
+    }
+    (void) pthread_mutex_lock(&g_mappingMutex);
+    auto iterator = g_mappings.find(data);
+    if (iterator == g_mappings.end()) {
+        (void) pthread_mutex_unlock(&g_mappingMutex);
+        AdapterFree(data);
+        return;
+    }
+    SegmentHeader *header = nullptr;
+    if (--iterator->second.holds == 0) {
+        header = iterator->second.header;
+        g_mappings.erase(iterator);
+    }
+    (void) pthread_mutex_unlock(&g_mappingMutex);
+    if (header != nullptr) {
+        (void) shmdt(header);
+    }
+}
+
+void WantSharedData::ReleaseHandle(int32_t handle)
+{
+    // the creator may still remove the segment it handed over
+    (void) shmctl(handle, IPC_RMID, nullptr);
+}
+} // namespace OHOS
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+#include "want.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+    constexpr uint32_t BENCHMARK_ROUNDS = 200;
+    constexpr uint32_t BENCHMARK_REPEATS = 5;
+    constexpr uint32_t MIN_COMPARED_PARAM_COUNT = 8;
+    constexpr uint8_t KEY_LEN = 5;
+    constexpr uint8_t KEY_BUFFER_LEN = 8;
+    constexpr uint16_t PARAM_SIZE = 15;
+    // a string parameter whose value is its key
+    constexpr uint16_t STR_PARAM_SIZE = 16;
+    constexpr uint32_t PARAM_COUNTS[] = { 1, 8, 64 };
+    constexpr uint32_t MAX_PARAM_COUNT = 64;
+
+    // keys of the benchmark, formatted once so the timed loops only measure the want functions
+    static char g_keys[MAX_PARAM_COUNT][KEY_BUFFER_LEN] = { { 0 } };
+
+    static void MakeKey(char *key, uint32_t index)
+    {
+        (void)snprintf(key, KEY_BUFFER_LEN, "key%02u", index);
+    }
+
+    // even parameters are ints and odd ones strings, so both encodings are measured
+    static void SetParams(Want *want, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++) {
+            const char *key = g_keys[i];
+            bool isSet = (i % 2 == 0) ? SetIntParam(want, key, KEY_LEN, i) :
+                SetStrParam(want, key, KEY_LEN, key, KEY_LEN);
+            ASSERT_TRUE(isSet);
+        }
+    }
+
+    static void BuildParams(Want *want, uint32_t count)
+    {
+        WantBuilder builder;
+        ASSERT_TRUE(InitWantBuilder(&builder, count * STR_PARAM_SIZE));
+        for (uint32_t i = 0; i < count; i++) {
+            const char *key = g_keys[i];
+            bool isAdded = (i % 2 == 0) ? WantBuilderAddIntParam(&builder, key, KEY_LEN, i) :
+                WantBuilderAddStrParam(&builder, key, KEY_LEN, key, KEY_LEN);
+            ASSERT_TRUE(isAdded);
+        }
+        ASSERT_TRUE(CommitWantBuilder(&builder, want));
+    }
+
+    // the fastest of a few runs of BENCHMARK_ROUNDS wants, so a preempted run does not decide the comparison
+    static long long MeasureBuild(void (*build)(Want *, uint32_t), uint32_t count)
+    {
+        long long best = LLONG_MAX;
+        for (uint32_t repeat = 0; repeat < BENCHMARK_REPEATS; repeat++) {
+            auto begin = std::chrono::steady_clock::now();
+            for (uint32_t round = 0; round < BENCHMARK_ROUNDS; round++) {
+                Want want;
+                (void)memset(&want, 0, sizeof(Want));
+                build(&want, count);
+                ClearWant(&want);
+            }
+            best = std::min(best, static_cast<long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - begin).count()));
+        }
+        return best;
+    }
+
+    class WantBuilderTest : public testing::Test {
+    public:
+        void SetUp() override
+        {
+            (void)memset(&want_, 0, sizeof(Want));
+        }
+
+        void TearDown() override
+        {
+            ClearWant(&want_);
+        }
+
+        Want want_;
+    };
+
+    /**
+     * @tc.name: WantBuilder001
+     * @tc.desc: test WantBuilder produces the same data as SetIntParam and SetStrParam.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(WantBuilderTest, WantBuilder001, TestSize.Level0)
+    {
+        char key[KEY_BUFFER_LEN] = { 0 };
+        WantBuilder builder;
+        ASSERT_TRUE(InitWantBuilder(&builder, 0));
+        for (uint32_t i = 0; i < PARAM_COUNTS[1]; i++) {
+            MakeKey(key, i);
+            ASSERT_TRUE(SetIntParam(&want_, key, KEY_LEN, i));
+            ASSERT_TRUE(WantBuilderAddIntParam(&builder, key, KEY_LEN, i));
+        }
+        ASSERT_TRUE(SetStrParam(&want_, "name", 4, "value", 5));
+        ASSERT_TRUE(WantBuilderAddStrParam(&builder, "name", 4, "value", 5));
+        EXPECT_FALSE(WantBuilderAddIntParam(&builder, "negative", 8, -1));
+
+        Want built;
+        (void)memset(&built, 0, sizeof(Want));
+        ASSERT_TRUE(CommitWantBuilder(&builder, &built));
+        EXPECT_EQ(builder.buffer, nullptr);
+        ASSERT_EQ(built.dataLength, want_.dataLength);
+        EXPECT_EQ(memcmp(built.data, want_.data, want_.dataLength), 0);
+
+        int32_t value = 0;
+        MakeKey(key, PARAM_COUNTS[1] - 1);
+        EXPECT_TRUE(GetIntParam(&built, key, KEY_LEN, &value));
+        EXPECT_EQ(value, static_cast<int32_t>(PARAM_COUNTS[1] - 1));
+        ClearWant(&built);
+    }
+
+    /**
+     * @tc.name: WantBuilder002
+     * @tc.desc: test WantBuilder keeps every parameter when the buffer grows past the initial capacity.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(WantBuilderTest, WantBuilder002, TestSize.Level1)
+    {
+        char key[KEY_BUFFER_LEN] = { 0 };
+        for (uint32_t count : PARAM_COUNTS) {
+            WantBuilder builder;
+            ASSERT_TRUE(InitWantBuilder(&builder, PARAM_SIZE));
+            for (uint32_t i = 0; i < count; i++) {
+                MakeKey(key, i);
+                ASSERT_TRUE(WantBuilderAddIntParam(&builder, key, KEY_LEN, i));
+            }
+            ASSERT_TRUE(CommitWantBuilder(&builder, &want_));
+            EXPECT_EQ(want_.dataLength, count * PARAM_SIZE);
+
+            int32_t value = -1;
+            MakeKey(key, count - 1);
+            EXPECT_TRUE(GetIntParam(&want_, key, KEY_LEN, &value));
+            EXPECT_EQ(value, static_cast<int32_t>(count - 1));
+            ClearWant(&want_);
+            (void)memset(&want_, 0, sizeof(Want));
+        }
+    }
+
+    /**
+     * @tc.name: WantBuilderBenchmark001
+     * @tc.desc: test building wants with 1, 8 and 64 parameters through WantBuilder is no slower than through
+     *           SetIntParam and SetStrParam.
+     * @tc.type: PERF
+     */
+    HWTEST_F(WantBuilderTest, WantBuilderBenchmark001, TestSize.Level1)
+    {
+        for (uint32_t i = 0; i < MAX_PARAM_COUNT; i++) {
+            MakeKey(g_keys[i], i);
+        }
+        for (uint32_t count : PARAM_COUNTS) {
+            Want setWant;
+            (void)memset(&setWant, 0, sizeof(Want));
+            SetParams(&setWant, count);
+            BuildParams(&want_, count);
+            ASSERT_EQ(want_.dataLength, setWant.dataLength);
+            EXPECT_EQ(memcmp(want_.data, setWant.data, setWant.dataLength), 0);
+            ClearWant(&setWant);
+            ClearWant(&want_);
+            (void)memset(&want_, 0, sizeof(Want));
+
+            long long setCost = MeasureBuild(SetParams, count);
+            long long builderCost = MeasureBuild(BuildParams, count);
+            printf("%u params, %u wants: SetIntParam/SetStrParam %lld ns, WantBuilder %lld ns\n",
+                count, BENCHMARK_ROUNDS, setCost, builderCost);
+            // with a single parameter both take one allocation, the builder only pays off from a few on
+            if (count >= MIN_COMPARED_PARAM_COUNT) {
+                EXPECT_LE(builderCost, setCost);
+            }
+        }
+    }
+} // namespace OHOS
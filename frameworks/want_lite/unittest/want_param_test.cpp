@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+#include "want.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+    // tlv type of a key-value pair, as written by SetIntParam and SetStrParam
+    constexpr uint8_t PAIR_TYPE = 97;
+
+    class WantParamTest : public testing::Test {
+    public:
+        void SetUp() override
+        {
+            (void)memset(&want_, 0, sizeof(Want));
+        }
+
+        void TearDown() override
+        {
+            ClearWant(&want_);
+        }
+
+        // points a want at a hand-written buffer, the buffer stays owned by the test
+        static Want RawWant(uint8_t *data, uint16_t dataLength)
+        {
+            Want want;
+            (void)memset(&want, 0, sizeof(Want));
+            want.data = data;
+            want.dataLength = dataLength;
+            return want;
+        }
+
+        Want want_;
+    };
+
+    /**
+     * @tc.name: WantParam001
+     * @tc.desc: test the iterator reads every parameter in order and skips records that are not key-value pairs.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(WantParamTest, WantParam001, TestSize.Level0)
+    {
+        WantParam param;
+        WantParamIterator iterator;
+        InitWantParamIterator(&iterator, &want_);
+        EXPECT_FALSE(NextWantParam(&iterator, &param));
+
+        ASSERT_TRUE(SetIntParam(&want_, "count", 5, 258));
+        ASSERT_TRUE(SetStrParam(&want_, "name", 4, "value", 5));
+        InitWantParamIterator(&iterator, &want_);
+        ASSERT_TRUE(NextWantParam(&iterator, &param));
+        EXPECT_EQ(param.keyLen, 5);
+        EXPECT_EQ(memcmp(param.key, "count", 5), 0);
+        EXPECT_EQ(param.valueType, WANT_PARAM_INT_TYPE);
+        EXPECT_EQ(param.valueLen, 4);
+        ASSERT_TRUE(NextWantParam(&iterator, &param));
+        EXPECT_EQ(param.keyLen, 4);
+        EXPECT_EQ(memcmp(param.key, "name", 4), 0);
+        EXPECT_EQ(param.valueType, WANT_PARAM_STRING_TYPE);
+        ASSERT_EQ(param.valueLen, 5);
+        EXPECT_EQ(memcmp(param.value, "value", 5), 0);
+        EXPECT_FALSE(NextWantParam(&iterator, &param));
+        EXPECT_FALSE(NextWantParam(&iterator, &param));
+
+        // a record of another type between two pairs
+        uint8_t data[] = {
+            PAIR_TYPE, 6, WANT_PARAM_STRING_TYPE, 1, 'a', WANT_PARAM_STRING_TYPE, 1, 'x',
+            1, 2, 0, 0,
+            PAIR_TYPE, 6, WANT_PARAM_STRING_TYPE, 1, 'b', WANT_PARAM_STRING_TYPE, 1, 'y',
+        };
+        Want raw = RawWant(data, sizeof(data));
+        InitWantParamIterator(&iterator, &raw);
+        ASSERT_TRUE(NextWantParam(&iterator, &param));
+        EXPECT_EQ(param.key[0], 'a');
+        ASSERT_TRUE(NextWantParam(&iterator, &param));
+        EXPECT_EQ(param.key[0], 'b');
+        EXPECT_FALSE(NextWantParam(&iterator, &param));
+    }
+
+    /**
+     * @tc.name: WantParam002
+     * @tc.desc: test lookups of missing and duplicate keys and of values of the wrong type, with and without an index.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(WantParamTest, WantParam002, TestSize.Level0)
+    {
+        ASSERT_TRUE(SetIntParam(&want_, "count", 5, 1));
+        ASSERT_TRUE(SetStrParam(&want_, "name", 4, "first", 5));
+        ASSERT_TRUE(SetIntParam(&want_, "count", 5, 2));
+        ASSERT_TRUE(SetStrParam(&want_, "name", 4, "second", 6));
+
+        WantParamIndex index;
+        ASSERT_TRUE(BuildWantParamIndex(&index, &want_));
+        int32_t intValue = 0;
+        const char *strValue = nullptr;
+        uint8_t strLen = 0;
+
+        // the first value of a key wins
+        EXPECT_TRUE(GetIntParam(&want_, "count", 5, &intValue));
+        EXPECT_EQ(intValue, 1);
+        intValue = 0;
+        EXPECT_TRUE(GetIntParamByIndex(&index, "count", 5, &intValue));
+        EXPECT_EQ(intValue, 1);
+        EXPECT_TRUE(GetStrParam(&want_, "name", 4, &strValue, &strLen));
+        EXPECT_EQ(strLen, 5);
+        EXPECT_EQ(memcmp(strValue, "first", 5), 0);
+        strValue = nullptr;
+        EXPECT_TRUE(GetStrParamByIndex(&index, "name", 4, &strValue, &strLen));
+        EXPECT_EQ(strLen, 5);
+        EXPECT_EQ(memcmp(strValue, "first", 5), 0);
+
+        EXPECT_FALSE(GetIntParam(&want_, "missing", 7, &intValue));
+        EXPECT_FALSE(GetIntParamByIndex(&index, "missing", 7, &intValue));
+        EXPECT_FALSE(GetIntParam(&want_, "coun", 4, &intValue));
+        EXPECT_FALSE(GetIntParamByIndex(&index, "coun", 4, &intValue));
+
+        EXPECT_FALSE(GetStrParam(&want_, "count", 5, &strValue, &strLen));
+        EXPECT_FALSE(GetStrParamByIndex(&index, "count", 5, &strValue, &strLen));
+        EXPECT_FALSE(GetIntParam(&want_, "name", 4, &intValue));
+        EXPECT_FALSE(GetIntParamByIndex(&index, "name", 4, &intValue));
+        ClearWantParamIndex(&index);
+        EXPECT_EQ(index.slots, nullptr);
+        EXPECT_FALSE(GetIntParamByIndex(&index, "count", 5, &intValue));
+
+        // an index over a want without data finds nothing
+        Want empty;
+        (void)memset(&empty, 0, sizeof(Want));
+        ASSERT_TRUE(BuildWantParamIndex(&index, &empty));
+        EXPECT_FALSE(GetIntParamByIndex(&index, "count", 5, &intValue));
+        ClearWantParamIndex(&index);
+    }
+
+    /**
+     * @tc.name: WantParam003
+     * @tc.desc: test truncated and malformed records are skipped without reading past the data.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(WantParamTest, WantParam003, TestSize.Level0)
+    {
+        int32_t intValue = 0;
+        const char *strValue = nullptr;
+        uint8_t strLen = 0;
+        WantParam param;
+        WantParamIterator iterator;
+
+        // a valid pair, then one cut off in its value
+        uint8_t truncated[] = {
+            PAIR_TYPE, 6, WANT_PARAM_STRING_TYPE, 1, 'a', WANT_PARAM_STRING_TYPE, 1, 'x',
+            PAIR_TYPE, 9, WANT_PARAM_STRING_TYPE, 1, 'b', WANT_PARAM_INT_TYPE, 4, 0, 0,
+        };
+        Want want = RawWant(truncated, sizeof(truncated));
+        EXPECT_TRUE(GetStrParam(&want, "a", 1, &strValue, &strLen));
+        EXPECT_FALSE(GetIntParam(&want, "b", 1, &intValue));
+        InitWantParamIterator(&iterator, &want);
+        EXPECT_TRUE(NextWantParam(&iterator, &param));
+        EXPECT_FALSE(NextWantParam(&iterator, &param));
+
+        // a lone type byte, and a header without its pair
+        want = RawWant(truncated, 1);
+        InitWantParamIterator(&iterator, &want);
+        EXPECT_FALSE(NextWantParam(&iterator, &param));
+        want = RawWant(truncated, 2);
+        InitWantParamIterator(&iterator, &want);
+        EXPECT_FALSE(NextWantParam(&iterator, &param));
+
+        uint8_t malformed[] = {
+            // the key is longer than the pair
+            PAIR_TYPE, 6, WANT_PARAM_STRING_TYPE, 9, 'a', WANT_PARAM_STRING_TYPE, 1, 'x',
+            // the value is longer than the pair
+            PAIR_TYPE, 6, WANT_PARAM_STRING_TYPE, 1, 'b', WANT_PARAM_STRING_TYPE, 9, 'x',
+            // the key is not a string
+            PAIR_TYPE, 6, WANT_PARAM_INT_TYPE, 1, 'c', WANT_PARAM_STRING_TYPE, 1, 'x',
+            // too short for the key header
+            PAIR_TYPE, 1, WANT_PARAM_STRING_TYPE,
+            // an int value of the wrong length
+            PAIR_TYPE, 7, WANT_PARAM_STRING_TYPE, 1, 'd', WANT_PARAM_INT_TYPE, 2, 0, 1,
+            // still read after the broken ones
+            PAIR_TYPE, 6, WANT_PARAM_STRING_TYPE, 1, 'e', WANT_PARAM_STRING_TYPE, 1, 'y',
+        };
+        want = RawWant(malformed, sizeof(malformed));
+        EXPECT_FALSE(GetStrParam(&want, "a", 1, &strValue, &strLen));
+        EXPECT_FALSE(GetStrParam(&want, "b", 1, &strValue, &strLen));
+        EXPECT_FALSE(GetStrParam(&want, "c", 1, &strValue, &strLen));
+        EXPECT_FALSE(GetIntParam(&want, "d", 1, &intValue));
+        ASSERT_TRUE(GetStrParam(&want, "e", 1, &strValue, &strLen));
+        EXPECT_EQ(strValue[0], 'y');
+
+        WantParamIndex index;
+        ASSERT_TRUE(BuildWantParamIndex(&index, &want));
+        EXPECT_FALSE(GetStrParamByIndex(&index, "a", 1, &strValue, &strLen));
+        EXPECT_FALSE(GetIntParamByIndex(&index, "d", 1, &intValue));
+        EXPECT_TRUE(GetStrParamByIndex(&index, "e", 1, &strValue, &strLen));
+        ClearWantParamIndex(&index);
+    }
+}
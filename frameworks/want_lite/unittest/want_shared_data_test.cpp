@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <sys/shm.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "gtest/gtest.h"
+
+#include "want.h"
+#include "want_shared_data.h"
+#include "want_utils.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+    constexpr uint16_t LARGE_DATA_LENGTH = 8192;
+    constexpr uint32_t IO_BUFFER_SIZE = 256;
+
+    class WantSharedDataTest : public testing::Test {
+    public:
+        void SetUp() override
+        {
+            (void)memset(&want_, 0, sizeof(Want));
+            for (uint16_t i = 0; i < LARGE_DATA_LENGTH; i++) {
+                data_[i] = static_cast<uint8_t>(i);
+            }
+        }
+
+        void TearDown() override
+        {
+            ClearWant(&want_);
+        }
+
+        // sends want through an IpcIo the way the ability clients do and returns what the receiver reads
+        static bool Transfer(const Want &want, Want &received)
+        {
+            uint8_t buffer[IO_BUFFER_SIZE] = { 0 };
+            IpcIo writer;
+            IpcIoInit(&writer, buffer, sizeof(buffer), 0);
+            if (!SerializeWantTo(&writer, &want, geteuid())) {
+                return false;
+            }
+            IpcIo reader;
+            IpcIoInit(&reader, buffer, sizeof(buffer), 0);
+            (void)memset(&received, 0, sizeof(Want));
+            return DeserializeWant(&received, &reader);
+        }
+
+        // creates a segment handed to this uid in a child that exits, so its message looks undelivered
+        int32_t CreateInExitedChild(bool wantData)
+        {
+            int32_t fds[2] = { -1, -1 };
+            if (pipe(fds) != 0) {
+                return -1;
+            }
+            int32_t handle = -1;
+            pid_t child = fork();
+            if (child == 0) {
+                if (wantData) {
+                    (void)WantSharedData::Create(data_, LARGE_DATA_LENGTH, geteuid(), handle);
+                } else {
+                    handle = shmget(IPC_PRIVATE, LARGE_DATA_LENGTH, IPC_CREAT | 0400);
+                }
+                (void)write(fds[1], &handle, sizeof(handle));
+                _exit(0);
+            }
+            (void)close(fds[1]);
+            if (child < 0 || read(fds[0], &handle, sizeof(handle)) != sizeof(handle)) {
+                handle = -1;
+            }
+            (void)close(fds[0]);
+            (void)waitpid(child, nullptr, 0);
+            return handle;
+        }
+
+        Want want_;
+        uint8_t data_[LARGE_DATA_LENGTH];
+    };
+
+    /**
+     * @tc.name: WantSharedData001
+     * @tc.desc: test data over the inline limit is received through shared memory and shared by later copies.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(WantSharedDataTest, WantSharedData001, TestSize.Level0)
+    {
+        ASSERT_TRUE(SetWantData(&want_, data_, LARGE_DATA_LENGTH));
+        EXPECT_FALSE(WantSharedData::IsShared(want_.data));
+
+        Want received;
+        ASSERT_TRUE(Transfer(want_, received));
+        ASSERT_EQ(received.dataLength, LARGE_DATA_LENGTH);
+        EXPECT_TRUE(WantSharedData::IsShared(received.data));
+        EXPECT_EQ(memcmp(received.data, data_, LARGE_DATA_LENGTH), 0);
+
+        // the copy the service keeps shares the mapping, the want it sends on gets a segment of its own
+        Want kept;
+        (void)memset(&kept, 0, sizeof(Want));
+        ASSERT_TRUE(SetWantData(&kept, received.data, received.dataLength));
+        EXPECT_EQ(kept.data, received.data);
+        ClearWant(&received);
+
+        Want forwarded;
+        ASSERT_TRUE(Transfer(kept, forwarded));
+        EXPECT_NE(forwarded.data, kept.data);
+        ClearWant(&kept);
+        EXPECT_TRUE(WantSharedData::IsShared(forwarded.data));
+        EXPECT_EQ(memcmp(forwarded.data, data_, LARGE_DATA_LENGTH), 0);
+        ClearWant(&forwarded);
+    }
+
+    /**
+     * @tc.name: WantSharedData002
+     * @tc.desc: test handles that were not handed to this process by the sender are not mapped.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(WantSharedDataTest, WantSharedData002, TestSize.Level0)
+    {
+        EXPECT_EQ(WantSharedData::Attach(-1, LARGE_DATA_LENGTH, geteuid()), nullptr);
+        ASSERT_TRUE(SetWantData(&want_, data_, LARGE_DATA_LENGTH));
+        uint8_t buffer[IO_BUFFER_SIZE] = { 0 };
+        IpcIo writer;
+        IpcIoInit(&writer, buffer, sizeof(buffer), 0);
+        // without a known receiver the data must fit into the message
+        EXPECT_FALSE(SerializeWant(&writer, &want_));
+
+        // a segment anybody could have created and written
+        int32_t forged = shmget(IPC_PRIVATE, LARGE_DATA_LENGTH * 2, IPC_CREAT | 0666);
+        ASSERT_GE(forged, 0);
+        EXPECT_EQ(WantSharedData::Attach(forged, LARGE_DATA_LENGTH, geteuid()), nullptr);
+        (void)shmctl(forged, IPC_RMID, nullptr);
+
+        int32_t handle = -1;
+        ASSERT_TRUE(WantSharedData::Create(data_, LARGE_DATA_LENGTH, geteuid(), handle));
+        // created by another uid than the one the handle came from, or shorter than announced
+        EXPECT_EQ(WantSharedData::Attach(handle, LARGE_DATA_LENGTH, geteuid() + 1), nullptr);
+        EXPECT_EQ(WantSharedData::Attach(handle, LARGE_DATA_LENGTH + 1, geteuid()), nullptr);
+
+        void *payload = WantSharedData::Attach(handle, LARGE_DATA_LENGTH, geteuid());
+        ASSERT_NE(payload, nullptr);
+        EXPECT_EQ(memcmp(payload, data_, LARGE_DATA_LENGTH), 0);
+        // a replayed handle is not mapped a second time
+        EXPECT_EQ(WantSharedData::Attach(handle, LARGE_DATA_LENGTH, geteuid()), nullptr);
+        WantSharedData::Release(payload);
+        EXPECT_FALSE(WantSharedData::IsShared(payload));
+    }
+
+    /**
+     * @tc.name: WantSharedData003
+     * @tc.desc: test only undelivered want data segments are reclaimed, other segments of the uid are kept.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(WantSharedDataTest, WantSharedData003, TestSize.Level0)
+    {
+        int32_t undelivered = CreateInExitedChild(true);
+        ASSERT_GE(undelivered, 0);
+        int32_t foreign = CreateInExitedChild(false);
+        ASSERT_GE(foreign, 0);
+
+        int32_t handle = -1;
+        ASSERT_TRUE(WantSharedData::Create(data_, LARGE_DATA_LENGTH, geteuid(), handle));
+        struct shmid_ds status = {};
+        EXPECT_NE(shmctl(undelivered, IPC_STAT, &status), 0);
+        EXPECT_EQ(shmctl(foreign, IPC_STAT, &status), 0);
+        (void)shmctl(foreign, IPC_RMID, nullptr);
+        WantSharedData::ReleaseHandle(handle);
+    }
+} // namespace OHOS
@@ -39,6 +39,9 @@ const char AMS_INNER_FEATURE[] = "AmsInnerFeature";
 constexpr uint32_t TRANSACTION_MSG_TOKEN_MASK = 0xFFFF;
 constexpr uint32_t TRANSACTION_MSG_STATE_MASK = 0xFFFF;
 constexpr uint32_t TRANSACTION_MSG_STATE_OFFSET = 16;
+#else
+/* max number of lifecycle results reported by one ABILITY_TRANSACTION_DONE_BATCH request */
+constexpr uint32_t MAX_TRANSACTION_BATCH_SIZE = 16;
 #endif
 
 enum AmsCommand {
@@ -60,7 +63,11 @@ enum AmsCommand {
     REMOVE_ABILITY_RECORD_OBSERVER,
     TERMINATE_MISSION,
     TERMINATE_ALL,
+    SET_ABILITY_EVICTION_POLICY,
+    ABILITY_THREAD_DRAINED,
     COMMAND_END,
+    /* public command added after the inner range, the explicit id keeps the ids above unchanged */
+    ABILITY_TRANSACTION_DONE_BATCH = 0x100,
 };
 
 #ifndef __LITEOS_M__
@@ -90,6 +97,7 @@ struct AmsSliteInterface {
     int32_t (*ForceStopBundle)(uint64_t token);
     ElementName *(*GetTopAbility)();
     void *(*GetMissionInfos)(uint32_t maxNum);
+    uint32_t (*DumpOperationStat)(char *buffer, uint32_t size);
 };
 #endif
 #ifdef __cplusplus
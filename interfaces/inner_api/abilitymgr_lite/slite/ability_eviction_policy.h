@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_SLITE_ABILITY_EVICTION_POLICY_H
+#define OHOS_ABILITY_SLITE_ABILITY_EVICTION_POLICY_H
+
+#include <stdint.h>
+
+namespace OHOS {
+namespace AbilitySlite {
+struct AbilityEvictionInfo {
+    const char *bundleName = nullptr;
+    // bytes the record holds: the record itself, its want data and resident saved data
+    uint32_t footprint = 0;
+    // milliseconds since the ability was last in the foreground
+    uint32_t idleTime = 0;
+    bool isTemporary = false;
+    // the eviction makes room under the memory budget rather than in the full ability list
+    bool overBudget = false;
+};
+
+class AbilityEvictionPolicy {
+public:
+    AbilityEvictionPolicy() = default;
+
+    virtual ~AbilityEvictionPolicy() = default;
+
+    // the candidate with the highest score is evicted first, a negative score keeps the record
+    virtual int32_t GetEvictionScore(const AbilityEvictionInfo &info) = 0;
+};
+} // AbilitySlite
+} // namespace OHOS
+#endif // OHOS_ABILITY_SLITE_ABILITY_EVICTION_POLICY_H
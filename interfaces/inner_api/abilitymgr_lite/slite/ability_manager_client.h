@@ -18,6 +18,7 @@
 
 #include <stdint.h>
 
+#include "ability_eviction_policy.h"
 #include "ability_record_observer.h"
 #include "mission_info.h"
 
@@ -30,6 +31,9 @@ public:
     void AddAbilityRecordObserver(AbilityRecordObserver *observer);
     void RemoveAbilityRecordObserver(AbilityRecordObserver *observer);
 
+    /* replaces the eviction policy of the ability stack, nullptr restores the default one */
+    void SetAbilityEvictionPolicy(AbilityEvictionPolicy *policy);
+
     int32_t TerminateAll(const char* excludedBundleName);
 
     MissionInfoList *GetMissionInfos(uint32_t maxNum = 0) const;
@@ -80,6 +80,42 @@ void SetCleanAbilityDataFlag(bool cleanFlag);
 
 bool GetCleanAbilityDataFlag(void);
 
+/**
+ * @brief Dump the recorded lifecycle transitions, newest first.
+ *
+ * @param buffer Indicates the buffer to write the text to.
+ * @param size Indicates the size of the buffer.
+ * @return Returns the length of the text written to the buffer.
+ */
+uint32_t DumpAbilityTrace(char *buffer, uint32_t size);
+
+/**
+ * @brief Dump the depth of the queue of ability operations waiting for the running one, and how many were coalesced.
+ *
+ * @param buffer Indicates the buffer to write the text to.
+ * @param size Indicates the size of the buffer.
+ * @return Returns the length of the text written to the buffer.
+ */
+uint32_t DumpAbilityOperationStat(char *buffer, uint32_t size);
+
+/**
+ * @brief Export the recorded lifecycle transitions in Chrome trace-event JSON format.
+ *
+ * @param buffer Indicates the buffer to write the JSON to.
+ * @param size Indicates the size of the buffer.
+ * @return Returns the length of the JSON written to the buffer, returns <b>0</b> if the buffer is too small.
+ */
+uint32_t ExportAbilityTrace(char *buffer, uint32_t size);
+
+/**
+ * @brief Dump the usage, high-water marks and heap fallbacks of the ability message memory pools.
+ *
+ * @param buffer Indicates the buffer to write the text to.
+ * @param size Indicates the size of the buffer.
+ * @return Returns the length of the text written to the buffer.
+ */
+uint32_t DumpAbilityMemPool(char *buffer, uint32_t size);
+
 #ifdef __cplusplus
 #if __cplusplus
 }
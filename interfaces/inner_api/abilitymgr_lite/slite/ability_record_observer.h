@@ -16,6 +16,7 @@
 #ifndef OHOS_ABILITY_SLITE_ABILITY_RECORD_OBSERVER_H
 #define OHOS_ABILITY_SLITE_ABILITY_RECORD_OBSERVER_H
 
+#include "ability_eviction_policy.h"
 #include "ability_record_state_data.h"
 
 namespace OHOS {
@@ -29,6 +30,8 @@ public:
     virtual void OnAbilityRecordStateChanged(const AbilityRecordStateData &data) {}
 
     virtual void OnAbilityRecordCleanup(char *appName) {}
+
+    virtual void OnAbilityRecordEvicted(const AbilityEvictionInfo &info) {}
 };
 } // AbilitySlite
 } // namespace OHOS
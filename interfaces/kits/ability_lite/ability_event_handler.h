@@ -41,9 +41,11 @@
 #ifndef OHOS_ABILITY_EVENT_HANDLER_H
 #define OHOS_ABILITY_EVENT_HANDLER_H
 
+#include <cstdint>
 #include <functional>
 #include <pthread.h>
-#include <queue>
+
+#include "ability_event_task.h"
 
 namespace OHOS {
 /**
@@ -57,6 +59,19 @@ class AbilityEventHandler {
 public:
     using Task = std::function<void()>;
 
+    /**
+     * @brief Enumerates the priorities of posted tasks. Tasks of a higher priority run before any pending task of a
+     *        lower priority, tasks of the same priority run in posting order.
+     */
+    enum class TaskPriority : uint8_t {
+        /** Lifecycle transactions scheduled by the system */
+        HIGH = 0,
+        /** Tasks posted by applications */
+        DEFAULT,
+        /** Maintenance work such as dumping */
+        LOW,
+    };
+
     AbilityEventHandler();
     ~AbilityEventHandler();
 
@@ -69,11 +84,58 @@ public:
      * @brief Posts a task to an asynchronous thread.
      *
      * @param task Indicates the task to post.
+     * @return Returns <b>true</b> if the task is queued; returns <b>false</b> if too many tasks are pending.
+     */
+    bool PostTask(const Task &task);
+
+    /**
+     * @brief Posts a task with the given priority to an asynchronous thread.
+     *
+     * @param task Indicates the task to post.
+     * @param priority Indicates the priority of the task.
+     * @return Returns <b>true</b> if the task is queued; returns <b>false</b> if too many tasks are pending.
+     */
+    bool PostTask(const Task &task, TaskPriority priority);
+
+    /**
+     * @brief Posts a move-only task to an asynchronous thread. The task is moved into the queue without being copied,
+     *        if the task cannot be queued it is destroyed together with the resources it owns.
+     *
+     * @param task Indicates the task to post.
+     * @param priority Indicates the priority of the task.
+     * @return Returns <b>true</b> if the task is queued; returns <b>false</b> if too many tasks are pending.
+     */
+    bool PostTask(AbilityEventTask &&task, TaskPriority priority = TaskPriority::DEFAULT);
+
+    /**
+     * @brief Posts a task that runs once after the given delay.
+     *
+     * @param task Indicates the task to post.
+     * @param delayMs Indicates the delay, in milliseconds.
+     * @return Returns the timer ID that can be passed to {@link RemoveTimerTask}, or <b>0</b> if posting fails.
+     */
+    uint32_t PostDelayedTask(const Task &task, uint32_t delayMs);
+
+    /**
+     * @brief Posts a task that runs after the given delay and then periodically until it is removed.
+     *
+     * @param task Indicates the task to post.
+     * @param delayMs Indicates the delay before the first run, in milliseconds.
+     * @param intervalMs Indicates the period, in milliseconds. The value must be greater than <b>0</b>.
+     * @return Returns the timer ID that can be passed to {@link RemoveTimerTask}, or <b>0</b> if posting fails.
+     */
+    uint32_t PostTimerTask(const Task &task, uint32_t delayMs, uint32_t intervalMs);
+
+    /**
+     * @brief Removes a delayed or periodic task that has not run yet, a removed periodic task never runs again.
+     *
+     * @param timerId Indicates the timer ID returned by {@link PostDelayedTask} or {@link PostTimerTask}.
      */
-    void PostTask(const Task &task);
+    void RemoveTimerTask(uint32_t timerId);
 
     /**
-     * @brief Quits the event loop of the current thread.
+     * @brief Quits the event loop of the current thread after the tasks posted before. If the quit task cannot be
+     *        queued, the event loop quits after the task it is running.
      */
     void PostQuit();
 
@@ -83,13 +145,25 @@ public:
      * @return Returns the pointer to the {@link AbilityEventHandler} object of the current thread.
      */
     static AbilityEventHandler* GetCurrentHandler();
-private:
-    std::queue<Task> taskQueue_;
 
-    pthread_cond_t pthreadCond_ = PTHREAD_COND_INITIALIZER;
-    pthread_mutex_t queueMutex_ = PTHREAD_MUTEX_INITIALIZER;
+    /**
+     * @brief Obtains the number of tasks accepted by {@link PostTask} since the event handler was created.
+     *
+     * @return Returns the number of posted tasks.
+     */
+    uint64_t GetPostedTaskCount() const;
 
-    bool quit_ { false };
+    /**
+     * @brief Obtains the number of tasks posted by {@link PostTask} and executed by {@link Run} since the event
+     *        handler was created. Delayed and periodic tasks are not counted.
+     *
+     * @return Returns the number of executed tasks.
+     */
+    uint64_t GetExecutedTaskCount() const;
+private:
+    /* the queues live behind the pointer, so that changing them does not change the layout of this class */
+    struct Impl;
+    Impl *impl_ { nullptr };
 
     AbilityEventHandler(const AbilityEventHandler&) = delete;
     AbilityEventHandler& operator = (const AbilityEventHandler&) = delete;
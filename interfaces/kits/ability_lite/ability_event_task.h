@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup AbilityKit
+ * @{
+ *
+ * @brief Provides ability-related functions, including ability lifecycle callbacks and functions for connecting to or
+ *        disconnecting from Particle Abilities.
+ *
+ * @since 1.0
+ * @version 1.0
+ */
+
+/**
+ * @file ability_event_task.h
+ *
+ * @brief Declares the move-only task type that can be posted to an {@link AbilityEventHandler}.
+ *
+ * @since 1.0
+ * @version 1.0
+ */
+
+#ifndef OHOS_ABILITY_EVENT_TASK_H
+#define OHOS_ABILITY_EVENT_TASK_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace OHOS {
+/**
+ * @brief Holds a callable that runs once on the event handler thread.
+ *
+ * Unlike <b>std::function</b>, an <b>AbilityEventTask</b> only needs its callable to be movable, so a task can own
+ * resources such as a deserialized <b>Want</b>. Callables of up to {@link INLINE_SIZE} bytes are stored inline
+ * without a heap allocation.
+ *
+ * @since 1.0
+ * @version 1.0
+ */
+class AbilityEventTask {
+public:
+    /**
+     * Size of the inline storage, large enough for a lambda that captures a <b>Want</b> and a few scalars.
+     */
+    static constexpr size_t INLINE_SIZE = 80;
+
+    AbilityEventTask() = default;
+
+    AbilityEventTask(std::nullptr_t) {}
+
+    /**
+     * @brief Creates a task that owns the given callable.
+     *
+     * @param callable Indicates the callable to run, it is moved into the task when passed as an rvalue.
+     */
+    template<typename F, typename = typename std::enable_if<
+        !std::is_same<typename std::decay<F>::type, AbilityEventTask>::value>::type>
+    explicit AbilityEventTask(F &&callable)
+    {
+        using Callable = typename std::decay<F>::type;
+        if (sizeof(Callable) <= INLINE_SIZE && alignof(Callable) <= alignof(std::max_align_t) &&
+            std::is_nothrow_move_constructible<Callable>::value) {
+            new (storage_) Callable(std::forward<F>(callable));
+            ops_ = &InlineOps<Callable>::OPS;
+            return;
+        }
+        Callable *heapCallable = new (std::nothrow) Callable(std::forward<F>(callable));
+        if (heapCallable != nullptr) {
+            *reinterpret_cast<Callable **>(storage_) = heapCallable;
+            ops_ = &HeapOps<Callable>::OPS;
+        }
+    }
+
+    AbilityEventTask(AbilityEventTask &&other) noexcept
+    {
+        MoveFrom(other);
+    }
+
+    AbilityEventTask &operator=(AbilityEventTask &&other) noexcept
+    {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    AbilityEventTask &operator=(std::nullptr_t)
+    {
+        Reset();
+        return *this;
+    }
+
+    ~AbilityEventTask()
+    {
+        Reset();
+    }
+
+    /**
+     * @brief Runs the callable, an empty task does nothing.
+     */
+    void operator()()
+    {
+        if (ops_ != nullptr) {
+            ops_->invoke(storage_);
+        }
+    }
+
+    /**
+     * @brief Checks whether the task holds a callable.
+     *
+     * @return Returns <b>true</b> if the task holds a callable; returns <b>false</b> otherwise.
+     */
+    explicit operator bool() const
+    {
+        return ops_ != nullptr;
+    }
+
+private:
+    struct Ops {
+        void (*invoke)(void *storage);
+        void (*move)(void *dst, void *src);
+        void (*destroy)(void *storage);
+    };
+
+    template<typename Callable>
+    struct InlineOps {
+        static void Invoke(void *storage)
+        {
+            (*static_cast<Callable *>(storage))();
+        }
+
+        static void Move(void *dst, void *src)
+        {
+            new (dst) Callable(std::move(*static_cast<Callable *>(src)));
+            static_cast<Callable *>(src)->~Callable();
+        }
+
+        static void Destroy(void *storage)
+        {
+            static_cast<Callable *>(storage)->~Callable();
+        }
+
+        static constexpr Ops OPS = { Invoke, Move, Destroy };
+    };
+
+    template<typename Callable>
+    struct HeapOps {
+        static void Invoke(void *storage)
+        {
+            (**static_cast<Callable **>(storage))();
+        }
+
+        static void Move(void *dst, void *src)
+        {
+            *static_cast<Callable **>(dst) = *static_cast<Callable **>(src);
+        }
+
+        static void Destroy(void *storage)
+        {
+            delete *static_cast<Callable **>(storage);
+        }
+
+        static constexpr Ops OPS = { Invoke, Move, Destroy };
+    };
+
+    void MoveFrom(AbilityEventTask &other)
+    {
+        if (other.ops_ != nullptr) {
+            other.ops_->move(storage_, other.storage_);
+            ops_ = other.ops_;
+            other.ops_ = nullptr;
+        }
+    }
+
+    void Reset()
+    {
+        if (ops_ != nullptr) {
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char storage_[INLINE_SIZE];
+    const Ops *ops_ { nullptr };
+
+    AbilityEventTask(const AbilityEventTask &) = delete;
+    AbilityEventTask &operator=(const AbilityEventTask &) = delete;
+};
+
+template<typename Callable>
+constexpr typename AbilityEventTask::Ops AbilityEventTask::InlineOps<Callable>::OPS;
+
+template<typename Callable>
+constexpr typename AbilityEventTask::Ops AbilityEventTask::HeapOps<Callable>::OPS;
+} // namespace OHOS
+#endif // OHOS_ABILITY_EVENT_TASK_H
@@ -45,9 +45,11 @@
 #ifndef OHOS_ABILITY_LOADER_H
 #define OHOS_ABILITY_LOADER_H
 
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "ability.h"
 #ifdef ABILITY_WINDOW_SUPPORT
@@ -60,6 +62,72 @@ using CreateAbility = std::function<Ability *(void)>;
 using CreateSlice = std::function<AbilitySlice *(void)>;
 #endif
 
+/**
+ * @brief Defines a class name and its creator emitted by {@link REGISTER_AA} or {@link REGISTER_AS}.
+ *
+ * The entries of a library are placed in one linker section, so registering them needs no heap memory.
+ */
+template<typename T>
+struct LoaderEntry {
+    const char *name;
+    T *(*create)();
+};
+
+/**
+ * @brief Defines the range of entries one library placed in its linker section.
+ *
+ * {@link REGISTER_AA} and {@link REGISTER_AS} emit a node, a constructor linking it into the loader and a destructor
+ * unlinking it for every class they register. All nodes of a library span the same section, so only the first one
+ * is linked.
+ */
+template<typename T>
+struct LoaderSection {
+    const LoaderEntry<T> *begin;
+    const LoaderEntry<T> *end;
+    LoaderSection<T> *next;
+};
+
+/**
+ * @brief Looks up the entries of every linked {@link LoaderSection} by class name.
+ *
+ * A minimal perfect hash is built on the first lookup after a library was loaded or unloaded: the names are hashed
+ * into buckets, and each bucket gets a seed that moves its names into free slots. A lookup hashes the C string at most
+ * twice and compares a single name.
+ */
+template<typename T>
+class LoaderEntryTable {
+public:
+    void AddSection(LoaderSection<T> &section);
+    void RemoveSection(LoaderSection<T> &section);
+    const LoaderEntry<T> *Find(const char *name);
+
+private:
+    void Build();
+    bool Place(const std::vector<const LoaderEntry<T> *> &entries, size_t slotCount);
+
+    LoaderSection<T> *sections_ { nullptr };
+    std::vector<const LoaderEntry<T> *> slots_ {};
+    std::vector<int32_t> seeds_ {};
+    bool dirty_ { false };
+};
+
+using AbilityEntry = LoaderEntry<Ability>;
+using AbilitySection = LoaderSection<Ability>;
+#ifdef ABILITY_WINDOW_SUPPORT
+using AbilitySliceEntry = LoaderEntry<AbilitySlice>;
+using AbilitySliceSection = LoaderSection<AbilitySlice>;
+#endif
+
+// bounds of the entry sections the linker defines in every library that registers a class
+extern "C" {
+extern const AbilityEntry __start_ohos_ability_entries[] __attribute__((weak, visibility("hidden")));
+extern const AbilityEntry __stop_ohos_ability_entries[] __attribute__((weak, visibility("hidden")));
+#ifdef ABILITY_WINDOW_SUPPORT
+extern const AbilitySliceEntry __start_ohos_slice_entries[] __attribute__((weak, visibility("hidden")));
+extern const AbilitySliceEntry __stop_ohos_slice_entries[] __attribute__((weak, visibility("hidden")));
+#endif
+}
+
 /**
  * @brief Declares functions for registering the class names of {@link Ability} and {@link AbilitySlice} with the
  *        ability management framework.
@@ -79,10 +147,16 @@ public:
 
     void RegisterAbility(const std::string &abilityName, const CreateAbility &createFunc);
     Ability *GetAbilityByName(const std::string &abilityName);
+    Ability *GetAbilityByName(const char *abilityName);
+    void AddAbilitySection(AbilitySection &section);
+    void RemoveAbilitySection(AbilitySection &section);
 
 #ifdef ABILITY_WINDOW_SUPPORT
     void RegisterAbilitySlice(const std::string &sliceName, const CreateSlice &createFunc);
     AbilitySlice *GetAbilitySliceByName(const std::string &sliceName);
+    AbilitySlice *GetAbilitySliceByName(const char *sliceName);
+    void AddAbilitySliceSection(AbilitySliceSection &section);
+    void RemoveAbilitySliceSection(AbilitySliceSection &section);
 #endif
 
 private:
@@ -92,8 +166,15 @@ private:
     AbilityLoader(AbilityLoader &&) = delete;
     AbilityLoader &operator=(AbilityLoader &&) = delete;
 
+    Ability *NewAbility(const char *abilityName);
+#ifdef ABILITY_WINDOW_SUPPORT
+    AbilitySlice *NewAbilitySlice(const char *sliceName);
+#endif
+
+    LoaderEntryTable<Ability> abilityTable_;
     std::unordered_map<std::string, CreateAbility> abilities_;
 #ifdef ABILITY_WINDOW_SUPPORT
+    LoaderEntryTable<AbilitySlice> sliceTable_;
     std::unordered_map<std::string, CreateSlice> slices_;
 #endif
 };
@@ -107,10 +188,24 @@ private:
  * @param className Indicates the {@link Ability} class name to register.
  */
 #define REGISTER_AA(className)                                                                \
-    __attribute__((constructor)) void RegisterAA##className() {                               \
-        AbilityLoader::GetInstance().RegisterAbility(#className, []()->Ability* {             \
-            return new className;                                                             \
-        });                                                                                   \
+    static Ability *CreateAA##className()                                                     \
+    {                                                                                         \
+        return new className;                                                                 \
+    }                                                                                         \
+    __attribute__((used, section("ohos_ability_entries")))                                    \
+    static const AbilityEntry g_abilityEntry##className = {                                   \
+        #className, CreateAA##className                                                       \
+    };                                                                                        \
+    static AbilitySection g_abilitySection##className = {                                     \
+        __start_ohos_ability_entries, __stop_ohos_ability_entries, nullptr                    \
+    };                                                                                        \
+    __attribute__((constructor)) static void RegisterAA##className()                          \
+    {                                                                                         \
+        AbilityLoader::GetInstance().AddAbilitySection(g_abilitySection##className);          \
+    }                                                                                         \
+    __attribute__((destructor)) static void UnregisterAA##className()                         \
+    {                                                                                         \
+        AbilityLoader::GetInstance().RemoveAbilitySection(g_abilitySection##className);       \
     }
 
 /**
@@ -123,10 +218,24 @@ private:
  */
 #ifdef ABILITY_WINDOW_SUPPORT
 #define REGISTER_AS(className)                                                                \
-    __attribute__((constructor)) void RegisterAS##className() {                               \
-        AbilityLoader::GetInstance().RegisterAbilitySlice(#className, []()->AbilitySlice* {   \
-            return new className;                                                             \
-        });                                                                                   \
+    static AbilitySlice *CreateAS##className()                                                \
+    {                                                                                         \
+        return new className;                                                                 \
+    }                                                                                         \
+    __attribute__((used, section("ohos_slice_entries")))                                      \
+    static const AbilitySliceEntry g_sliceEntry##className = {                                \
+        #className, CreateAS##className                                                       \
+    };                                                                                        \
+    static AbilitySliceSection g_sliceSection##className = {                                  \
+        __start_ohos_slice_entries, __stop_ohos_slice_entries, nullptr                        \
+    };                                                                                        \
+    __attribute__((constructor)) static void RegisterAS##className()                          \
+    {                                                                                         \
+        AbilityLoader::GetInstance().AddAbilitySliceSection(g_sliceSection##className);       \
+    }                                                                                         \
+    __attribute__((destructor)) static void UnregisterAS##className()                         \
+    {                                                                                         \
+        AbilityLoader::GetInstance().RemoveAbilitySliceSection(g_sliceSection##className);    \
     }
 #endif
 } // namespace OHOS
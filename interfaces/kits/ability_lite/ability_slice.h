@@ -63,7 +63,7 @@ class AbilitySliceManager;
 class AbilitySlice : public AbilityContext {
 public:
     AbilitySlice() = default;
-    virtual ~AbilitySlice() = default;
+    virtual ~AbilitySlice();
 
     /**
      * @brief Called when this ability slice is started. You must override this function if you want to perform some
@@ -122,6 +122,17 @@ public:
      */
     void Present(AbilitySlice &abilitySlice, const Want &want);
 
+    /**
+     * @brief Presents an ability slice registered with {@link REGISTER_AS} by its class name.
+     *
+     * The ability slice is created by the framework, which also destroys it once it is stopped. If a stopped slice of
+     * that class called {@link SetReusable}, it is started again instead of creating a new one.
+     *
+     * @param sliceName Indicates the class name of the target ability slice.
+     * @param want Indicates the {@link Want} structure containing startup information about the target ability slice.
+     */
+    void Present(const std::string &sliceName, const Want &want);
+
     /**
      * @brief Destroys this ability slice.
      *
@@ -139,6 +150,18 @@ public:
      * @param rootView Indicates the pointer to the custom layout view you have created.
      */
     void SetUIContent(RootView *rootView);
+
+    /**
+     * @brief Sets whether this ability slice is kept for reuse after it is stopped.
+     *
+     * Only ability slices the framework created by class name, such as the main route and slices presented by name,
+     * are kept. A kept slice is started again from {@link OnStart} when its class is needed next, with its members
+     * and its UI layout intact, so it can pass the existing layout to {@link SetUIContent} instead of rebuilding it.
+     * The number of kept slices is bounded, the slice stopped longest ago is destroyed first.
+     *
+     * @param reusable Specifies whether to keep this ability slice after it is stopped.
+     */
+    void SetReusable(bool reusable);
 private:
     void Init(AbilitySliceManager &abilitySliceManager);
     int GetState() const;
@@ -148,6 +171,7 @@ private:
     int sliceState_ { 0 };
 
     friend class AbilitySliceScheduler;
+    friend class AbilitySlicePool;
 };
 } // namespace OHOS
 #endif // OHOS_ABILITY_SLICE_H
\ No newline at end of file
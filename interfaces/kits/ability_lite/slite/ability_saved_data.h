@@ -50,11 +50,37 @@ public:
 
     void Reset();
 
+    /* replaces the resident data with a compressed image, it is expanded again on the next access or Restore */
+    SavedResultCode Compress();
+
+    /* compresses the data and, if a saved data directory is configured, moves the image to the bundle's file */
+    SavedResultCode Spill(const char *bundleName);
+
+    /* takes over the file a previous record of the bundle spilled in this boot, NO_DATA if there is none */
+    SavedResultCode Attach(const char *bundleName);
+
+    /* brings compressed or spilled data back to RAM */
+    SavedResultCode Restore();
+
+    /* keeps the spilled file when this object is deleted, so the next record of the bundle can attach it */
+    void Persist();
+
+    /* bytes of saved data held in RAM, raw or compressed */
+    uint32_t GetResidentSize() const;
+
 private:
+    SavedResultCode Unpack(const void *image, uint16_t imageSize);
+    SavedResultCode LoadSpillFile();
+    void ReleaseSpillFile(bool remove);
+
     void *savedData = nullptr;
     void *userSavedData = nullptr;
+    void *packedData = nullptr;
+    char *spillPath = nullptr;
     uint16_t savedDataSize = 0;
     uint16_t userSavedDataSize = 0;
+    uint16_t packedDataSize = 0;
+    bool keepSpillFile = false;
     SavedResultCode savedResult = SavedResultCode::SAVED_RESULT_NO_DATA;
 };
 } // namespace AbilitySlite
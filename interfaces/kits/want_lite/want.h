@@ -85,6 +85,83 @@ typedef struct {
 #endif
 } Want;
 
+/**
+ * @brief Describes one key-value parameter carried in the <b>data</b> of a {@link Want}.
+ *
+ * The key and value point into the data buffer of the <b>Want</b> they were read from. They are not null-terminated
+ * and stay valid only until the data of that <b>Want</b> is modified or released.
+ */
+typedef struct {
+    /**
+     * Pointer to the key, which is not null-terminated
+     */
+    const char *key;
+
+    /**
+     * Key length
+     */
+    uint8_t keyLen;
+
+    /**
+     * Type of the value, either {@link WANT_PARAM_INT_TYPE} or {@link WANT_PARAM_STRING_TYPE}
+     */
+    uint8_t valueType;
+
+    /**
+     * Pointer to the raw value bytes
+     */
+    const void *value;
+
+    /**
+     * Value length
+     */
+    uint8_t valueLen;
+} WantParam;
+
+/**
+ * @brief Iterates over the key-value parameters carried in the <b>data</b> of a {@link Want} without copying them.
+ */
+typedef struct {
+    const uint8_t *data;
+    uint16_t dataLength;
+    uint16_t offset;
+} WantParamIterator;
+
+/**
+ * @brief Index of the key-value parameters carried in a {@link Want}, used to look up wants carrying many parameters.
+ *
+ * The index refers to the data buffer of the <b>Want</b> it was built from and must be rebuilt once that data changes.
+ */
+typedef struct {
+    const uint8_t *data;
+    uint16_t dataLength;
+    uint16_t *slots;
+    uint16_t slotNum;
+} WantParamIndex;
+
+/**
+ * Value type of the parameters set by {@link SetIntParam}.
+ */
+#define WANT_PARAM_INT_TYPE 6
+
+/**
+ * Value type of the parameters set by {@link SetStrParam}.
+ */
+#define WANT_PARAM_STRING_TYPE 13
+
+/**
+ * @brief Builds the key-value parameters of a {@link Want} in one growable buffer.
+ *
+ * Reserve the expected size with {@link InitWantBuilder}, add parameters, and hand the buffer over to the
+ * <b>Want</b> with {@link CommitWantBuilder}. This avoids the copy of the whole want data that
+ * {@link SetIntParam} and {@link SetStrParam} perform on every call.
+ */
+typedef struct {
+    uint8_t *buffer;
+    uint16_t length;
+    uint16_t capacity;
+} WantBuilder;
+
 #ifdef __cplusplus
 #if __cplusplus
 extern "C" {
@@ -125,6 +202,158 @@ bool SetIntParam(Want *want, const char *key, uint8_t keyLen, int32_t value);
  */
 bool SetStrParam(Want *want, const char *key, uint8_t keyLen, const char *value, uint8_t valueLen);
 
+/**
+ * @brief Initializes an iterator over the key-value parameters carried in a specified <b>Want</b> object.
+ *
+ * @param iterator Indicates the pointer to the iterator to initialize.
+ * @param want Indicates the pointer to the <b>Want</b> object whose parameters are to be read.
+ */
+void InitWantParamIterator(WantParamIterator *iterator, const Want *want);
+
+/**
+ * @brief Reads the next key-value parameter from an iterator initialized by {@link InitWantParamIterator}.
+ *
+ * Records that are not key-value parameters are skipped. No memory is allocated, <b>param</b> points into the data
+ * of the <b>Want</b> object.
+ *
+ * @param iterator Indicates the pointer to the iterator.
+ * @param param Indicates the pointer to the parameter to fill in.
+ *
+ * @return Returns <b>true</b> if a parameter is read; returns <b>false</b> if there are no more valid parameters.
+ */
+bool NextWantParam(WantParamIterator *iterator, WantParam *param);
+
+/**
+ * @brief Obtains the int value of a key set by {@link SetIntParam}.
+ *
+ * If the key is set more than once, the first value is returned.
+ *
+ * @param want Indicates the pointer to the <b>Want</b> object to read.
+ * @param key Indicates the pointer to the key to look up.
+ * @param keyLen Indicates the length of key.
+ * @param value Indicates the pointer to the int value to fill in.
+ *
+ * @return Returns <b>true</b> if the key is found and carries an int value; returns <b>false</b> otherwise.
+ */
+bool GetIntParam(const Want *want, const char *key, uint8_t keyLen, int32_t *value);
+
+/**
+ * @brief Obtains the string value of a key set by {@link SetStrParam}.
+ *
+ * The returned value points into the data of the <b>Want</b> object and is not null-terminated.
+ *
+ * @param want Indicates the pointer to the <b>Want</b> object to read.
+ * @param key Indicates the pointer to the key to look up.
+ * @param keyLen Indicates the length of key.
+ * @param value Indicates the pointer to the string value to fill in.
+ * @param valueLen Indicates the pointer to the string value length to fill in.
+ *
+ * @return Returns <b>true</b> if the key is found and carries a string value; returns <b>false</b> otherwise.
+ */
+bool GetStrParam(const Want *want, const char *key, uint8_t keyLen, const char **value, uint8_t *valueLen);
+
+/**
+ * @brief Builds a key index over the parameters carried in a specified <b>Want</b> object.
+ *
+ * After the index is built, {@link GetIntParamByIndex} and {@link GetStrParamByIndex} find a key without scanning the
+ * data again. You should call {@link ClearWantParamIndex} to release the index.
+ *
+ * @param index Indicates the pointer to the index to build.
+ * @param want Indicates the pointer to the <b>Want</b> object to index.
+ *
+ * @return Returns <b>true</b> if the index is built; returns <b>false</b> otherwise.
+ */
+bool BuildWantParamIndex(WantParamIndex *index, const Want *want);
+
+/**
+ * @brief Releases the memory of an index built by {@link BuildWantParamIndex}.
+ *
+ * @param index Indicates the pointer to the index to release.
+ */
+void ClearWantParamIndex(WantParamIndex *index);
+
+/**
+ * @brief Obtains the int value of a key through an index built by {@link BuildWantParamIndex}.
+ *
+ * @param index Indicates the pointer to the index.
+ * @param key Indicates the pointer to the key to look up.
+ * @param keyLen Indicates the length of key.
+ * @param value Indicates the pointer to the int value to fill in.
+ *
+ * @return Returns <b>true</b> if the key is found and carries an int value; returns <b>false</b> otherwise.
+ */
+bool GetIntParamByIndex(const WantParamIndex *index, const char *key, uint8_t keyLen, int32_t *value);
+
+/**
+ * @brief Obtains the string value of a key through an index built by {@link BuildWantParamIndex}.
+ *
+ * @param index Indicates the pointer to the index.
+ * @param key Indicates the pointer to the key to look up.
+ * @param keyLen Indicates the length of key.
+ * @param value Indicates the pointer to the string value to fill in.
+ * @param valueLen Indicates the pointer to the string value length to fill in.
+ *
+ * @return Returns <b>true</b> if the key is found and carries a string value; returns <b>false</b> otherwise.
+ */
+bool GetStrParamByIndex(const WantParamIndex *index, const char *key, uint8_t keyLen, const char **value,
+    uint8_t *valueLen);
+
+/**
+ * @brief Initializes a <b>WantBuilder</b> and reserves its buffer.
+ *
+ * @param builder Indicates the pointer to the builder to initialize.
+ * @param capacity Indicates the number of bytes to reserve. The buffer grows when more parameters are added.
+ *
+ * @return Returns <b>true</b> if the initialization is successful; returns <b>false</b> otherwise.
+ */
+bool InitWantBuilder(WantBuilder *builder, uint16_t capacity);
+
+/**
+ * @brief Adds an int parameter to a <b>WantBuilder</b>, encoded the same way as {@link SetIntParam}.
+ *
+ * @param builder Indicates the pointer to the builder.
+ * @param key Indicates the pointer to the key.
+ * @param keyLen Indicates the length of key.
+ * @param value Indicates the int value, which must not be negative.
+ *
+ * @return Returns <b>true</b> if the parameter is added; returns <b>false</b> otherwise.
+ */
+bool WantBuilderAddIntParam(WantBuilder *builder, const char *key, uint8_t keyLen, int32_t value);
+
+/**
+ * @brief Adds a string parameter to a <b>WantBuilder</b>, encoded the same way as {@link SetStrParam}.
+ *
+ * @param builder Indicates the pointer to the builder.
+ * @param key Indicates the pointer to the key.
+ * @param keyLen Indicates the length of key.
+ * @param value Indicates the pointer to the string value.
+ * @param valueLen Indicates the length of value.
+ *
+ * @return Returns <b>true</b> if the parameter is added; returns <b>false</b> otherwise.
+ */
+bool WantBuilderAddStrParam(WantBuilder *builder, const char *key, uint8_t keyLen, const char *value,
+    uint8_t valueLen);
+
+/**
+ * @brief Hands the parameters of a <b>WantBuilder</b> over to a <b>Want</b> object.
+ *
+ * If the <b>Want</b> carries no data, the builder buffer becomes its data without copying. Otherwise the parameters
+ * are appended to the existing data with one allocation. The builder is empty afterwards.
+ *
+ * @param builder Indicates the pointer to the builder.
+ * @param want Indicates the pointer to the <b>Want</b> object to set.
+ *
+ * @return Returns <b>true</b> if the commit is successful; returns <b>false</b> otherwise.
+ */
+bool CommitWantBuilder(WantBuilder *builder, Want *want);
+
+/**
+ * @brief Releases the memory of a <b>WantBuilder</b> that is not committed.
+ *
+ * @param builder Indicates the pointer to the builder to clear.
+ */
+void ClearWantBuilder(WantBuilder *builder);
+
 /**
  * @brief Sets the <b>element</b> variable for a specified <b>Want</b> object.
  *
@@ -141,6 +370,9 @@ bool SetWantElement(Want *want, ElementName element);
 /**
  * @brief Sets data to carry in a specified <b>Want</b> object for starting a particular ability.
  *
+ * Data larger than 2 KB is passed between processes in shared memory. When <b>data</b> is such data received with
+ * another <b>Want</b>, it is shared instead of copied, and neither <b>Want</b> may modify it.
+ *
  * @param want Indicates the pointer to the <b>Want</b> object to set.
  * @param data Indicates the pointer to the data to set.
  * @param dataLength Indicates the data length to set. The length must be the same as that of the data specified in
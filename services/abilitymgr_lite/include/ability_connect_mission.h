@@ -17,6 +17,9 @@
 #define OHOS_ABILITY_CONNECT_MISSION_H
 
 #include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "page_ability_record.h"
 
@@ -38,8 +41,44 @@ public:
 #endif
     void RemoveConnectRecordByPageToken(uint64_t token, const char *bundleName);
 
+    // called by the service record whenever a connection is added to or removed from it
+    void AddConnectIndex(PageAbilityRecord &service, const AbilityConnectRecord &connectRecord);
+    void RemoveConnectIndex(PageAbilityRecord &service, const AbilityConnectRecord &connectRecord);
+
 private:
+    struct ConnectKey {
+        uint64_t handle;
+        uint64_t sidToken;
+        uint64_t abilityToken;
+
+        bool operator==(const ConnectKey &other) const
+        {
+            return handle == other.handle && sidToken == other.sidToken && abilityToken == other.abilityToken;
+        }
+    };
+
+    struct ConnectKeyHash {
+        size_t operator()(const ConnectKey &key) const
+        {
+            size_t hash = std::hash<uint64_t>()(key.handle);
+            hash = hash * 31 + std::hash<uint64_t>()(key.sidToken);
+            return hash * 31 + std::hash<uint64_t>()(key.abilityToken);
+        }
+    };
+
+    static ConnectKey MakeConnectKey(const SvcIdentity &connectSid, uint64_t abilityToken);
+    static bool MakeAbilityKey(const char *bundleName, const char *abilityName, std::string &key);
+    std::list<PageAbilityRecord *>::iterator EraseServiceRecord(std::list<PageAbilityRecord *>::iterator iterator);
+
     std::list<PageAbilityRecord *> serviceRecords_;
+    std::unordered_map<uint64_t, std::list<PageAbilityRecord *>::iterator> tokenIndex_;
+    // the services of each "bundleName/abilityName", in the order they were pushed
+    std::unordered_map<std::string, std::vector<PageAbilityRecord *>> abilityIndex_;
+    std::unordered_map<std::string, int32_t> bundleServiceCount_;
+    // the services bound by each connection, in connect order, the connections of one process share their sid
+    std::unordered_map<ConnectKey, std::vector<PageAbilityRecord *>, ConnectKeyHash> connectIndex_;
+    // services each page ability is connected to, with the number of its connections to each of them
+    std::unordered_map<uint64_t, std::unordered_map<PageAbilityRecord *, uint32_t>> pageIndex_;
 };
 } // namespace OHOS
 
@@ -30,6 +30,7 @@ class AbilityInnerFeature : public Feature {
 public:
     static int32 StartKeepAliveApps();
     static int32 TerminateApp(const char *bundleName);
+    static int32 InvalidateBundleCache(const char *bundleName);
 
     static int32 Invoke(IServerProxy *iProxy, int funcId, void *origin, IpcIo *req, IpcIo *reply);
 
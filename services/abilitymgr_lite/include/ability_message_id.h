@@ -58,6 +58,8 @@ enum AmsMsgType {
     AMS_TERMINATE_APP,
     AMS_RESTART_APP,
     AMS_DUMP_ABILITY,
+    AMS_TRANSACTION_DONE_BATCH,
+    AMS_BUNDLE_CHANGED,
 #endif
 };
 
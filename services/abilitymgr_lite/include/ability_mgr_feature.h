@@ -62,6 +62,7 @@ private:
     static int32 StopAbilityInvoke(const void *origin, IpcIo *req);
 
     static int32 AbilityTransactionDoneInvoke(const void *origin, IpcIo *req);
+    static int32 AbilityTransactionDoneBatchInvoke(const void *origin, IpcIo *req);
     static int32 AttachBundleInvoke(const void *origin, IpcIo *req);
     static int32 ConnectAbilityDoneInvoke(const void *origin, IpcIo *req);
     static int32 DisconnectAbilityDoneInvoke(const void *origin, IpcIo *req);
@@ -18,6 +18,7 @@
 
 #include "ability_connect_trans_param.h"
 #include "ability_worker.h"
+#include "bundle_manager.h"
 #include "client/ability_dump_client.h"
 #include "client/bundlems_client.h"
 #include "message.h"
@@ -37,6 +38,9 @@ public:
 private:
     AbilityMgrHandler() = default;
     void OnServiceInited();
+    void RegisterBundleStatusCallback();
+    static void OnBundleStateChanged(uint8_t installType, uint8_t resultCode, const void *resultMessage,
+        const char *bundleName, void *data);
     void StartKeepAliveApps();
     void StartKeepAliveApp(const BundleInfo &bundleInfo);
     void StartLauncher();
@@ -44,6 +48,8 @@ private:
     void AttachBundle(AbilityThreadClient *client);
     void TerminateAbility(const uint64_t *token);
     void AbilityTransaction(TransactionState *state);
+    void AbilityTransactionBatch(TransactionState *states, uint32_t count);
+    void OnAbilityTransactionDone(const AbilityMsStatus &status);
     void TerminateApp(const char *bundleName);
     void RestartApp(const char *bundleName);
 
@@ -58,6 +64,7 @@ private:
 
     AbilityWorker abilityWorker_;
     BundleMsClient bundleMsClient_;
+    BundleStatusCallback bundleStatusCallback_ {};
 };
 } // namespace OHOS
 #endif // OHOS_ABILITY_MANAGER_SERVICE_IMPL_H
@@ -29,6 +29,7 @@ public:
     ~AbilityMissionRecord();
     bool IsEmpty() const;
     bool IsSameMissionRecord(const char *bundleName) const;
+    const char *GetBundleName() const;
     void SetMissionStack(AbilityMissionStack *missionStack);
     const AbilityMissionStack *GetMissionStack() const;
     const PageAbilityRecord *GetTopPageAbility() const;
@@ -42,11 +43,22 @@ public:
     void ClearPageAbility(AbilityConnectMission *connectMission);
     void SetPrevMissionRecord(const AbilityMissionRecord *missionRecord);
     const AbilityMissionRecord *GetPrevMissionRecord() const;
+    void ClearNextMissionRecords();
 #ifdef OHOS_DEBUG
     AbilityMsStatus DumpMissionRecord() const;
 #endif
 private:
+    friend class AbilityMissionStack;
+
     AbilityMissionStack *abilityMissionStack_ { nullptr };
+    // intrusive links of the mission stack, maintained by AbilityMissionStack only
+    AbilityMissionRecord *lowerMissionRecord_ { nullptr };
+    AbilityMissionRecord *upperMissionRecord_ { nullptr };
+    bool isInStack_ { false };
+    // missions whose prev mission is this one, linked through their siblings
+    AbilityMissionRecord *firstNextMissionRecord_ { nullptr };
+    AbilityMissionRecord *prevSiblingMissionRecord_ { nullptr };
+    AbilityMissionRecord *nextSiblingMissionRecord_ { nullptr };
     std::list<PageAbilityRecord *> pageAbilityRecords_;
     const AbilityMissionRecord *prevMissionRecord_ { nullptr };
     const char *bundleName_ { nullptr };
@@ -16,7 +16,8 @@
 #ifndef OHOS_ABILITY_MISSION_STACK_H
 #define OHOS_ABILITY_MISSION_STACK_H
 
-#include <list>
+#include <string>
+#include <unordered_map>
 
 #include "ability_connect_mission.h"
 #include "ability_mission_record.h"
@@ -46,8 +47,16 @@ public:
 #ifdef OHOS_DEBUG
     AbilityMsStatus DumpMissionStack() const;
 #endif
+    uint32_t GetMissionRecordCount() const;
 private:
-    std::list<AbilityMissionRecord *> missionRecords_;
+    void LinkTop(AbilityMissionRecord &missionRecord);
+    void Unlink(AbilityMissionRecord &missionRecord);
+
+    // intrusive list from the bottom to the top mission, bundleIndex_ finds a mission without walking it
+    AbilityMissionRecord *bottomMissionRecord_ { nullptr };
+    AbilityMissionRecord *topMissionRecord_ { nullptr };
+    uint32_t missionRecordCount_ { 0 };
+    std::unordered_map<std::string, AbilityMissionRecord *> bundleIndex_;
     StackType stackType_;
 };
 }  // namespace OHOS
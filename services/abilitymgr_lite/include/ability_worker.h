@@ -33,7 +33,7 @@ public:
     AbilityMsStatus AbilityTransaction(const TransactionState &state);
     AbilityMsStatus TerminateApp(const char *bundleName);
     AbilityMsStatus RestartApp(const BundleInfo &bundleInfo);
-    AbilityMsStatus DumpAbility(const AbilityDumpClient &client);
+    AbilityMsStatus DumpAbility(const AbilityDumpClient &client, const char *extraInfo);
 
     AbilityMsStatus TerminateService(const AbilityInfo &target, const BundleInfo &bundleInfo, pid_t callingUid);
     AbilityMsStatus ConnectAbility(const AbilityConnectTransParam &connectParam, const AbilityInfo &target,
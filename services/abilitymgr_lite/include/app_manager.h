@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_APP_MANAGER_H
 #define FOUNDATION_APP_MANAGER_H
 
+#include <string>
 #include <vector>
 
 #include "app_record.h"
@@ -23,7 +24,18 @@
 #include "client/app_spawn_client.h"
 #include "nocopyable.h"
 
+#ifndef BOOT_SPAWN_WORKERS
+#define BOOT_SPAWN_WORKERS 4
+#endif
+
 namespace OHOS {
+struct AppBootTiming {
+    std::string bundleName;
+    uint64_t spawnMs;
+    uint64_t startMs;
+    bool spawned;
+};
+
 class AppManager : public NoCopyable {
 public:
     static AppManager &GetInstance()
@@ -33,15 +45,32 @@ public:
     }
     ~AppManager() = default;
     AppRecord *StartAppProcess(const BundleInfo &bundleInfo);
+    /* spawns the processes of bundleInfos on up to BOOT_SPAWN_WORKERS threads, registered in bundleInfos order */
+    void StartAppProcesses(const std::vector<const BundleInfo *> &bundleInfos, std::vector<AppBootTiming> &timings);
+    void SetBootReport(std::vector<AppBootTiming> &&timings, uint64_t totalMs);
     AbilityMsStatus TerminateAppProcess(const char *bundleName);
     const AppRecord *GetAppRecordByToken(uint64_t token, pid_t callingPid);
     AppRecord *GetAppRecordByBundleName(const char *bundleName);
     void RemoveAppRecord(const AppRecord &appRecord);
     void RemoveAppRecord(const char *bundleName);
+    void OnAppAttached(const AppRecord &appRecord);
+    AbilityMsStatus DumpSpawnInfo() const;
 private:
+    struct AttachStat {
+        uint32_t count;
+        uint64_t totalMs;
+        uint64_t maxMs;
+    };
+
     AppManager() = default;
+    static void DumpAttachStat(const AttachStat &stat, std::string &info);
+    void DumpBootReport(std::string &info) const;
+
     AppSpawnClient spawnClient_;
+    AttachStat attachStat_ {};
     std::vector<AppRecord *> appRecords_;
+    std::vector<AppBootTiming> bootTimings_;
+    uint64_t bootTotalMs_ { 0 };
 };
 } // namespace OHOS
 #endif // FOUNDATION_APP_MANAGER_H
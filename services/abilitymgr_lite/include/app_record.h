@@ -30,17 +30,22 @@ public:
     pid_t GetPid() const;
     uint64_t GetIdentityId() const;
     const BundleInfo &GetBundleInfo() const;
+    void SetSpawnTime(uint64_t spawnTime);
+    uint64_t GetSpawnTime() const;
 
     AbilityMsStatus LoadPermission() const;
     void UnloadPermission() const;
     AbilityMsStatus QueryAppCapability(const char *bundleName, uint32_t **caps, uint32_t *capNums);
     AbilityMsStatus SetAbilityThreadClient(const AbilityThreadClient &client);
+    /* spawned ahead of its ability, not attached yet and with no ability waiting for it */
+    bool IsAwaitingAbility() const;
     AbilityMsStatus AbilityTransaction(const TransactionState &state,
         const Want &want, AbilityType abilityType) const;
     AbilityMsStatus AppInitTransaction() const;
     AbilityMsStatus AppExitTransaction() const;
     AbilityMsStatus DumpAbilityTransaction(const Want &want, uint64_t token) const;
     void SetPendingAbility(PageAbilityRecord *abilityRecord);
+    uint64_t GetPendingAbilityToken() const;
     AbilityMsStatus LaunchPendingAbility();
 
     AbilityMsStatus ConnectTransaction(const Want &want, uint64_t token) const;
@@ -52,6 +57,7 @@ public:
 private:
     pid_t pid_ { 0 };
     uint64_t identityId_ { 0 };
+    uint64_t spawnTime_ { 0 };
     BundleInfo bundleInfo_ {};
     AbilityThreadClient *abilityThreadClient_ { nullptr };
     PageAbilityRecord *pendingAbilityRecord_ { nullptr };
@@ -35,7 +35,8 @@ typedef struct {
 class AbilityRecord;
 class AbilityThreadClient {
 public:
-    AbilityThreadClient(uint64_t token, pid_t callingPid, const SvcIdentity &svcIdentity, OnRemoteDead handler);
+    AbilityThreadClient(uint64_t token, pid_t callingPid, uid_t callingUid, const SvcIdentity &svcIdentity,
+        OnRemoteDead handler);
     AbilityThreadClient(const AbilityThreadClient &client);
     ~AbilityThreadClient();
 
@@ -55,6 +56,8 @@ public:
 private:
     uint64_t token_ = -1;
     pid_t pid_ = -1;
+    // the app process the shared memory of large want data is handed to
+    uid_t uid_ = -1;
     uint32_t cbid_ = -1;
     const SvcIdentity svcIdentity_;
     const OnRemoteDead deathHandler_;
@@ -25,10 +25,12 @@ class AppSpawnClient {
 public:
     AppSpawnClient() = default;
     ~AppSpawnClient() = default;
+    AbilityMsStatus Initialize();
     AbilityMsStatus SpawnProcess(AppRecord &appRecord);
+    AbilityMsStatus PrepareSpawnMessage(AppRecord &appRecord, char *&spawnMessage);
     AbilityMsStatus CallingInnerSpawnProcess(char *spawnMessage, AppRecord &appRecord);
 private:
-    AbilityMsStatus Initialize();
+    static char *BuildSpawnMessage(const AppRecord &appRecord, const uint32_t *capabilities, uint32_t capNums);
     IClientProxy *spawnClient_ { nullptr };
 };
 }
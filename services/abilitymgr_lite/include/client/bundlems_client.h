@@ -16,10 +16,17 @@
 #ifndef OHOS_BUNDLEMS_CLIENT_H
 #define OHOS_BUNDLEMS_CLIENT_H
 
+#include <cstdint>
+
 #include "bundle_inner_interface.h"
 #include "util/abilityms_status.h"
 
 namespace OHOS {
+/*
+ * Queries bundle manager service and keeps the most recently used BundleInfo and AbilityInfo results, so that hot
+ * bundles like the launcher and keep-alive apps are started without a round trip to BMS. Only used on the AMS
+ * thread, so the cache takes no lock.
+ */
 class BundleMsClient {
 public:
     BundleMsClient() = default;
@@ -27,11 +34,51 @@ public:
     AbilityMsStatus Initialize();
 
     AbilityMsStatus QueryAbilityInfo(const Want *want, AbilityInfo *result) const;
+    /* bundleInfo receives a deep copy, the caller releases it with ClearBundleInfo */
     AbilityMsStatus QueryBundleInfo(const char* bundleName, BundleInfo *bundleInfo) const;
     AbilityMsStatus QueryKeepAliveBundleInfos(BundleInfo **bundleInfos, int32_t *len) const;
 
+    /* drops the cached results of bundleName, nullptr drops the results of all bundles */
+    void InvalidateCache(const char *bundleName);
+    AbilityMsStatus DumpCacheInfo() const;
+
 private:
+    struct BundleCacheEntry {
+        BundleInfo bundleInfo;
+        uint32_t generation;
+        uint32_t lastUse;
+        bool valid;
+    };
+
+    struct AbilityCacheEntry {
+        char *bundleName;
+        char *abilityName;
+        AbilityInfo abilityInfo;
+        uint32_t generation;
+        uint32_t lastUse;
+        bool valid;
+    };
+
+    static constexpr uint32_t BUNDLE_CACHE_SIZE = 8;
+    static constexpr uint32_t ABILITY_CACHE_SIZE = 16;
+
+    BundleCacheEntry *FindBundleEntry(const char *bundleName) const;
+    AbilityCacheEntry *FindAbilityEntry(const char *bundleName, const char *abilityName) const;
+    BundleCacheEntry *AcquireBundleEntry() const;
+    AbilityCacheEntry *AcquireAbilityEntry() const;
+    static void ReleaseBundleEntry(BundleCacheEntry &entry);
+    static void ReleaseAbilityEntry(AbilityCacheEntry &entry);
+    static AbilityMsStatus CopyBundleInfoToCaller(const BundleInfo &source, BundleInfo *bundleInfo);
+
     BmsServerProxy *bmsServerProxy_ { nullptr };
+    mutable BundleCacheEntry bundleCache_[BUNDLE_CACHE_SIZE] {};
+    mutable AbilityCacheEntry abilityCache_[ABILITY_CACHE_SIZE] {};
+    mutable uint32_t useClock_ { 0 };
+    uint32_t generation_ { 0 };
+    mutable uint32_t bundleHits_ { 0 };
+    mutable uint32_t bundleMisses_ { 0 };
+    mutable uint32_t abilityHits_ { 0 };
+    mutable uint32_t abilityMisses_ { 0 };
 };
 }
 #endif // OHOS_BUNDLEMS_CLIENT_H
@@ -47,6 +47,7 @@ public:
     // BundleInfo
     const BundleInfo& GetBundleInfo() const;
     void SetBundleInfo(const BundleInfo &bundleInfo);
+    void SetStartCallback(const Want &want);
 
     // LifeCycle
     AbilityMsStatus StartAbility();
@@ -79,6 +80,7 @@ public:
     void RemoveConnectRecord(const SvcIdentity &serviceSid);
     bool IsPerformStop() const;
     AbilityConnectRecord *GetConnectRecord(const SvcIdentity &serviceSid, uint64_t abilityToken) const;
+    const std::list<AbilityConnectRecord *> &GetConnectRecords() const;
 
     AbilityMsStatus StartService();
     AbilityMsStatus ConnectAbility();
@@ -16,13 +16,19 @@
 #ifndef OHOS_ABILITY_SLITE_ABILITY_LIST_H
 #define OHOS_ABILITY_SLITE_ABILITY_LIST_H
 
+#include "ability_eviction_policy.h"
 #include "ability_record.h"
+#include "ability_record_index.h"
 #include "cmsis_os2.h"
 #include "mission_info.h"
 #include "utils_list.h"
 
 namespace OHOS {
 namespace AbilitySlite {
+#ifndef ABILITY_MEMORY_BUDGET
+#define ABILITY_MEMORY_BUDGET 0
+#endif
+
 constexpr char MAIN_BUNDLE_NAME[] = "main";
 const uint32_t LAUNCHER_TOKEN = 0;
 
@@ -60,8 +66,49 @@ public:
 
     static bool IsPermanentAbility(const AbilityRecord &abilityRecord);
 
+    /* nullptr restores the default policy, the policy must outlive its use by the list */
+    void SetEvictionPolicy(AbilityEvictionPolicy *policy);
+
+    /* 0 disables eviction by memory, the list is then bounded by ABILITY_LIST_CAPACITY only */
+    void SetMemoryBudget(uint32_t budget);
+
+    uint32_t GetFootprint() const;
+
+    /* evicts records until the footprint of the list fits the memory budget */
+    void TrimToBudget();
+
 private:
-    List<AbilityRecord *> abilityList_ {};
+    void LinkFront(AbilityRecord *abilityRecord);
+
+    void Unlink(AbilityRecord *abilityRecord);
+
+    bool EvictAbility(uint32_t reserve, bool overBudget);
+
+    void EvictRecord(AbilityRecord *record, const AbilityEvictionInfo &info);
+
+    static AbilityEvictionInfo GetEvictionInfo(const AbilityRecord &abilityRecord, uint32_t now);
+
+    static int32_t GetDefaultEvictionScore(const AbilityEvictionInfo &info);
+
+    static uint32_t TokenHash(const AbilityRecord &abilityRecord);
+
+    static uint32_t BundleNameHash(const AbilityRecord &abilityRecord);
+
+    static bool MatchToken(const AbilityRecord &abilityRecord, const void *key);
+
+    static bool MatchBundleName(const AbilityRecord &abilityRecord, const void *key);
+
+    static bool IsMoreRecent(const AbilityRecord &candidate, const AbilityRecord &current);
+
+    // records are kept in MRU order: head_ is the top ability and tail_ the bottom one
+    AbilityRecord *head_ = nullptr;
+    AbilityRecord *tail_ = nullptr;
+    uint32_t size_ = 0;
+    uint32_t linkSeq_ = 0;
+    AbilityRecordIndex tokenIndex_;
+    AbilityRecordIndex bundleNameIndex_;
+    AbilityEvictionPolicy *evictionPolicy_ = nullptr;
+    uint32_t memoryBudget_ = ABILITY_MEMORY_BUDGET;
     mutable osMutexId_t abilityListMutex_;
 };
 } // AbilitySlite
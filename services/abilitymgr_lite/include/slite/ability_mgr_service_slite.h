@@ -40,6 +40,8 @@ public:
 
     static void *GetMissionInfos(uint32_t maxNum);
 
+    static uint32_t DumpOperationStat(char *buffer, uint32_t size);
+
 private:
     AbilityMgrServiceSlite();
 
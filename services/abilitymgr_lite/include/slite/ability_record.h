@@ -21,6 +21,7 @@
 #include "cmsis_os.h"
 #include "ability_thread.h"
 #include "ability_record_state.h"
+#include "utils_list.h"
 
 namespace OHOS {
 namespace AbilitySlite {
@@ -45,7 +46,14 @@ public:
 
     void SetWantData(const void *wantData, uint16_t wantDataSize);
 
+    /* bytes this record keeps resident, the stack of a live app task included */
+    uint32_t GetFootprint() const;
+
+    /* drops the lifecycle messages still waiting for room in the app task queue */
+    void ClearPendingMsgs();
+
     char *appName = nullptr;
+    uint32_t appNameHash = 0;
     char *appPath = nullptr;
     AbilityData *abilityData = nullptr;
     AbilitySavedData *abilitySavedData = nullptr;
@@ -57,6 +65,18 @@ public:
     uint8_t state = SCHEDULE_STOP;
     bool isTerminated = false;
     bool isNativeApp = false;
+    bool isTemporary = false;
+    // kernel tick of the last transition into or out of the foreground
+    uint32_t lastForegroundTick = 0;
+    // lifecycle messages the full app task queue could not take yet, oldest first
+    List<SliteAbilityInnerMsg *> pendingMsgs;
+    // a queued foreground was dropped for the background behind it, its done is owed to the AMS
+    bool isForegroundSuperseded = false;
+    // intrusive links of the ability list, maintained by AbilityList only
+    AbilityRecord *prev = nullptr;
+    AbilityRecord *next = nullptr;
+    // stamp of the last move to the top of the ability list, a larger one is more recently used
+    uint32_t linkSeq = 0;
 };
 } // namespace AbilitySlite
 } // namespace OHOS
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_SLITE_ABILITY_RECORD_INDEX_H
+#define OHOS_ABILITY_SLITE_ABILITY_RECORD_INDEX_H
+
+#include <cstdint>
+
+#include "ability_record.h"
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace AbilitySlite {
+/**
+ * Open-addressing (linear probing) index over AbilityRecord pointers. The index does not own the records, the
+ * hash of a stored record is recomputed through hashFunc, so the key must not change while the record is indexed.
+ */
+class AbilityRecordIndex : public NoCopyable {
+public:
+    using HashFunc = uint32_t (*)(const AbilityRecord &record);
+    using MatchFunc = bool (*)(const AbilityRecord &record, const void *key);
+    using PreferFunc = bool (*)(const AbilityRecord &candidate, const AbilityRecord &current);
+
+    AbilityRecordIndex(uint32_t capacity, HashFunc hashFunc);
+
+    ~AbilityRecordIndex() override;
+
+    bool Insert(AbilityRecord *record);
+
+    void Remove(const AbilityRecord *record);
+
+    AbilityRecord *Find(uint32_t hash, MatchFunc matchFunc, const void *key) const;
+
+    /* for keys several records share, walks the whole probe sequence and returns the match preferFunc ranks first */
+    AbilityRecord *Find(uint32_t hash, MatchFunc matchFunc, const void *key, PreferFunc preferFunc) const;
+
+    void Clear();
+
+    static uint32_t HashToken(uint16_t token);
+
+    static uint32_t HashBundleName(const char *bundleName);
+
+private:
+    uint32_t HomeSlot(const AbilityRecord &record) const;
+
+    AbilityRecord **slots_ = nullptr;
+    uint32_t mask_ = 0;
+    uint32_t count_ = 0;
+    HashFunc hashFunc_ = nullptr;
+};
+} // namespace AbilitySlite
+} // namespace OHOS
+#endif // OHOS_ABILITY_SLITE_ABILITY_RECORD_INDEX_H
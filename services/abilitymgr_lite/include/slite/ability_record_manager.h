@@ -41,6 +41,20 @@ struct AbilityOperation {
     uint64_t token = 0;
 };
 
+struct AbilityOperationStat {
+    uint32_t queueDepth = 0;
+    uint32_t peakQueueDepth = 0;
+    uint32_t queuedCount = 0;
+    // queued operations removed before they ran because a later request made them redundant
+    uint32_t coalescedCount = 0;
+};
+
+struct AbilityMsgOverflowStat {
+    uint32_t pendingCount = 0;
+    uint32_t overflowCount = 0;
+    uint32_t coalescedCount = 0;
+};
+
 class AbilityRecordManager : public NoCopyable {
 public:
     typedef void (AbilityRecordManager::*LifecycleFunc)(uint16_t token);
@@ -86,9 +100,20 @@ public:
 
     int32_t RunOperation();
 
+    void GetOperationStat(AbilityOperationStat &stat) const;
+
+    uint32_t DumpOperationStat(char *buffer, uint32_t size) const;
+
+    /* hands the lifecycle messages that found an app task queue full to the app tasks with room again */
+    void FlushPendingMsgs();
+
+    void GetMsgOverflowStat(AbilityMsgOverflowStat &stat) const;
+
     int32_t AddAbilityRecordObserver(AbilityRecordObserver *observer);
     int32_t RemoveAbilityRecordObserver(AbilityRecordObserver *observer);
 
+    int32_t SetAbilityEvictionPolicy(AbilityEvictionPolicy *policy);
+
     uint32_t curTask_ = 0;
 
 private:
@@ -106,6 +131,8 @@ private:
 
     int32_t PreCheckStartAbility(const AbilitySvcInfo &info);
 
+    void TraceStartAbility(uint64_t token) const;
+
     bool CheckResponse(const char *bundleName);
 
     int32_t SchedulerLifecycle(uint64_t token, int32_t state);
@@ -130,6 +157,14 @@ private:
 
     int32_t SendMsgToAbilityThread(int32_t state, const AbilityRecord *record);
 
+    int32_t PostMsgToAbilityThread(AbilityRecord &record, SliteAbilityInnerMsg &innerMsg);
+
+    bool FlushPendingMsgs(AbilityRecord &record);
+
+    bool CoalescePendingMsg(AbilityRecord &record, SliteAbilityInnerMsg &innerMsg);
+
+    static void FreePendingMsg(SliteAbilityInnerMsg *innerMsg);
+
     void SetAbilityStateAndNotify(uint64_t token, int32_t state);
 
     void UpdateRecord(AbilitySvcInfo *info);
@@ -148,12 +183,29 @@ private:
 
     int32_t AddAbilityOperation(uint16_t msgId, const Want *want, uint64_t token);
 
+    bool CoalesceAbilityOperation(uint16_t msgId, const Want *want, uint64_t token);
+
+    void DropQueuedStarts(const char *excludedBundleName);
+
+    const char *GetTerminateBundleName(uint16_t msgId, const Want *want, uint64_t token);
+
+    bool IsBundleRunningOrQueued(const char *bundleName);
+
+    int32_t RunAbilityOperation(const AbilityOperation &operation);
+
+    static void FreeAbilityOperation(AbilityOperation *operation);
+
     uint16_t pendingToken_ { 0 };
 #ifndef _MINI_MULTI_TASKS_
     AbilityRecord *pendingRecord = nullptr;
 #endif
     List<AbilityOperation *> abilityOperation_ {};
+    AbilityOperationStat operationStat_ {};
+    AbilityMsgOverflowStat overflowStat_ {};
     bool isAppScheduling_ = false;
+    // times of the start and pre-check trace events, recorded once the token of the started ability is known
+    uint64_t startTraceTimeUs_ { 0 };
+    uint64_t preCheckTraceTimeUs_ { 0 };
 
     AbilityList abilityList_ {};
     SliteAbility *nativeAbility_ = nullptr;
@@ -35,6 +35,8 @@ public:
 
     void NotifyAbilityRecordCleanup(char *appName);
 
+    void NotifyAbilityRecordEvicted(const AbilityEvictionInfo &info);
+
 private:
     AbilityRecordObserverManager() = default;
     ~AbilityRecordObserverManager() = default;
@@ -49,8 +49,15 @@ public:
 
     virtual UINT32 GetAppTaskId() const = 0;
 
+    /* never waits for room in the queue, a message the full queue refuses is left to the caller */
     virtual int32_t SendScheduleMsgToAbilityThread(SliteAbilityInnerMsg &innerMsg);
 
+    /* called by the app task for every message it takes, tells the AMS once a refused message can be retried */
+    void NotifyIfDrained();
+
+    /* the lifecycle state a message moves the ability to, SLITE_STATE_UNKNOWN for the other messages */
+    static int32_t GetTargetState(SliteAbilityMsgId msgId);
+
     int32_t HandleCreate(const Want *want);
 
     int32_t HandleRestore(AbilitySavedData *data);
@@ -66,6 +73,8 @@ public:
     SliteAbility *ability_ = nullptr;
 protected:
     AbilityThreadState state_ = AbilityThreadState::ABILITY_THREAD_UNINITIALIZED;
+    // set by the AMS task when a put finds the queue full, cleared once the app task reports room
+    volatile bool isBackpressured_ = false;
 };
 } // namespace AbilitySlite
 } // namespace OHOS
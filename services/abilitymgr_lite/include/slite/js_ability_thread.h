@@ -38,8 +38,14 @@ public:
 
     static void AppTaskHandler(UINT32 uwArg);
 private:
+    int32_t StartAppTask();
+
+    void RecycleAppTask(bool reusable);
+
     osMessageQueueId_t messageQueueId_ = nullptr;
     UINT32 appTaskId_ = 0;
+    // set by the app task once it handles DESTROY, only then the task no longer refers to this thread
+    volatile bool isDestroyHandled_ = false;
 };
 } // namespace AbilitySlite
 } // namespace OHOS
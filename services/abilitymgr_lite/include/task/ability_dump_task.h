@@ -23,12 +23,17 @@
 namespace OHOS {
 class AbilityDumpTask : public AbilityTask {
 public:
-    AbilityDumpTask(AbilityMgrContext *context, const AbilityDumpClient *client);
+    AbilityDumpTask(AbilityMgrContext *context, const AbilityDumpClient *client, const char *extraInfo = nullptr);
     ~AbilityDumpTask() override = default;
 
     AbilityMsStatus Execute() override;
 private:
+    bool IsExtraOption(const char *option) const;
+    AbilityMsStatus DumpTrace() const;
+    AbilityMsStatus ExportTrace() const;
+
     const AbilityDumpClient *client_ { nullptr };
+    const char *extraInfo_ { nullptr };
 };
 }  // namespace OHOS
 #endif  // OHOS_ABILITY_DUMP_TASK_H
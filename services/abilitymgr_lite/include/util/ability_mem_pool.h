@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_MEM_POOL_H
+#define OHOS_ABILITY_MEM_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "want.h"
+
+namespace OHOS {
+struct AbilityMemPoolStat {
+    uint16_t blockSize;
+    uint16_t blockCount;
+    uint16_t used;
+    uint16_t highWater;
+    uint32_t exhausted;
+};
+
+/**
+ * Fixed-block pools for the short-lived objects of slite ability scheduling: Want and ElementName headers, request
+ * and operation headers and the bundle name strings that travel with them. Blocks come from static arenas in a few
+ * size classes, so these allocations no longer fragment the heap. A request that fits no free block falls back to
+ * the heap, and Free() returns every pointer to where it came from, so a pool block must only be released through
+ * Free(). Safe to use from any task.
+ */
+class AbilityMemPool {
+public:
+    static AbilityMemPool &GetInstance();
+
+    void *Alloc(size_t size);
+
+    void Free(void *ptr);
+
+    char *Strdup(const char *str);
+
+    /* copies element into pool blocks, release it with ClearWant or ClearElement and Free */
+    ElementName *CopyElement(const ElementName &element);
+
+    /* releases the members of want wherever they were allocated, want itself is left to the caller */
+    void ClearWant(Want *want);
+
+    void ClearElement(ElementName *element);
+
+    uint32_t GetClassCount() const;
+
+    bool GetStat(uint32_t index, AbilityMemPoolStat &stat) const;
+
+    /* allocations the pools could not serve, and those of them the heap could not serve either */
+    uint32_t GetFallbackCount() const;
+    uint32_t GetFailureCount() const;
+
+    uint32_t Dump(char *buffer, uint32_t size) const;
+
+private:
+    AbilityMemPool();
+    ~AbilityMemPool() = default;
+
+    void Lock() const;
+    void Unlock() const;
+
+    uint32_t fallbacks_ { 0 };
+    uint32_t failures_ { 0 };
+
+    AbilityMemPool(const AbilityMemPool &) = delete;
+    AbilityMemPool &operator=(const AbilityMemPool &) = delete;
+};
+} // namespace OHOS
+#endif // OHOS_ABILITY_MEM_POOL_H
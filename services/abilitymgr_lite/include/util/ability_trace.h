@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_TRACE_H
+#define OHOS_ABILITY_TRACE_H
+
+#include <cstdint>
+
+#ifndef ABILITY_TRACE_CAPACITY
+#ifdef __LITEOS_M__
+#define ABILITY_TRACE_CAPACITY 128
+#else
+#define ABILITY_TRACE_CAPACITY 512
+#endif
+#endif
+
+namespace OHOS {
+enum class AbilityTraceEvent : uint16_t {
+    /* slite */
+    START_ABILITY = 0,
+    PRE_CHECK_START,
+    CREATE_APP_TASK,
+    SEND_TO_ABILITY_THREAD,
+    HANDLE_IN_ABILITY_THREAD,
+    LIFECYCLE_DONE,
+    /* full system */
+    START_TASK,
+    SPAWN_PROCESS,
+    ATTACH_BUNDLE,
+    SCHEDULE_TRANSACTION,
+    TRANSACTION_DONE,
+    EVENT_MAX,
+};
+
+struct AbilityTraceRecord {
+    uint64_t timeUs;
+    uint64_t token;
+    int32_t state;
+    AbilityTraceEvent event;
+};
+
+/**
+ * Fixed-size ring of lifecycle transitions of this process. Every record carries a monotonic timestamp, the token of
+ * the ability it concerns and the lifecycle state, the oldest records are overwritten once the ring is full. Records
+ * are only taken through ABILITY_TRACE, which compiles to nothing unless ABILITY_TRACE_ENABLE is defined, so the ring
+ * costs no memory in a build without tracing.
+ */
+class AbilityTrace {
+public:
+    static AbilityTrace &GetInstance();
+
+    void Record(AbilityTraceEvent event, uint64_t token, int32_t state);
+
+    /* records an event that happened at timeUs, for events whose token is only known later */
+    void Record(AbilityTraceEvent event, uint64_t token, int32_t state, uint64_t timeUs);
+
+    static uint64_t GetTimeUs();
+
+    /* writes the records newest first, each with the time until the next record of the same token */
+    uint32_t Dump(char *buffer, uint32_t size) const;
+
+    /* writes the records as Chrome trace-event JSON, one track per token */
+    uint32_t ExportChromeTrace(char *buffer, uint32_t size) const;
+
+    /* returns the buffer size ExportChromeTrace needs for a full ring */
+    static uint32_t GetChromeTraceSize();
+
+    void Clear();
+
+    static const char *GetEventName(AbilityTraceEvent event);
+
+private:
+    AbilityTrace();
+    ~AbilityTrace();
+
+    void Lock() const;
+    void Unlock() const;
+    uint32_t Snapshot(AbilityTraceRecord *records) const;
+    static int64_t GetDuration(const AbilityTraceRecord *records, uint32_t count, uint32_t index);
+
+    AbilityTraceRecord *records_ { nullptr };
+    uint32_t recordCount_ { 0 };
+
+    AbilityTrace(const AbilityTrace &) = delete;
+    AbilityTrace &operator=(const AbilityTrace &) = delete;
+};
+} // namespace OHOS
+
+#ifdef ABILITY_TRACE_ENABLE
+#define ABILITY_TRACE(event, token, state) \
+    OHOS::AbilityTrace::GetInstance().Record(OHOS::AbilityTraceEvent::event, (token), (state))
+#define ABILITY_TRACE_STAMP(timeUs) ((timeUs) = OHOS::AbilityTrace::GetTimeUs())
+#define ABILITY_TRACE_AT(event, token, state, timeUs) \
+    OHOS::AbilityTrace::GetInstance().Record(OHOS::AbilityTraceEvent::event, (token), (state), (timeUs))
+#else
+#define ABILITY_TRACE(event, token, state)
+#define ABILITY_TRACE_STAMP(timeUs)
+#define ABILITY_TRACE_AT(event, token, state, timeUs)
+#endif
+#endif // OHOS_ABILITY_TRACE_H
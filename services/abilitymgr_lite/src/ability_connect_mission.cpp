@@ -15,7 +15,9 @@
 
 #include "ability_connect_mission.h"
 
+#include <algorithm>
 #include <cstring>
+#include <vector>
 
 #include "util/abilityms_log.h"
 
@@ -23,6 +25,25 @@ namespace OHOS {
 
 namespace {
     constexpr static uint16_t SERVICE_RECORDS_LIST_CAPACITY = 10240;
+
+    // drops one entry of the record under the key, the key goes with its last record
+    template<typename Index, typename Key>
+    void EraseIndexEntry(Index &index, const Key &key, const PageAbilityRecord *record)
+    {
+        auto iterator = index.find(key);
+        if (iterator == index.end()) {
+            return;
+        }
+        auto &records = iterator->second;
+        auto entry = std::find(records.begin(), records.end(), record);
+        if (entry == records.end()) {
+            return;
+        }
+        records.erase(entry);
+        if (records.empty()) {
+            index.erase(iterator);
+        }
+    }
 }
 
 AbilityConnectMission::~AbilityConnectMission()
@@ -32,72 +53,131 @@ AbilityConnectMission::~AbilityConnectMission()
         delete record;
     }
     serviceRecords_.clear();
+    tokenIndex_.clear();
+    abilityIndex_.clear();
+    bundleServiceCount_.clear();
+    connectIndex_.clear();
+    pageIndex_.clear();
     PRINTD("AbilityConnectMission", "Constructor");
 }
 
+AbilityConnectMission::ConnectKey AbilityConnectMission::MakeConnectKey(const SvcIdentity &connectSid,
+    uint64_t abilityToken)
+{
+    return { static_cast<uint64_t>(connectSid.handle), static_cast<uint64_t>(connectSid.token), abilityToken };
+}
+
+bool AbilityConnectMission::MakeAbilityKey(const char *bundleName, const char *abilityName, std::string &key)
+{
+    if (bundleName == nullptr || abilityName == nullptr) {
+        return false;
+    }
+    key = bundleName;
+    key += '/';
+    key += abilityName;
+    return true;
+}
+
 void AbilityConnectMission::PushServiceRecord(PageAbilityRecord &abilityRecord)
 {
     if (serviceRecords_.size() >= SERVICE_RECORDS_LIST_CAPACITY) {
         return;
     }
+    if (tokenIndex_.find(abilityRecord.GetToken()) != tokenIndex_.end()) {
+        return;
+    }
     serviceRecords_.emplace_back(&abilityRecord);
+    tokenIndex_[abilityRecord.GetToken()] = std::prev(serviceRecords_.end());
+
+    const AbilityInfo &abilityInfo = abilityRecord.GetAbilityInfo();
+    std::string abilityKey;
+    if (MakeAbilityKey(abilityInfo.bundleName, abilityInfo.name, abilityKey)) {
+        // lookups return the earlier service, as the list scan found it first
+        abilityIndex_[abilityKey].emplace_back(&abilityRecord);
+    }
+    if (abilityInfo.bundleName != nullptr) {
+        bundleServiceCount_[abilityInfo.bundleName]++;
+    }
+    for (const auto connectRecord : abilityRecord.GetConnectRecords()) {
+        if (connectRecord != nullptr) {
+            AddConnectIndex(abilityRecord, *connectRecord);
+        }
+    }
 }
 
 PageAbilityRecord *AbilityConnectMission::FindServiceRecord(uint64_t token) const
 {
-    for (const auto record : serviceRecords_) {
-        if (record != nullptr && record->GetToken() == token) {
-            return record;
-        }
+    auto iterator = tokenIndex_.find(token);
+    if (iterator == tokenIndex_.end()) {
+        return nullptr;
     }
-    return nullptr;
+    return *(iterator->second);
 }
 
 PageAbilityRecord *AbilityConnectMission::FindServiceRecord(const char *bundleName, const char *abilityName) const
 {
     CHECK_NULLPTR_RETURN_PTR(bundleName, "AbilityConnectMission", "invalid argument");
     CHECK_NULLPTR_RETURN_PTR(abilityName, "AbilityConnectMission", "invalid argument");
-    for (const auto record : serviceRecords_) {
-        if (record != nullptr) {
-            const char *recordBundleName = record->GetAbilityInfo().bundleName;
-            const char *recordAbilityName = record->GetAbilityInfo().name;
-            if (recordBundleName == nullptr || recordAbilityName == nullptr) {
-                continue;
-            }
-            if (strcmp(recordBundleName, bundleName) == 0 && strcmp(recordAbilityName, abilityName) == 0) {
-                return record;
-            }
-        }
+    std::string abilityKey;
+    (void) MakeAbilityKey(bundleName, abilityName, abilityKey);
+    auto iterator = abilityIndex_.find(abilityKey);
+    if (iterator == abilityIndex_.end()) {
+        return nullptr;
     }
-    return nullptr;
+    return iterator->second.front();
 }
 
 PageAbilityRecord *AbilityConnectMission::FindServiceRecord(const SvcIdentity &connectSid, uint64_t abilityToken) const
 {
-    for (const auto record : serviceRecords_) {
-        if (record != nullptr && record->GetConnectRecord(connectSid, abilityToken) != nullptr) {
-            return record;
+    auto iterator = connectIndex_.find(MakeConnectKey(connectSid, abilityToken));
+    if (iterator == connectIndex_.end()) {
+        return nullptr;
+    }
+    return iterator->second.front();
+}
+
+std::list<PageAbilityRecord *>::iterator AbilityConnectMission::EraseServiceRecord(
+    std::list<PageAbilityRecord *>::iterator iterator)
+{
+    PageAbilityRecord *record = *iterator;
+    tokenIndex_.erase(record->GetToken());
+
+    const AbilityInfo &abilityInfo = record->GetAbilityInfo();
+    std::string abilityKey;
+    if (MakeAbilityKey(abilityInfo.bundleName, abilityInfo.name, abilityKey)) {
+        EraseIndexEntry(abilityIndex_, abilityKey, record);
+    }
+    if (abilityInfo.bundleName != nullptr) {
+        auto countIterator = bundleServiceCount_.find(abilityInfo.bundleName);
+        if (countIterator != bundleServiceCount_.end() && --countIterator->second <= 0) {
+            bundleServiceCount_.erase(countIterator);
+        }
+    }
+    for (const auto connectRecord : record->GetConnectRecords()) {
+        if (connectRecord != nullptr) {
+            RemoveConnectIndex(*record, *connectRecord);
         }
     }
-    return nullptr;
+    return serviceRecords_.erase(iterator);
 }
 
 void AbilityConnectMission::RemoveServiceRecord(uint64_t token)
 {
-    for (auto iterator = serviceRecords_.begin(); iterator != serviceRecords_.end();) {
-        auto record = *iterator;
-        if (record != nullptr && record->GetToken() == token) {
-            iterator = serviceRecords_.erase(iterator);
-            delete record;
-        } else {
-            ++iterator;
-        }
+    auto tokenIterator = tokenIndex_.find(token);
+    if (tokenIterator == tokenIndex_.end()) {
+        return;
     }
+    auto record = *(tokenIterator->second);
+    (void) EraseServiceRecord(tokenIterator->second);
+    delete record;
 }
 
 void AbilityConnectMission::RemoveServiceRecord(const char *bundleName)
 {
     CHECK_NULLPTR_RETURN(bundleName, "AbilityConnectMission", "invalid argument");
+    if (CountServiceInApp(bundleName) == 0) {
+        return;
+    }
     for (auto iterator = serviceRecords_.begin(); iterator != serviceRecords_.end();) {
         auto record = *iterator;
         if (record != nullptr && record->IsSamePageAbility(bundleName)) {
@@ -105,7 +185,7 @@ void AbilityConnectMission::RemoveServiceRecord(const char *bundleName)
             if (!status.IsOk()) {
                 PRINTW("RemoveServiceRecord", "service disconnectDoneTransaction failed");
             }
-            iterator = serviceRecords_.erase(iterator);
+            iterator = EraseServiceRecord(iterator);
             delete record;
         } else {
             ++iterator;
@@ -118,17 +198,11 @@ int32_t AbilityConnectMission::CountServiceInApp(const char *bundleName)
     if (bundleName == nullptr) {
         return 0;
     }
-    int32_t retVal = 0;
-    for (const auto record : serviceRecords_) {
-        if (record == nullptr) {
-            continue;
-        }
-        if (record->GetAbilityInfo().bundleName != nullptr &&
-            strcmp(record->GetAbilityInfo().bundleName, bundleName) == 0) {
-            retVal++;
-        }
+    auto iterator = bundleServiceCount_.find(bundleName);
+    if (iterator == bundleServiceCount_.end()) {
+        return 0;
     }
-    return retVal;
+    return iterator->second;
 }
 
 #ifdef OHOS_DEBUG
@@ -151,12 +225,52 @@ AbilityMsStatus AbilityConnectMission::DumpConnectMission() const
 void AbilityConnectMission::RemoveConnectRecordByPageToken(uint64_t token, const char *bundleName)
 {
     CHECK_NULLPTR_RETURN(bundleName, "AbilityConnectMission", "invalid argument");
-    for (auto iterator = serviceRecords_.begin(); iterator != serviceRecords_.end(); ++iterator) {
-        auto record = *iterator;
-        if (record != nullptr && record->GetAbilityInfo().bundleName != nullptr &&
+    auto pageIterator = pageIndex_.find(token);
+    if (pageIterator == pageIndex_.end()) {
+        return;
+    }
+    // the services drop their connections below, which updates pageIndex_
+    std::vector<PageAbilityRecord *> services;
+    services.reserve(pageIterator->second.size());
+    for (const auto &service : pageIterator->second) {
+        services.emplace_back(service.first);
+    }
+    for (auto record : services) {
+        if (record->GetAbilityInfo().bundleName != nullptr &&
             strcmp(record->GetAbilityInfo().bundleName, bundleName) != 0) {
             record->RemoveConnectRecordByPageToken(token);
         }
     }
 }
+
+void AbilityConnectMission::AddConnectIndex(PageAbilityRecord &service, const AbilityConnectRecord &connectRecord)
+{
+    if (tokenIndex_.find(service.GetToken()) == tokenIndex_.end()) {
+        return;
+    }
+    // a connection identity shared by several services resolves to the first one, the next takes over on removal
+    ConnectKey key = MakeConnectKey(connectRecord.GetConnectSid(), connectRecord.GetAbilityToken());
+    connectIndex_[key].emplace_back(&service);
+    pageIndex_[connectRecord.GetAbilityToken()][&service]++;
+}
+
+void AbilityConnectMission::RemoveConnectIndex(PageAbilityRecord &service, const AbilityConnectRecord &connectRecord)
+{
+    EraseIndexEntry(connectIndex_, MakeConnectKey(connectRecord.GetConnectSid(), connectRecord.GetAbilityToken()),
+        &service);
+    auto pageIterator = pageIndex_.find(connectRecord.GetAbilityToken());
+    if (pageIterator == pageIndex_.end()) {
+        return;
+    }
+    auto serviceIterator = pageIterator->second.find(&service);
+    if (serviceIterator == pageIterator->second.end()) {
+        return;
+    }
+    if (--serviceIterator->second == 0) {
+        pageIterator->second.erase(serviceIterator);
+        if (pageIterator->second.empty()) {
+            pageIndex_.erase(pageIterator);
+        }
+    }
+}
 } // namespace OHOS
@@ -152,6 +152,30 @@ int32 AbilityInnerFeature::TerminateApp(const char *bundleName)
     return EC_SUCCESS;
 }
 
+int32 AbilityInnerFeature::InvalidateBundleCache(const char *bundleName)
+{
+    // nullptr is passed on to drop the cached results of all bundles
+    char *name = nullptr;
+    if (bundleName != nullptr) {
+        name = Utils::Strdup(bundleName);
+        if (name == nullptr) {
+            return EC_NOMEMORY;
+        }
+    }
+    Request request = {
+        .msgId = AMS_BUNDLE_CHANGED,
+        .len = 0,
+        .data = reinterpret_cast<void *>(name),
+    };
+    int32 propRet = SAMGR_SendRequest(&(GetInstance()->identity_), &request, nullptr);
+    if (propRet != EC_SUCCESS) {
+        PRINTE("AbilityInnerFeature", "send request failure");
+        AdapterFree(name);
+        return EC_COMMU;
+    }
+    return EC_SUCCESS;
+}
+
 int32 AbilityInnerFeature::DumpAbilityInvoke(const void *origin, IpcIo *req)
 {
     Want want = { nullptr, nullptr, nullptr, 0 };
@@ -94,6 +94,9 @@ int32 AbilityMgrFeature::Invoke(IServerProxy *iProxy, int funcId, void *origin,
     if (funcId >= START_ABILITY && funcId < INNER_BEGIN) {
         return invokeFuncList[funcId](origin, req);
     }
+    if (funcId == ABILITY_TRANSACTION_DONE_BATCH) {
+        return AbilityTransactionDoneBatchInvoke(origin, req);
+    }
     return COMMAND_ERROR;
 }
 
@@ -319,6 +322,37 @@ int32 AbilityMgrFeature::AbilityTransactionDoneInvoke(const void *origin, IpcIo
     return EC_SUCCESS;
 }
 
+int32 AbilityMgrFeature::AbilityTransactionDoneBatchInvoke(const void *origin, IpcIo *req)
+{
+    uint32_t count = 0;
+    ReadUint32(req, &count);
+    if (count == 0 || count > MAX_TRANSACTION_BATCH_SIZE) {
+        PRINTE("AbilityMgrFeature", "invalid transaction batch size");
+        return EC_INVALID;
+    }
+    TransactionState *transactionStates = new TransactionState[count];
+    for (uint32_t i = 0; i < count; i++) {
+        transactionStates[i].token = 0;
+        ReadUint64(req, &transactionStates[i].token);
+        int32_t state = 0;
+        ReadInt32(req, &state);
+        transactionStates[i].state = state;
+    }
+    Request request = {
+        .msgId = AMS_TRANSACTION_DONE_BATCH,
+        .len = 0,
+        .data = reinterpret_cast<void *>(transactionStates),
+        .msgValue = count,
+    };
+    int32 propRet = SAMGR_SendRequest(&(GetInstance()->identity_), &request, nullptr);
+    if (propRet != EC_SUCCESS) {
+        PRINTE("AbilityMgrFeature", "send request failure");
+        delete[] transactionStates;
+        return EC_COMMU;
+    }
+    return EC_SUCCESS;
+}
+
 int32 AbilityMgrFeature::AttachBundleInvoke(const void *origin, IpcIo *req)
 {
     uint64_t token = 0;
@@ -341,7 +375,7 @@ int32 AbilityMgrFeature::AttachBundleInvoke(const void *origin, IpcIo *req)
         return EC_INVALID;
     }
 
-    auto client = new AbilityThreadClient(token, callingPid, svc, &AbilityMgrFeature::AppDeathNotify);
+    auto client = new AbilityThreadClient(token, callingPid, GetCallingUid(), svc, &AbilityMgrFeature::AppDeathNotify);
     Request request = {
         .msgId = AMS_ATTACH_BUNDLE,
         .len = 0,
@@ -15,10 +15,17 @@
 
 #include "ability_mgr_handler.h"
 
+#define __STDC_FORMAT_MACROS
+#include <cinttypes>
+#include <ctime>
+#include <vector>
+
+#include "ability_inner_feature.h"
 #include "ability_kit_command.h"
 #include "ability_message_id.h"
 #include "adapter.h"
 #include "app_manager.h"
+#include "appexecfwk_errors.h"
 #include "bundle_info.h"
 #include "bundle_manager.h"
 #ifdef ABILITY_WINDOW_SUPPORT
@@ -30,6 +37,18 @@
 #include "util/abilityms_helper.h"
 
 namespace OHOS {
+namespace {
+    constexpr uint64_t MS_PER_SECOND = 1000;
+    constexpr uint64_t NS_PER_MS = 1000000;
+
+    uint64_t GetMonotonicTimeMs()
+    {
+        struct timespec now = {};
+        (void) clock_gettime(CLOCK_MONOTONIC, &now);
+        return static_cast<uint64_t>(now.tv_sec) * MS_PER_SECOND + static_cast<uint64_t>(now.tv_nsec) / NS_PER_MS;
+    }
+}
+
 void AbilityMgrHandler::Init()
 {
     AbilityMsStatus status = bundleMsClient_.Initialize();
@@ -64,6 +83,10 @@ void AbilityMgrHandler::ServiceMsgProcess(const Request &request)
             AbilityTransaction(reinterpret_cast<TransactionState *>(request.data));
             break;
         }
+        case AMS_TRANSACTION_DONE_BATCH: {
+            AbilityTransactionBatch(reinterpret_cast<TransactionState *>(request.data), request.msgValue);
+            break;
+        }
         case AMS_CONNECT_ABILITY: {
             auto transParam = reinterpret_cast<AbilityConnectTransParam *>(request.data);
             int ret = ConnectAbility(transParam);
@@ -111,6 +134,12 @@ void AbilityMgrHandler::ServiceMsgProcess(const Request &request)
             AdapterFree(bundleName);
             break;
         }
+        case AMS_BUNDLE_CHANGED: {
+            char *bundleName = reinterpret_cast<char *>(request.data);
+            bundleMsClient_.InvalidateCache(bundleName);
+            AdapterFree(bundleName);
+            break;
+        }
         default: {
             PRINTI("AbilityMgrHandler", "unknown msgId");
             break;
@@ -121,13 +150,40 @@ void AbilityMgrHandler::ServiceMsgProcess(const Request &request)
 void AbilityMgrHandler::OnServiceInited()
 {
     PRINTD("AbilityMgrHandler", "start");
+    RegisterBundleStatusCallback();
     StartKeepAliveApps();
 }
 
+void AbilityMgrHandler::RegisterBundleStatusCallback()
+{
+    // bundle manager reports every install, update and uninstall, the BMS query cache must not outlive them
+    bundleStatusCallback_.callBack = &AbilityMgrHandler::OnBundleStateChanged;
+    bundleStatusCallback_.data = nullptr;
+    bundleStatusCallback_.bundleName = nullptr;
+    if (RegisterCallback(&bundleStatusCallback_) != ERR_OK) {
+        PRINTW("AbilityMgrHandler", "register bundle status callback failure");
+    }
+}
+
+void AbilityMgrHandler::OnBundleStateChanged(uint8_t installType, uint8_t resultCode, const void *resultMessage,
+    const char *bundleName, void *data)
+{
+    (void) installType;
+    (void) resultMessage;
+    (void) data;
+    if (resultCode != ERR_OK) {
+        return;
+    }
+    // called on the bundle callback thread, the cache is only touched on the AMS task
+    (void) AbilityInnerFeature::InvalidateBundleCache(bundleName);
+}
+
 void AbilityMgrHandler::StartKeepAliveApps()
 {
+    uint64_t bootBegin = GetMonotonicTimeMs();
     int32_t len = 0;
     BundleInfo *bundleInfos = nullptr;
+    // one query returns the bundle and ability infos of every keep-alive app
     AbilityMsStatus status = bundleMsClient_.QueryKeepAliveBundleInfos(&bundleInfos, &len);
     CHECK_RESULT_LOG(status);
     CHECK_NULLPTR_RETURN(bundleInfos, "AbilityMgrHandler", "bundleInfos is nullptr");
@@ -137,19 +193,45 @@ void AbilityMgrHandler::StartKeepAliveApps()
         WMSClient::WaitUntilWmsReady();
     }
 #endif
+    std::vector<const BundleInfo *> apps;
+    for (int32_t i = 0; i < len; ++i) {
+        if (!AbilityMsHelper::IsLauncherAbility(bundleInfos[i].bundleName) && bundleInfos[i].numOfAbility > 0) {
+            apps.emplace_back(&bundleInfos[i]);
+        }
+    }
+    // spawn all processes at once, their abilities are then started on this task in bundle order
+    std::vector<AppBootTiming> timings;
+    AppManager::GetInstance().StartAppProcesses(apps, timings);
     for (int32_t i = 0; i < len; ++i) {
         if (AbilityMsHelper::IsLauncherAbility(bundleInfos[i].bundleName)) {
 #ifdef ABILITY_WINDOW_SUPPORT
             StartLauncher();
 #endif
-        } else {
-            StartKeepAliveApp(bundleInfos[i]);
+            continue;
+        }
+        uint64_t startBegin = GetMonotonicTimeMs();
+        StartKeepAliveApp(bundleInfos[i]);
+        uint64_t startMs = GetMonotonicTimeMs() - startBegin;
+        for (auto &timing : timings) {
+            if (bundleInfos[i].bundleName != nullptr && timing.bundleName == bundleInfos[i].bundleName) {
+                timing.startMs = startMs;
+                break;
+            }
         }
     }
     for (int32_t i = 0; i < len; ++i) {
         ClearBundleInfo(&(bundleInfos[i]));
     }
     AdapterFree(bundleInfos);
+
+    uint64_t totalMs = GetMonotonicTimeMs() - bootBegin;
+    for (const auto &timing : timings) {
+        PRINTI("AbilityMgrHandler", "keep-alive %{public}s spawn %{public}" PRIu64 " ms %{public}s, start %{public}"
+            PRIu64 " ms", timing.bundleName.c_str(), timing.spawnMs, timing.spawned ? "done" : "failed",
+            timing.startMs);
+    }
+    PRINTI("AbilityMgrHandler", "%{public}d keep-alive apps started in %{public}" PRIu64 " ms", len, totalMs);
+    AppManager::GetInstance().SetBootReport(std::move(timings), totalMs);
 }
 
 void AbilityMgrHandler::StartKeepAliveApp(const BundleInfo &bundleInfo)
@@ -158,8 +240,10 @@ void AbilityMgrHandler::StartKeepAliveApp(const BundleInfo &bundleInfo)
     Want want = {};
     AbilityMsStatus status = AbilityMsHelper::SetKeepAliveWant(bundleInfo, want);
     CHECK_RESULT_LOG(status);
-    StartAbility(&want, AbilityMsHelper::SYSTEM_UID);
+    // the bundle info carries the ability info, so no further bms query is needed
+    status = abilityWorker_.StartAbility(want, bundleInfo.abilityInfos[0], bundleInfo, AbilityMsHelper::SYSTEM_UID);
     ClearWant(&want);
+    CHECK_RESULT_LOG(status);
 }
 
 void AbilityMgrHandler::StartLauncher()
@@ -180,7 +264,7 @@ int AbilityMgrHandler::StartAbility(const Want *want, pid_t callingUid)
     CHECK_NULLPTR_RETURN_CODE(want, "AbilityMgrHandler", "invalid argument", EC_FAILURE);
     CHECK_NULLPTR_RETURN_CODE(want->element, "AbilityMgrHandler", "invalid argument", EC_FAILURE);
 
-    // Query BundleInfo note: bundleInfo not need clear
+    // Query BundleInfo note: bundleInfo is a copy of its own and must be cleared
     BundleInfo bundleInfo = {};
     AbilityMsStatus status = bundleMsClient_.QueryBundleInfo(want->element->bundleName, &bundleInfo);
     CHECK_RESULT_LOG_CODE(status, EC_INVALID);
@@ -188,10 +272,14 @@ int AbilityMgrHandler::StartAbility(const Want *want, pid_t callingUid)
     // Query AbilityInfo
     AbilityInfo target = {};
     status = bundleMsClient_.QueryAbilityInfo(want, &target);
+    if (!status.IsOk()) {
+        ClearBundleInfo(&bundleInfo);
+    }
     CHECK_RESULT_LOG_CODE(status, EC_INVALID);
 
     status = abilityWorker_.StartAbility(*want, target, bundleInfo, callingUid);
     ClearAbilityInfo(&target);
+    ClearBundleInfo(&bundleInfo);
     CHECK_RESULT_LOG_CODE(status, EC_COMMU);
 
     return EC_SUCCESS;
@@ -221,6 +309,22 @@ void AbilityMgrHandler::AbilityTransaction(TransactionState *state)
     CHECK_NULLPTR_RETURN(state, "AbilityMgrHandler", "invalid argument");
     AbilityMsStatus status = abilityWorker_.AbilityTransaction(*state);
     delete state;
+    OnAbilityTransactionDone(status);
+}
+
+void AbilityMgrHandler::AbilityTransactionBatch(TransactionState *states, uint32_t count)
+{
+    PRINTD("AbilityMgrHandler", "start");
+    CHECK_NULLPTR_RETURN(states, "AbilityMgrHandler", "invalid argument");
+    // apply the results in the order the app reported them, as if they had arrived one message at a time
+    for (uint32_t i = 0; i < count; i++) {
+        OnAbilityTransactionDone(abilityWorker_.AbilityTransaction(states[i]));
+    }
+    delete[] states;
+}
+
+void AbilityMgrHandler::OnAbilityTransactionDone(const AbilityMsStatus &status)
+{
     if (status.IsNoActiveAbility()) {
         status.LogStatus();
         StartLauncher();
@@ -233,6 +337,8 @@ void AbilityMgrHandler::TerminateApp(const char *bundleName)
 {
     PRINTD("AbilityMgrHandler", "start");
     CHECK_NULLPTR_RETURN(bundleName, "AbilityMgrHandler", "invalid argument");
+    // bundle manager terminates an app before it is updated or uninstalled
+    bundleMsClient_.InvalidateCache(bundleName);
     AbilityMsStatus status = abilityWorker_.TerminateApp(bundleName);
     CHECK_RESULT_LOG(status);
 }
@@ -241,7 +347,8 @@ void AbilityMgrHandler::RestartApp(const char *bundleName)
 {
     PRINTD("AbilityMgrHandler", "start %{public}s", bundleName);
     CHECK_NULLPTR_RETURN(bundleName, "AbilityMgrHandler", "invalid argument");
-    // Query BundleInfo
+    bundleMsClient_.InvalidateCache(bundleName);
+    // Query BundleInfo note: bundleInfo is a copy of its own and must be cleared
     BundleInfo bundleInfo = {};
     AbilityMsStatus status = bundleMsClient_.QueryBundleInfo(bundleName, &bundleInfo);
     if (!status.IsOk()) {
@@ -257,6 +364,7 @@ void AbilityMgrHandler::RestartApp(const char *bundleName)
         && bundleInfo.isKeepAlive) {
         StartKeepAliveApp(bundleInfo);
     }
+    ClearBundleInfo(&bundleInfo);
     CHECK_RESULT_LOG(status);
 }
 
@@ -267,7 +375,7 @@ int AbilityMgrHandler::ConnectAbility(AbilityConnectTransParam *transParam)
     const Want *want = transParam->GetWant();
     CHECK_NULLPTR_RETURN_CODE(want, "AbilityMgrHandler", "invalid argument", EC_FAILURE);
     CHECK_NULLPTR_RETURN_CODE(want->element, "AbilityMgrHandler", "invalid argument", EC_FAILURE);
-    // Query BundleInfo note: bundleInfo not need clear
+    // Query BundleInfo note: bundleInfo is a copy of its own and must be cleared
     BundleInfo bundleInfo = {};
     AbilityMsStatus status = bundleMsClient_.QueryBundleInfo(want->element->bundleName, &bundleInfo);
     CHECK_RESULT_LOG_CODE(status, EC_INVALID);
@@ -275,10 +383,14 @@ int AbilityMgrHandler::ConnectAbility(AbilityConnectTransParam *transParam)
     // Query AbilityInfo
     AbilityInfo target = {};
     status = bundleMsClient_.QueryAbilityInfo(want, &target);
+    if (!status.IsOk()) {
+        ClearBundleInfo(&bundleInfo);
+    }
     CHECK_RESULT_LOG_CODE(status, EC_INVALID);
 
     status = abilityWorker_.ConnectAbility(*transParam, target, bundleInfo);
     ClearAbilityInfo(&target);
+    ClearBundleInfo(&bundleInfo);
     CHECK_RESULT_LOG_CODE(status, EC_COMMU);
     return EC_SUCCESS;
 }
@@ -318,7 +430,7 @@ void AbilityMgrHandler::TerminateService(Want *want, pid_t callingUid)
     CHECK_NULLPTR_RETURN(want, "AbilityMgrHandler", "invalid argument");
     CHECK_NULLPTR_RETURN(want->element, "AbilityMgrHandler", "invalid argument");
 
-    // Query BundleInfo note: bundleInfo not need clear
+    // Query BundleInfo note: bundleInfo is a copy of its own and must be cleared
     BundleInfo bundleInfo = {};
     AbilityMsStatus status = bundleMsClient_.QueryBundleInfo(want->element->bundleName, &bundleInfo);
     CHECK_RESULT_LOG(status);
@@ -326,9 +438,13 @@ void AbilityMgrHandler::TerminateService(Want *want, pid_t callingUid)
     // Query AbilityInfo
     AbilityInfo target = {};
     status = bundleMsClient_.QueryAbilityInfo(want, &target);
+    if (!status.IsOk()) {
+        ClearBundleInfo(&bundleInfo);
+    }
     CHECK_RESULT_LOG(status);
     status = abilityWorker_.TerminateService(target, bundleInfo, callingUid);
     ClearAbilityInfo(&target);
+    ClearBundleInfo(&bundleInfo);
     CHECK_RESULT_LOG(status);
 }
 
@@ -357,7 +473,9 @@ void AbilityMgrHandler::DumpAbility(const AbilityDumpClient *client)
 {
     PRINTD("AbilityMgrHandler", "start");
     CHECK_NULLPTR_RETURN(client, "AbilityMgrHandler", "invalid argument");
-    AbilityMsStatus status = abilityWorker_.DumpAbility(*client);
+    AbilityMsStatus extraInfo = bundleMsClient_.DumpCacheInfo();
+    extraInfo.DumpAppend(AppManager::GetInstance().DumpSpawnInfo());
+    AbilityMsStatus status = abilityWorker_.DumpAbility(*client, extraInfo.Dump());
     ReleaseSvc(*(client->GetWant().sid));
     delete client;
     CHECK_RESULT_LOG(status);
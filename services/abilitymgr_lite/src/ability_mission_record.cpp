@@ -37,6 +37,8 @@ AbilityMissionRecord::AbilityMissionRecord(AbilityMissionStack* missionStack, co
 AbilityMissionRecord::~AbilityMissionRecord()
 {
     abilityMissionStack_ = nullptr;
+    SetPrevMissionRecord(nullptr);
+    ClearNextMissionRecords();
     ClearPageAbility();
     AdapterFree(bundleName_);
     PRINTD("AbilityMissionRecord", "Destructor");
@@ -58,6 +60,11 @@ bool AbilityMissionRecord::IsSameMissionRecord(const char *bundleName) const
     return false;
 }
 
+const char *AbilityMissionRecord::GetBundleName() const
+{
+    return bundleName_;
+}
+
 void AbilityMissionRecord::SetMissionStack(AbilityMissionStack *missionStack)
 {
     abilityMissionStack_ = missionStack;
@@ -165,7 +172,33 @@ void AbilityMissionRecord::ClearPageAbility(AbilityConnectMission *connectMissio
 
 void AbilityMissionRecord::SetPrevMissionRecord(const AbilityMissionRecord *missionRecord)
 {
+    if (prevMissionRecord_ == missionRecord) {
+        return;
+    }
+    if (prevMissionRecord_ != nullptr) {
+        auto oldPrev = const_cast<AbilityMissionRecord *>(prevMissionRecord_);
+        if (oldPrev->firstNextMissionRecord_ == this) {
+            oldPrev->firstNextMissionRecord_ = nextSiblingMissionRecord_;
+        }
+        if (prevSiblingMissionRecord_ != nullptr) {
+            prevSiblingMissionRecord_->nextSiblingMissionRecord_ = nextSiblingMissionRecord_;
+        }
+        if (nextSiblingMissionRecord_ != nullptr) {
+            nextSiblingMissionRecord_->prevSiblingMissionRecord_ = prevSiblingMissionRecord_;
+        }
+        prevSiblingMissionRecord_ = nullptr;
+        nextSiblingMissionRecord_ = nullptr;
+    }
     prevMissionRecord_ = missionRecord;
+    if (missionRecord != nullptr) {
+        // the back reference lets the prev mission clear this link without a scan of the stack
+        auto newPrev = const_cast<AbilityMissionRecord *>(missionRecord);
+        nextSiblingMissionRecord_ = newPrev->firstNextMissionRecord_;
+        if (nextSiblingMissionRecord_ != nullptr) {
+            nextSiblingMissionRecord_->prevSiblingMissionRecord_ = this;
+        }
+        newPrev->firstNextMissionRecord_ = this;
+    }
 }
 
 const AbilityMissionRecord *AbilityMissionRecord::GetPrevMissionRecord() const
@@ -173,6 +206,13 @@ const AbilityMissionRecord *AbilityMissionRecord::GetPrevMissionRecord() const
     return prevMissionRecord_;
 }
 
+void AbilityMissionRecord::ClearNextMissionRecords()
+{
+    while (firstNextMissionRecord_ != nullptr) {
+        firstNextMissionRecord_->SetPrevMissionRecord(nullptr);
+    }
+}
+
 #ifdef OHOS_DEBUG
 AbilityMsStatus AbilityMissionRecord::DumpMissionRecord() const
 {
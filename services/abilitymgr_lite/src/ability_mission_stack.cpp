@@ -30,10 +30,12 @@ AbilityMissionStack::AbilityMissionStack(StackType type)
 
 AbilityMissionStack::~AbilityMissionStack()
 {
-    for (auto iterator = missionRecords_.begin(); iterator != missionRecords_.end();) {
-        AbilityMissionRecord *missionRecord = *iterator;
-        iterator = missionRecords_.erase(iterator);
+    AbilityMissionRecord *missionRecord = bottomMissionRecord_;
+    while (missionRecord != nullptr) {
+        AbilityMissionRecord *upper = missionRecord->upperMissionRecord_;
+        Unlink(*missionRecord);
         delete missionRecord;
+        missionRecord = upper;
     }
 }
 
@@ -42,32 +44,77 @@ StackType AbilityMissionStack::GetStackType() const
     return stackType_;
 }
 
+void AbilityMissionStack::LinkTop(AbilityMissionRecord &missionRecord)
+{
+    missionRecord.lowerMissionRecord_ = topMissionRecord_;
+    missionRecord.upperMissionRecord_ = nullptr;
+    if (topMissionRecord_ != nullptr) {
+        topMissionRecord_->upperMissionRecord_ = &missionRecord;
+    } else {
+        bottomMissionRecord_ = &missionRecord;
+    }
+    topMissionRecord_ = &missionRecord;
+    missionRecord.isInStack_ = true;
+}
+
+void AbilityMissionStack::Unlink(AbilityMissionRecord &missionRecord)
+{
+    if (missionRecord.lowerMissionRecord_ != nullptr) {
+        missionRecord.lowerMissionRecord_->upperMissionRecord_ = missionRecord.upperMissionRecord_;
+    } else {
+        bottomMissionRecord_ = missionRecord.upperMissionRecord_;
+    }
+    if (missionRecord.upperMissionRecord_ != nullptr) {
+        missionRecord.upperMissionRecord_->lowerMissionRecord_ = missionRecord.lowerMissionRecord_;
+    } else {
+        topMissionRecord_ = missionRecord.lowerMissionRecord_;
+    }
+    missionRecord.lowerMissionRecord_ = nullptr;
+    missionRecord.upperMissionRecord_ = nullptr;
+    missionRecord.isInStack_ = false;
+}
+
 void AbilityMissionStack::PushTopMissionRecord(AbilityMissionRecord &missionRecord)
 {
     missionRecord.SetMissionStack(this);
-    if (missionRecords_.size() >= MISSION_RECORD_LIST_CAPACITY) {
+    if (missionRecordCount_ >= MISSION_RECORD_LIST_CAPACITY || missionRecord.isInStack_) {
         return;
     }
-    missionRecords_.emplace_back(&missionRecord);
+    LinkTop(missionRecord);
+    missionRecordCount_++;
+    if (missionRecord.GetBundleName() != nullptr) {
+        // the first mission of a bundle wins lookups, as it did in the bottom-up scan
+        (void) bundleIndex_.emplace(missionRecord.GetBundleName(), &missionRecord);
+    }
 }
 
 void AbilityMissionStack::MoveMissionRecordToTop(AbilityMissionRecord &missionRecord)
 {
-    if (missionRecords_.back() != &missionRecord) {
-        missionRecords_.remove(&missionRecord);
-        missionRecords_.emplace_back(&missionRecord);
+    if (!missionRecord.isInStack_) {
+        PushTopMissionRecord(missionRecord);
+        return;
     }
+    if (missionRecord.GetMissionStack() != this || topMissionRecord_ == &missionRecord) {
+        return;
+    }
+    Unlink(missionRecord);
+    LinkTop(missionRecord);
 }
 
 void AbilityMissionStack::RemoveMissionRecord(AbilityMissionRecord &missionRecord)
 {
-    missionRecords_.remove(&missionRecord);
-    // clear prev mission record
-    for (const auto currentMission : missionRecords_) {
-        if (currentMission != nullptr && currentMission->GetPrevMissionRecord() == &missionRecord) {
-            currentMission->SetPrevMissionRecord(nullptr);
+    if (missionRecord.isInStack_ && missionRecord.GetMissionStack() == this) {
+        Unlink(missionRecord);
+        missionRecordCount_--;
+        if (missionRecord.GetBundleName() != nullptr) {
+            auto iterator = bundleIndex_.find(missionRecord.GetBundleName());
+            if (iterator != bundleIndex_.end() && iterator->second == &missionRecord) {
+                bundleIndex_.erase(iterator);
+            }
         }
     }
+    // clear prev mission record
+    missionRecord.ClearNextMissionRecords();
 }
 
 void AbilityMissionStack::RemoveMissionRecord(AbilityConnectMission *connectMission, const char *bundleName)
@@ -84,9 +131,8 @@ bool AbilityMissionStack::IsTopMissionRecord(const char *bundleName) const
     if (bundleName == nullptr) {
         return false;
     }
-    AbilityMissionRecord *topMissionRecord = missionRecords_.back();
-    if (topMissionRecord != nullptr) {
-        return topMissionRecord->IsSameMissionRecord(bundleName);
+    if (topMissionRecord_ != nullptr) {
+        return topMissionRecord_->IsSameMissionRecord(bundleName);
     }
     return false;
 }
@@ -94,25 +140,27 @@ bool AbilityMissionStack::IsTopMissionRecord(const char *bundleName) const
 AbilityMissionRecord *AbilityMissionStack::GetTargetMissionRecord(const char *bundleName) const
 {
     CHECK_NULLPTR_RETURN_PTR(bundleName, "AbilityMissionStack", "invalid argument");
-    for (const auto missionRecord : missionRecords_) {
-        if (missionRecord != nullptr && missionRecord->IsSameMissionRecord(bundleName)) {
-            return missionRecord;
-        }
+    auto iterator = bundleIndex_.find(bundleName);
+    if (iterator == bundleIndex_.end()) {
+        return nullptr;
     }
-    return nullptr;
+    return iterator->second;
 }
 
 const AbilityMissionRecord *AbilityMissionStack::GetTopMissionRecord() const
 {
-    return missionRecords_.back();
+    return topMissionRecord_;
+}
+
+uint32_t AbilityMissionStack::GetMissionRecordCount() const
+{
+    return missionRecordCount_;
 }
 
 PageAbilityRecord *AbilityMissionStack::FindPageAbility(uint64_t token) const
 {
-    for (const auto missionRecord : missionRecords_) {
-        if (missionRecord == nullptr) {
-            continue;
-        }
+    for (auto missionRecord = bottomMissionRecord_; missionRecord != nullptr;
+        missionRecord = missionRecord->upperMissionRecord_) {
         PageAbilityRecord *record = missionRecord->FindPageAbility(token);
         if (record != nullptr) {
             return record;
@@ -133,8 +181,8 @@ PageAbilityRecord *AbilityMissionStack::FindPageAbility(const Want &want) const
 
 const PageAbilityRecord *AbilityMissionStack::GetTopPageAbility() const
 {
-    if (!missionRecords_.empty()) {
-        return missionRecords_.back()->GetTopPageAbility();
+    if (topMissionRecord_ != nullptr) {
+        return topMissionRecord_->GetTopPageAbility();
     }
     return nullptr;
 }
@@ -142,16 +190,15 @@ const PageAbilityRecord *AbilityMissionStack::GetTopPageAbility() const
 #ifdef OHOS_DEBUG
 AbilityMsStatus AbilityMissionStack::DumpMissionStack() const
 {
-    if (missionRecords_.size() <= 0) {
+    if (missionRecordCount_ == 0) {
         return AbilityMsStatus::DumpStatus("");
     }
     std::string stackType = (stackType_ == LAUNCHER) ? "launcher\n" : "default\n";
     std::string stackInfo = "MissionStack Type: " + stackType;
     AbilityMsStatus result = AbilityMsStatus::DumpStatus(stackInfo.c_str());
-    for (const auto missionRecord : missionRecords_) {
-        if (missionRecord != nullptr) {
-            result.DumpAppend(missionRecord->DumpMissionRecord());
-        }
+    for (auto missionRecord = bottomMissionRecord_; missionRecord != nullptr;
+        missionRecord = missionRecord->upperMissionRecord_) {
+        result.DumpAppend(missionRecord->DumpMissionRecord());
     }
     return result;
 }
@@ -33,6 +33,7 @@
 #include "ability_terminate_task.h"
 #include "app_restart_task.h"
 #include "app_terminate_task.h"
+#include "util/ability_trace.h"
 #include "util/abilityms_helper.h"
 
 namespace OHOS {
@@ -84,6 +85,7 @@ AbilityMsStatus AbilityWorker::TerminateService(const AbilityInfo &target, const
 AbilityMsStatus AbilityWorker::AbilityTransaction(const TransactionState &state)
 {
     PRINTD("AbilityWorker", "ability token(%{private}" PRIu64 "), state(%{public}d)", state.token, state.state);
+    ABILITY_TRACE(TRANSACTION_DONE, state.token, state.state);
     AbilityTask *task = nullptr;
     switch (state.state) {
         case STATE_BACKGROUND:
@@ -176,9 +178,9 @@ AbilityMsStatus AbilityWorker::DisconnectAbilityDone(uint64_t token)
     return connectDoneTask.Execute();
 }
 
-AbilityMsStatus AbilityWorker::DumpAbility(const AbilityDumpClient &client)
+AbilityMsStatus AbilityWorker::DumpAbility(const AbilityDumpClient &client, const char *extraInfo)
 {
-    AbilityDumpTask dumpTask(abilityMgrContext_, &client);
+    AbilityDumpTask dumpTask(abilityMgrContext_, &client, extraInfo);
     return dumpTask.Execute();
 }
 }  // namespace OHOS
@@ -16,13 +16,62 @@
 #include "app_manager.h"
 
 #define __STDC_FORMAT_MACROS
+#include <atomic>
 #include <cinttypes>
 #include <cstring>
+#include <ctime>
+#include <pthread.h>
 
 #include "token_generate.h"
 #include "util/abilityms_log.h"
 
 namespace OHOS {
+namespace {
+    constexpr uint64_t MS_PER_SECOND = 1000;
+    constexpr uint64_t NS_PER_MS = 1000000;
+
+    uint64_t GetMonotonicTimeMs()
+    {
+        struct timespec now = {};
+        (void) clock_gettime(CLOCK_MONOTONIC, &now);
+        return static_cast<uint64_t>(now.tv_sec) * MS_PER_SECOND + static_cast<uint64_t>(now.tv_nsec) / NS_PER_MS;
+    }
+
+    struct SpawnJob {
+        AppRecord *appRecord;
+        char *spawnMessage;
+        bool spawned;
+        uint64_t elapsedMs;
+    };
+
+    struct SpawnBatch {
+        AppSpawnClient *spawnClient;
+        std::vector<SpawnJob> *jobs;
+        std::atomic<uint32_t> next;
+    };
+
+    // only sends the prepared message and touches the app record of the job it takes, so the workers need no lock
+    void *SpawnWorker(void *arg)
+    {
+        auto batch = static_cast<SpawnBatch *>(arg);
+        for (uint32_t index = batch->next++; index < batch->jobs->size(); index = batch->next++) {
+            SpawnJob &job = (*batch->jobs)[index];
+            if (job.spawnMessage == nullptr) {
+                continue;
+            }
+            uint64_t begin = GetMonotonicTimeMs();
+            AbilityMsStatus status = batch->spawnClient->CallingInnerSpawnProcess(job.spawnMessage, *job.appRecord);
+            job.spawnMessage = nullptr;
+            job.elapsedMs += GetMonotonicTimeMs() - begin;
+            job.spawned = status.IsOk();
+            if (!job.spawned) {
+                status.LogStatus();
+            }
+        }
+        return nullptr;
+    }
+}
+
 AppRecord *AppManager::StartAppProcess(const BundleInfo &bundleInfo)
 {
     CHECK_NULLPTR_RETURN_PTR(bundleInfo.bundleName, "AppManager", "invalid argument");
@@ -33,6 +82,7 @@ AppRecord *AppManager::StartAppProcess(const BundleInfo &bundleInfo)
     }
     uint64_t token = TokenGenerate::GenerateToken();
     appRecord = new AppRecord(bundleInfo, token);
+    appRecord->SetSpawnTime(GetMonotonicTimeMs());
     AbilityMsStatus status = spawnClient_.SpawnProcess(*appRecord);
     if (!status.IsOk()) {
         status.LogStatus();
@@ -45,6 +95,64 @@ AppRecord *AppManager::StartAppProcess(const BundleInfo &bundleInfo)
     return appRecord;
 }
 
+void AppManager::StartAppProcesses(const std::vector<const BundleInfo *> &bundleInfos,
+    std::vector<AppBootTiming> &timings)
+{
+    std::vector<SpawnJob> jobs;
+    for (const auto bundleInfo : bundleInfos) {
+        if (bundleInfo == nullptr || bundleInfo->bundleName == nullptr ||
+            GetAppRecordByBundleName(bundleInfo->bundleName) != nullptr) {
+            continue;
+        }
+        SpawnJob job = {};
+        job.appRecord = new AppRecord(*bundleInfo, TokenGenerate::GenerateToken());
+        uint64_t begin = GetMonotonicTimeMs();
+        job.appRecord->SetSpawnTime(begin);
+        // the permission service is queried on this task only, the workers just send the messages
+        AbilityMsStatus status = spawnClient_.PrepareSpawnMessage(*job.appRecord, job.spawnMessage);
+        if (!status.IsOk()) {
+            status.LogStatus();
+        }
+        job.elapsedMs = GetMonotonicTimeMs() - begin;
+        jobs.emplace_back(job);
+    }
+    if (jobs.empty()) {
+        return;
+    }
+    // the workers share the appspawn proxy, get it before they start
+    (void) spawnClient_.Initialize();
+    SpawnBatch batch = { &spawnClient_, &jobs, { 0 } };
+    uint32_t workerCount = (BOOT_SPAWN_WORKERS < jobs.size()) ? BOOT_SPAWN_WORKERS : jobs.size();
+    std::vector<pthread_t> workers;
+    for (uint32_t i = 1; i < workerCount; ++i) {
+        pthread_t worker;
+        if (pthread_create(&worker, nullptr, SpawnWorker, &batch) == 0) {
+            workers.emplace_back(worker);
+        }
+    }
+    // this task is a worker too, it takes what the others have not
+    (void) SpawnWorker(&batch);
+    for (auto worker : workers) {
+        (void) pthread_join(worker, nullptr);
+    }
+    for (auto &job : jobs) {
+        timings.push_back({ job.appRecord->GetBundleInfo().bundleName, job.elapsedMs, 0, job.spawned });
+        if (!job.spawned) {
+            delete job.appRecord;
+            continue;
+        }
+        PRINTD("AppManager", "start app name:%{public}s, token: %{private}" PRIu64,
+            job.appRecord->GetBundleInfo().bundleName, job.appRecord->GetIdentityId());
+        appRecords_.emplace_back(job.appRecord);
+    }
+}
+
+void AppManager::SetBootReport(std::vector<AppBootTiming> &&timings, uint64_t totalMs)
+{
+    bootTimings_ = std::move(timings);
+    bootTotalMs_ = totalMs;
+}
+
 void AppManager::RemoveAppRecord(const AppRecord &appRecord)
 {
     for (auto iterator = appRecords_.begin(); iterator != appRecords_.end();) {
@@ -109,4 +217,51 @@ AppRecord *AppManager::GetAppRecordByBundleName(const char *bundleName)
     }
     return nullptr;
 }
+
+void AppManager::OnAppAttached(const AppRecord &appRecord)
+{
+    uint64_t elapsed = GetMonotonicTimeMs() - appRecord.GetSpawnTime();
+    attachStat_.count++;
+    attachStat_.totalMs += elapsed;
+    if (elapsed > attachStat_.maxMs) {
+        attachStat_.maxMs = elapsed;
+    }
+    PRINTD("AppManager", "%{public}s attached %{public}" PRIu64 " ms after spawn",
+        appRecord.GetBundleInfo().bundleName, elapsed);
+}
+
+void AppManager::DumpAttachStat(const AttachStat &stat, std::string &info)
+{
+    info += "    attach: " + std::to_string(stat.count);
+    if (stat.count > 0) {
+        info += ", avg " + std::to_string(stat.totalMs / stat.count) + " ms, max " + std::to_string(stat.maxMs) +
+            " ms";
+    }
+    info += "\n";
+}
+
+void AppManager::DumpBootReport(std::string &info) const
+{
+    if (bootTimings_.empty()) {
+        return;
+    }
+    info += "Keep-alive boot: " + std::to_string(bootTotalMs_) + " ms\n";
+    for (const auto &timing : bootTimings_) {
+        info += "    " + timing.bundleName;
+        if (!timing.spawned) {
+            info += ": spawn failed after " + std::to_string(timing.spawnMs) + " ms\n";
+            continue;
+        }
+        info += ": spawn " + std::to_string(timing.spawnMs) + " ms, start " + std::to_string(timing.startMs) +
+            " ms\n";
+    }
+}
+
+AbilityMsStatus AppManager::DumpSpawnInfo() const
+{
+    std::string info = "App spawn:\n";
+    DumpAttachStat(attachStat_, info);
+    DumpBootReport(info);
+    return AbilityMsStatus::DumpStatus(info.c_str());
+}
 }
@@ -20,6 +20,7 @@
 #include "page_ability_record.h"
 #include "pms.h"
 #include "securec.h"
+#include "util/ability_trace.h"
 #include "utils.h"
 
 namespace OHOS {
@@ -55,6 +56,16 @@ const BundleInfo &AppRecord::GetBundleInfo() const
     return bundleInfo_;
 }
 
+void AppRecord::SetSpawnTime(uint64_t spawnTime)
+{
+    spawnTime_ = spawnTime;
+}
+
+uint64_t AppRecord::GetSpawnTime() const
+{
+    return spawnTime_;
+}
+
 AbilityMsStatus AppRecord::LoadPermission() const
 {
     int ret = LoadPermissions(bundleInfo_.bundleName, bundleInfo_.uid);
@@ -87,10 +98,16 @@ AbilityMsStatus AppRecord::SetAbilityThreadClient(const AbilityThreadClient &cli
     return abilityThreadClient_->Initialize(bundleInfo_.bundleName);
 }
 
+bool AppRecord::IsAwaitingAbility() const
+{
+    return abilityThreadClient_ == nullptr && pendingAbilityRecord_ == nullptr;
+}
+
 AbilityMsStatus AppRecord::AbilityTransaction(const TransactionState &state,
     const Want &want, AbilityType abilityType) const
 {
     if (abilityThreadClient_ != nullptr) {
+        ABILITY_TRACE(SCHEDULE_TRANSACTION, state.token, state.state);
         return abilityThreadClient_->AbilityTransaction(state, want, abilityType);
     }
     return AbilityMsStatus::AppTransanctStatus("life cycle ability thread client not exist");
@@ -125,6 +142,11 @@ void AppRecord::SetPendingAbility(PageAbilityRecord *abilityRecord)
     pendingAbilityRecord_ = abilityRecord;
 }
 
+uint64_t AppRecord::GetPendingAbilityToken() const
+{
+    return (pendingAbilityRecord_ != nullptr) ? pendingAbilityRecord_->GetToken() : identityId_;
+}
+
 AbilityMsStatus AppRecord::LaunchPendingAbility()
 {
     if (pendingAbilityRecord_ != nullptr) {
@@ -33,13 +33,14 @@
 
 namespace OHOS {
 const int MAX_MODULE_SIZE = 16;
-AbilityThreadClient::AbilityThreadClient(uint64_t token, pid_t pid, const SvcIdentity &svcIdentity,
-    OnRemoteDead handler) : token_(token), pid_(pid), svcIdentity_(svcIdentity), deathHandler_(handler)
+AbilityThreadClient::AbilityThreadClient(uint64_t token, pid_t pid, uid_t uid, const SvcIdentity &svcIdentity,
+    OnRemoteDead handler) : token_(token), pid_(pid), uid_(uid), svcIdentity_(svcIdentity), deathHandler_(handler)
 {
 }
 
 AbilityThreadClient::AbilityThreadClient(const AbilityThreadClient &client)
-    : token_(client.token_), pid_(client.pid_), svcIdentity_(client.svcIdentity_), deathHandler_(client.deathHandler_)
+    : token_(client.token_), pid_(client.pid_), uid_(client.uid_), svcIdentity_(client.svcIdentity_),
+      deathHandler_(client.deathHandler_)
 {
 }
 
@@ -94,7 +95,7 @@ AbilityMsStatus AbilityThreadClient::AbilityTransaction(const TransactionState &
     WriteInt32(&req, state.state);
     WriteUint64(&req, state.token);
     WriteInt32(&req, abilityType);
-    if (!SerializeWant(&req, &want)) {
+    if (!SerializeWantTo(&req, &want, uid_)) {
         return AbilityMsStatus::AppTransanctStatus("SerializeWant failed");
     }
     MessageOption option;
@@ -161,7 +162,7 @@ AbilityMsStatus AbilityThreadClient::ConnectAbility(const Want &want, uint64_t t
     char data[MAX_IO_SIZE];
     IpcIoInit(&req, data, MAX_IO_SIZE, MAX_OBJECTS);
     WriteUint64(&req, token);
-    if (!SerializeWant(&req, &want)) {
+    if (!SerializeWantTo(&req, &want, uid_)) {
         return AbilityMsStatus::TaskStatus("connectAbility", "SerializeWant failed");
     }
     MessageOption option;
@@ -181,7 +182,7 @@ AbilityMsStatus AbilityThreadClient::DisconnectAbility(const Want &want, uint64_
     char data[MAX_IO_SIZE];
     IpcIoInit(&req, data, MAX_IO_SIZE, MAX_OBJECTS);
     WriteUint64(&req, token);
-    if (!SerializeWant(&req, &want)) {
+    if (!SerializeWantTo(&req, &want, uid_)) {
         return AbilityMsStatus::TaskStatus("disconnectAbility", "SerializeWant failed");
     }
     MessageOption option;
@@ -247,7 +248,7 @@ AbilityMsStatus AbilityThreadClient::DumpAbilityTransaction(const Want &want, ui
     IpcIo req;
     char data[MAX_IO_SIZE];
     IpcIoInit(&req, data, MAX_IO_SIZE, MAX_OBJECTS);
-    if (!SerializeWant(&req, &want)) {
+    if (!SerializeWantTo(&req, &want, uid_)) {
         return AbilityMsStatus::TaskStatus("dumpAbility", "SerializeWant failed");
     }
     MessageOption option;
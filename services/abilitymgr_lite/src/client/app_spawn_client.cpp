@@ -73,6 +73,7 @@ AbilityMsStatus AppSpawnClient::CallingInnerSpawnProcess(char *spawnMessage, App
     char data[MAX_IO_SIZE];
     IpcIoInit(&request, data, MAX_IO_SIZE, 0);
     WriteString(&request, spawnMessage);
+    cJSON_free(spawnMessage);
     pid_t pid = -1;
     int result = spawnClient_->Invoke(spawnClient_, ID_CALL_CREATE_SERVICE, &request, &pid, Notify);
     int retry = 0;
@@ -90,17 +91,45 @@ AbilityMsStatus AppSpawnClient::CallingInnerSpawnProcess(char *spawnMessage, App
 }
 
 AbilityMsStatus AppSpawnClient::SpawnProcess(AppRecord &appRecord)
+{
+    char *spawnMessage = nullptr;
+    AbilityMsStatus status = PrepareSpawnMessage(appRecord, spawnMessage);
+    if (!status.IsOk()) {
+        return status;
+    }
+    return CallingInnerSpawnProcess(spawnMessage, appRecord);
+}
+
+AbilityMsStatus AppSpawnClient::PrepareSpawnMessage(AppRecord &appRecord, char *&spawnMessage)
 {
     char *innerBundleName = appRecord.GetBundleInfo().bundleName;
     if (innerBundleName == nullptr) {
         return AbilityMsStatus::ProcessStatus("invalid argument");
     }
 
+    // capabilities are queried for every spawn, a permission revoked since the last start must not be granted again
+    uint32_t *capabilities = nullptr;
+    uint32_t capNums = 0;
+    AbilityMsStatus status = appRecord.QueryAppCapability(innerBundleName, &capabilities, &capNums);
+    if (!status.IsOk()) {
+        free(capabilities);
+        return AbilityMsStatus::ProcessStatus("SpawnProcess QueryAppCapability unsuccessfully");
+    }
+    spawnMessage = BuildSpawnMessage(appRecord, capabilities, capNums);
+    free(capabilities);
+    if (spawnMessage == nullptr) {
+        return AbilityMsStatus::ProcessStatus("SpawnProcess build spawn message unsuccessfully");
+    }
+    return AbilityMsStatus::Ok();
+}
+
+char *AppSpawnClient::BuildSpawnMessage(const AppRecord &appRecord, const uint32_t *capabilities, uint32_t capNums)
+{
     cJSON *root = cJSON_CreateObject();
     if (root == nullptr) {
-        return AbilityMsStatus::ProcessStatus("SpawnProcess create fail");
+        return nullptr;
     }
-    cJSON_AddStringToObject(root, "bundleName", innerBundleName);
+    cJSON_AddStringToObject(root, "bundleName", appRecord.GetBundleInfo().bundleName);
     std::string identityId = std::to_string(appRecord.GetIdentityId());
     cJSON_AddStringToObject(root, "identityID", identityId.c_str());
     cJSON_AddNumberToObject(root, "uID", appRecord.GetBundleInfo().uid);
@@ -109,33 +138,20 @@ AbilityMsStatus AppSpawnClient::SpawnProcess(AppRecord &appRecord)
     cJSON *caps = cJSON_AddArrayToObject(root, "capability");
     if (caps == nullptr) {
         cJSON_Delete(root);
-        return AbilityMsStatus::ProcessStatus("SpawnProcess create array unsuccessfully");
+        return nullptr;
     }
-
-    uint32_t *capabilities = nullptr;
-    uint32_t capNums = 0;
-    AbilityMsStatus status = appRecord.QueryAppCapability(innerBundleName, &capabilities, &capNums);
-    if (!status.IsOk()) {
-        cJSON_Delete(root);
-        return AbilityMsStatus::ProcessStatus("SpawnProcess QueryAppCapability unsuccessfully");
-    }
-    if ((capabilities != nullptr) && (capNums != 0)) {
-        for (int32_t i = 0; i < capNums; ++i) {
+    if (capabilities != nullptr) {
+        for (uint32_t i = 0; i < capNums; ++i) {
             cJSON *item = cJSON_CreateNumber(capabilities[i]);
             if ((item == nullptr) || !cJSON_AddItemToArray(caps, item)) {
-                free(capabilities);
-                capabilities = nullptr;
                 cJSON_Delete(item);
                 cJSON_Delete(root);
-                return AbilityMsStatus::ProcessStatus("SpawnProcess add item to array unsuccessfully");
+                return nullptr;
             }
         }
-        free(capabilities);
-        capabilities = nullptr;
     }
     char *spawnMessage = cJSON_PrintUnformatted(root);
     cJSON_Delete(root);
-
-    return CallingInnerSpawnProcess(spawnMessage, appRecord);
+    return spawnMessage;
 }
 } // namespace OHOS
@@ -15,12 +15,24 @@
 
 #include "client/bundlems_client.h"
 
+#include <cstring>
+
+#include "ability_info_utils.h"
+#include "adapter.h"
 #include "appexecfwk_errors.h"
+#include "bundle_info_utils.h"
 #include "samgr_lite.h"
+#include "utils.h"
 
 namespace OHOS {
 BundleMsClient::~BundleMsClient()
 {
+    for (auto &entry : bundleCache_) {
+        ReleaseBundleEntry(entry);
+    }
+    for (auto &entry : abilityCache_) {
+        ReleaseAbilityEntry(entry);
+    }
     bmsServerProxy_ = nullptr;
 }
 
@@ -42,10 +54,38 @@ AbilityMsStatus BundleMsClient::QueryAbilityInfo(const Want *want, AbilityInfo *
     if (bmsServerProxy_ == nullptr) {
         return AbilityMsStatus::BmsQueryStatus("bms server proxy is nullptr");
     }
+    const char *bundleName = nullptr;
+    const char *abilityName = nullptr;
+    if (want != nullptr && want->element != nullptr) {
+        bundleName = want->element->bundleName;
+        abilityName = want->element->abilityName;
+    }
+    AbilityCacheEntry *entry = FindAbilityEntry(bundleName, abilityName);
+    if (entry != nullptr) {
+        abilityHits_++;
+        entry->lastUse = ++useClock_;
+        AbilityInfoUtils::CopyAbilityInfo(result, entry->abilityInfo);
+        return AbilityMsStatus::Ok();
+    }
+    abilityMisses_++;
     if (bmsServerProxy_->QueryAbilityInfo(want, result) != ERR_OK) {
         ClearAbilityInfo(result);
         return AbilityMsStatus::BmsQueryStatus("query ability info failure");
     }
+    if (bundleName == nullptr || abilityName == nullptr) {
+        return AbilityMsStatus::Ok();
+    }
+    entry = AcquireAbilityEntry();
+    entry->bundleName = Utils::Strdup(bundleName);
+    entry->abilityName = Utils::Strdup(abilityName);
+    if (entry->bundleName == nullptr || entry->abilityName == nullptr) {
+        ReleaseAbilityEntry(*entry);
+        return AbilityMsStatus::Ok();
+    }
+    AbilityInfoUtils::CopyAbilityInfo(&entry->abilityInfo, *result);
+    entry->generation = generation_;
+    entry->lastUse = ++useClock_;
+    entry->valid = true;
     return AbilityMsStatus::Ok();
 }
 
@@ -54,9 +94,38 @@ AbilityMsStatus BundleMsClient::QueryBundleInfo(const char* bundleName, BundleIn
     if (bmsServerProxy_ == nullptr) {
         return AbilityMsStatus::BmsQueryStatus("bms service proxy is nullptr");
     }
-    if (bmsServerProxy_->GetBundleInfo(bundleName, 1, bundleInfo) != ERR_OK) {
+    // the caller gets a deep copy of its own, so an eviction or invalidation never frees what it still uses
+    BundleCacheEntry *entry = FindBundleEntry(bundleName);
+    if (entry != nullptr) {
+        bundleHits_++;
+        entry->lastUse = ++useClock_;
+        return CopyBundleInfoToCaller(entry->bundleInfo, bundleInfo);
+    }
+    bundleMisses_++;
+    BundleInfo queried = {};
+    if (bmsServerProxy_->GetBundleInfo(bundleName, 1, &queried) != ERR_OK) {
         return AbilityMsStatus::BmsQueryStatus("query bundle info failure");
     }
+    // the caller does not own what GetBundleInfo returns, so the cache keeps a deep copy of its own
+    entry = AcquireBundleEntry();
+    BundleInfoUtils::CopyBundleInfo(1, &entry->bundleInfo, queried);
+    if (entry->bundleInfo.bundleName == nullptr) {
+        ReleaseBundleEntry(*entry);
+        return CopyBundleInfoToCaller(queried, bundleInfo);
+    }
+    entry->generation = generation_;
+    entry->lastUse = ++useClock_;
+    entry->valid = true;
+    return CopyBundleInfoToCaller(entry->bundleInfo, bundleInfo);
+}
+
+AbilityMsStatus BundleMsClient::CopyBundleInfoToCaller(const BundleInfo &source, BundleInfo *bundleInfo)
+{
+    BundleInfoUtils::CopyBundleInfo(1, bundleInfo, source);
+    if (bundleInfo->bundleName == nullptr) {
+        ClearBundleInfo(bundleInfo);
+        return AbilityMsStatus::BmsQueryStatus("copy bundle info failure");
+    }
     return AbilityMsStatus::Ok();
 }
 
@@ -70,4 +139,107 @@ AbilityMsStatus BundleMsClient::QueryKeepAliveBundleInfos(BundleInfo **bundleInf
     }
     return AbilityMsStatus::Ok();
 }
+
+void BundleMsClient::InvalidateCache(const char *bundleName)
+{
+    if (bundleName == nullptr) {
+        // entries of an older generation are dropped lazily when their slot is reused
+        generation_++;
+        return;
+    }
+    for (auto &entry : bundleCache_) {
+        if (entry.valid && entry.bundleInfo.bundleName != nullptr &&
+            strcmp(entry.bundleInfo.bundleName, bundleName) == 0) {
+            ReleaseBundleEntry(entry);
+        }
+    }
+    for (auto &entry : abilityCache_) {
+        if (entry.valid && strcmp(entry.bundleName, bundleName) == 0) {
+            ReleaseAbilityEntry(entry);
+        }
+    }
+}
+
+AbilityMsStatus BundleMsClient::DumpCacheInfo() const
+{
+    std::string info = "BMS query cache:\n";
+    info += "    bundle hits: " + std::to_string(bundleHits_) + ", misses: " + std::to_string(bundleMisses_) + "\n";
+    info += "    ability hits: " + std::to_string(abilityHits_) + ", misses: " + std::to_string(abilityMisses_) +
+        "\n";
+    return AbilityMsStatus::DumpStatus(info.c_str());
+}
+
+BundleMsClient::BundleCacheEntry *BundleMsClient::FindBundleEntry(const char *bundleName) const
+{
+    if (bundleName == nullptr) {
+        return nullptr;
+    }
+    for (auto &entry : bundleCache_) {
+        if (entry.valid && entry.generation == generation_ && strcmp(entry.bundleInfo.bundleName, bundleName) == 0) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+BundleMsClient::AbilityCacheEntry *BundleMsClient::FindAbilityEntry(const char *bundleName,
+    const char *abilityName) const
+{
+    if (bundleName == nullptr || abilityName == nullptr) {
+        return nullptr;
+    }
+    for (auto &entry : abilityCache_) {
+        if (entry.valid && entry.generation == generation_ && strcmp(entry.bundleName, bundleName) == 0 &&
+            strcmp(entry.abilityName, abilityName) == 0) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+BundleMsClient::BundleCacheEntry *BundleMsClient::AcquireBundleEntry() const
+{
+    BundleCacheEntry *victim = &bundleCache_[0];
+    for (auto &entry : bundleCache_) {
+        if (!entry.valid || entry.generation != generation_) {
+            victim = &entry;
+            break;
+        }
+        if (entry.lastUse < victim->lastUse) {
+            victim = &entry;
+        }
+    }
+    ReleaseBundleEntry(*victim);
+    return victim;
+}
+
+BundleMsClient::AbilityCacheEntry *BundleMsClient::AcquireAbilityEntry() const
+{
+    AbilityCacheEntry *victim = &abilityCache_[0];
+    for (auto &entry : abilityCache_) {
+        if (!entry.valid || entry.generation != generation_) {
+            victim = &entry;
+            break;
+        }
+        if (entry.lastUse < victim->lastUse) {
+            victim = &entry;
+        }
+    }
+    ReleaseAbilityEntry(*victim);
+    return victim;
+}
+
+void BundleMsClient::ReleaseBundleEntry(BundleCacheEntry &entry)
+{
+    ClearBundleInfo(&entry.bundleInfo);
+    entry = {};
+}
+
+void BundleMsClient::ReleaseAbilityEntry(AbilityCacheEntry &entry)
+{
+    AdapterFree(entry.bundleName);
+    AdapterFree(entry.abilityName);
+    ClearAbilityInfo(&entry.abilityInfo);
+    entry = {};
+}
 } // namespace OHOS
@@ -23,6 +23,7 @@
 #include "bundle_info_utils.h"
 #include "securec.h"
 #include "token_generate.h"
+#include "util/ability_trace.h"
 #include "util/abilityms_helper.h"
 
 namespace OHOS {
@@ -232,6 +233,9 @@ void PageAbilityRecord::pushConnectRecord(AbilityConnectRecord *connectRecord)
         return;
     }
     connectRecords_.emplace_back(connectRecord);
+    if (connectMission_ != nullptr && connectRecord != nullptr) {
+        connectMission_->AddConnectIndex(*this, *connectRecord);
+    }
 }
 
 void PageAbilityRecord::RemoveConnectRecord(const SvcIdentity &serviceSid)
@@ -241,6 +245,9 @@ void PageAbilityRecord::RemoveConnectRecord(const SvcIdentity &serviceSid)
         if (record != nullptr && record->GetConnectSid().handle == serviceSid.handle &&
             record->GetConnectSid().token == serviceSid.token) {
             connectRecords_.erase(iterator);
+            if (connectMission_ != nullptr) {
+                connectMission_->RemoveConnectIndex(*this, *record);
+            }
             delete record;
             return;
         }
@@ -256,6 +263,7 @@ AbilityMsStatus PageAbilityRecord::StartAbility()
 {
     if (appRecord_ == nullptr) {
         // If process is not exist, start process.
+        ABILITY_TRACE(SPAWN_PROCESS, token_, STATE_INITIAL);
         appRecord_ = AppManager::GetInstance().StartAppProcess(bundleInfo_);
         if (appRecord_ == nullptr) {
             return AbilityMsStatus::ProcessStatus("start app process fail");
@@ -263,6 +271,11 @@ AbilityMsStatus PageAbilityRecord::StartAbility()
         appRecord_->SetPendingAbility(this);
         return AbilityMsStatus::Ok();
     }
+    if (appRecord_->IsAwaitingAbility()) {
+        // the process was spawned ahead of its ability at boot, launch it once the process attaches
+        appRecord_->SetPendingAbility(this);
+        return AbilityMsStatus::Ok();
+    }
     return ActiveAbility();
 }
 
@@ -270,6 +283,7 @@ AbilityMsStatus PageAbilityRecord::StartService()
 {
     if (appRecord_ == nullptr) {
         // If process is not exist, start process.
+        ABILITY_TRACE(SPAWN_PROCESS, token_, STATE_INITIAL);
         appRecord_ = AppManager::GetInstance().StartAppProcess(bundleInfo_);
         if (appRecord_ == nullptr) {
             return AbilityMsStatus::ProcessStatus("start app process fail");
@@ -277,9 +291,21 @@ AbilityMsStatus PageAbilityRecord::StartService()
         appRecord_->SetPendingAbility(this);
         return AbilityMsStatus::Ok();
     }
+    if (appRecord_->IsAwaitingAbility()) {
+        appRecord_->SetPendingAbility(this);
+        return AbilityMsStatus::Ok();
+    }
     return InactiveAbility();
 }
 
+void PageAbilityRecord::SetStartCallback(const Want &want)
+{
+    // a reused record dropped the identity of its first caller when it became active
+    if (want.sid != nullptr) {
+        SetWantSvcIdentity(&want_, *(want.sid));
+    }
+}
+
 AbilityMsStatus PageAbilityRecord::ActiveAbility()
 {
     if (currentState_ == STATE_ACTIVE) {
@@ -470,6 +496,9 @@ void PageAbilityRecord::RemoveConnectRecordByPageToken(uint64_t token)
         auto record = *iterator;
         if (record != nullptr && record->GetAbilityToken() == token) {
             iterator = connectRecords_.erase(iterator);
+            if (connectMission_ != nullptr) {
+                connectMission_->RemoveConnectIndex(*this, *record);
+            }
             delete record;
         } else {
             ++iterator;
@@ -490,4 +519,9 @@ AbilityConnectRecord *PageAbilityRecord::GetConnectRecord(const SvcIdentity &ser
     }
     return nullptr;
 }
+
+const std::list<AbilityConnectRecord *> &PageAbilityRecord::GetConnectRecords() const
+{
+    return connectRecords_;
+}
 }
@@ -23,7 +23,16 @@
 
 namespace OHOS {
 namespace AbilitySlite {
+namespace {
+    constexpr uint32_t MS_PER_SECOND = 1000;
+    constexpr uint32_t MAX_IDLE_SCORE = 3600;
+    constexpr uint32_t FOOTPRINT_SCORE_UNIT = 128;
+    constexpr int32_t TEMPORARY_BUNDLE_SCORE = 600;
+}
+
 AbilityList::AbilityList()
+    : tokenIndex_(ABILITY_LIST_CAPACITY + 1, TokenHash),
+      bundleNameIndex_(ABILITY_LIST_CAPACITY + 1, BundleNameHash)
 {
     abilityListMutex_ = osMutexNew(reinterpret_cast<osMutexAttr_t *>(NULL));
 }
@@ -33,35 +42,96 @@ AbilityList::~AbilityList()
     osMutexDelete(abilityListMutex_);
 }
 
+uint32_t AbilityList::TokenHash(const AbilityRecord &abilityRecord)
+{
+    return AbilityRecordIndex::HashToken(abilityRecord.token);
+}
+
+uint32_t AbilityList::BundleNameHash(const AbilityRecord &abilityRecord)
+{
+    return abilityRecord.appNameHash;
+}
+
+bool AbilityList::MatchToken(const AbilityRecord &abilityRecord, const void *key)
+{
+    return abilityRecord.token == *static_cast<const uint16_t *>(key);
+}
+
+bool AbilityList::MatchBundleName(const AbilityRecord &abilityRecord, const void *key)
+{
+    return (abilityRecord.appName != nullptr) && (strcmp(abilityRecord.appName, static_cast<const char *>(key)) == 0);
+}
+
+bool AbilityList::IsMoreRecent(const AbilityRecord &candidate, const AbilityRecord &current)
+{
+    // the difference stays right when the stamps wrap around
+    return static_cast<int32_t>(candidate.linkSeq - current.linkSeq) > 0;
+}
+
+void AbilityList::LinkFront(AbilityRecord *abilityRecord)
+{
+    abilityRecord->linkSeq = ++linkSeq_;
+    abilityRecord->prev = nullptr;
+    abilityRecord->next = head_;
+    if (head_ != nullptr) {
+        head_->prev = abilityRecord;
+    } else {
+        tail_ = abilityRecord;
+    }
+    head_ = abilityRecord;
+    size_++;
+    tokenIndex_.Insert(abilityRecord);
+    bundleNameIndex_.Insert(abilityRecord);
+}
+
+void AbilityList::Unlink(AbilityRecord *abilityRecord)
+{
+    tokenIndex_.Remove(abilityRecord);
+    bundleNameIndex_.Remove(abilityRecord);
+    if (abilityRecord->prev != nullptr) {
+        abilityRecord->prev->next = abilityRecord->next;
+    } else {
+        head_ = abilityRecord->next;
+    }
+    if (abilityRecord->next != nullptr) {
+        abilityRecord->next->prev = abilityRecord->prev;
+    } else {
+        tail_ = abilityRecord->prev;
+    }
+    abilityRecord->prev = nullptr;
+    abilityRecord->next = nullptr;
+    size_--;
+}
+
 void AbilityList::Add(AbilityRecord *abilityRecord)
 {
     AbilityLockGuard locker(abilityListMutex_);
     if (abilityRecord == nullptr) {
         return;
     }
-    if (abilityList_.Size() >= ABILITY_LIST_CAPACITY) {
-        PopBottomAbility();
+    if (Get(abilityRecord->token) != nullptr) {
+        return;
     }
-
-    if (Get(abilityRecord->token) == nullptr) {
-        abilityList_.PushFront(abilityRecord);
+    while (size_ >= ABILITY_LIST_CAPACITY) {
+        if (!EvictAbility(0, false)) {
+            // every candidate is kept by the policy, the capacity still bounds the list
+            PopBottomAbility();
+            break;
+        }
     }
+    uint32_t reserve = abilityRecord->GetFootprint();
+    while (memoryBudget_ > 0 && GetFootprint() + reserve > memoryBudget_) {
+        if (!EvictAbility(reserve, true)) {
+            break;
+        }
+    }
+    LinkFront(abilityRecord);
 }
 
 AbilityRecord *AbilityList::Get(uint16_t token) const
 {
     AbilityLockGuard locker(abilityListMutex_);
-    for (auto node = abilityList_.Begin(); node != abilityList_.End(); node = node->next_) {
-        AbilityRecord *record = node->value_;
-        if (record == nullptr) {
-            continue;
-        }
-        if (record->token == token) {
-            return record;
-        }
-    }
-
-    return nullptr;
+    return tokenIndex_.Find(AbilityRecordIndex::HashToken(token), MatchToken, &token);
 }
 
 AbilityRecord *AbilityList::Get(const char *bundleName) const
@@ -71,26 +141,15 @@ AbilityRecord *AbilityList::Get(const char *bundleName) const
     }
 
     AbilityLockGuard locker(abilityListMutex_);
-    for (auto node = abilityList_.Begin(); node != abilityList_.End(); node = node->next_) {
-        AbilityRecord *record = node->value_;
-        if (record == nullptr || record->appName == nullptr) {
-            continue;
-        }
-        if (strcmp(bundleName, record->appName) == 0) {
-            return record;
-        }
-    }
-    return nullptr;
+    // several records may share a bundle name, the list walk this replaces returned the most recently used one
+    return bundleNameIndex_.Find(AbilityRecordIndex::HashBundleName(bundleName), MatchBundleName, bundleName,
+        IsMoreRecent);
 }
 
 AbilityRecord *AbilityList::GetByTaskId(uint32_t taskId) const
 {
     AbilityLockGuard locker(abilityListMutex_);
-    for (auto node = abilityList_.Begin(); node != abilityList_.End(); node = node->next_) {
-        AbilityRecord *record = node->value_;
-        if (record == nullptr) {
-            continue;
-        }
+    for (AbilityRecord *record = head_; record != nullptr; record = record->next) {
         if (record->taskId == taskId) {
             return record;
         }
@@ -101,25 +160,19 @@ AbilityRecord *AbilityList::GetByTaskId(uint32_t taskId) const
 void AbilityList::Erase(uint16_t token)
 {
     AbilityLockGuard locker(abilityListMutex_);
-    for (auto node = abilityList_.Begin(); node != abilityList_.End(); node = node->next_) {
-        AbilityRecord *record = node->value_;
-        if (record == nullptr) {
-            continue;
-        }
-        if (record->token == token) {
-            abilityList_.Remove(node);
-            return;
-        }
+    AbilityRecord *record = Get(token);
+    if (record == nullptr) {
+        return;
     }
+    Unlink(record);
 }
 
 void AbilityList::GetAbilityList(uint32_t mission, List<uint32_t> &result)
 {
     AbilityLockGuard locker(abilityListMutex_);
 
-    for (auto node = abilityList_.Begin(); node != abilityList_.End(); node = node->next_) {
-        AbilityRecord *record = node->value_;
-        if ((record != nullptr) && (record->mission == mission)) {
+    for (AbilityRecord *record = head_; record != nullptr; record = record->next) {
+        if (record->mission == mission) {
             result.PushFront(record->token);
         }
     }
@@ -128,7 +181,7 @@ void AbilityList::GetAbilityList(uint32_t mission, List<uint32_t> &result)
 uint32_t AbilityList::Size() const
 {
     AbilityLockGuard locker(abilityListMutex_);
-    return abilityList_.Size();
+    return size_;
 }
 
 bool AbilityList::MoveToTop(uint16_t token)
@@ -138,24 +191,26 @@ bool AbilityList::MoveToTop(uint16_t token)
     if (abilityRecord == nullptr) {
         return false;
     }
-    Erase(token);
-    Add(abilityRecord);
+    if (abilityRecord == head_) {
+        return true;
+    }
+    Unlink(abilityRecord);
+    LinkFront(abilityRecord);
     return true;
 }
 
 void AbilityList::PopAbility()
 {
     AbilityLockGuard locker(abilityListMutex_);
-    abilityList_.PopFront();
+    if (head_ != nullptr) {
+        Unlink(head_);
+    }
 }
 
 AbilityRecord *AbilityList::GetTopAbility() const
 {
     AbilityLockGuard locker(abilityListMutex_);
-    if (abilityList_.Size() != 0) {
-        return abilityList_.Front();
-    }
-    return nullptr;
+    return head_;
 }
 
 MissionInfoList *AbilityList::GetMissionInfos(uint32_t maxNum) const
@@ -166,7 +221,7 @@ MissionInfoList *AbilityList::GetMissionInfos(uint32_t maxNum) const
         HILOG_ERROR(HILOG_MODULE_AAFWK, "Failed to new MissionInfoList.");
         return nullptr;
     }
-    missionInfoList->length = abilityList_.Size();
+    missionInfoList->length = size_;
     if (maxNum != 0) {
         missionInfoList->length = (missionInfoList->length > maxNum) ? maxNum : missionInfoList->length;
     }
@@ -177,8 +232,8 @@ MissionInfoList *AbilityList::GetMissionInfos(uint32_t maxNum) const
         return nullptr;
     }
     uint32_t i = 0;
-    for (auto it = abilityList_.Begin(); i < missionInfoList->length; it = it->next_) {
-        missionInfoList->missionInfos[i++].SetAppName(it->value_->appName);
+    for (AbilityRecord *record = head_; i < missionInfoList->length; record = record->next) {
+        missionInfoList->missionInfos[i++].SetAppName(record->appName);
     }
     return missionInfoList;
 }
@@ -186,59 +241,145 @@ MissionInfoList *AbilityList::GetMissionInfos(uint32_t maxNum) const
 void AbilityList::PopBottomAbility()
 {
     AbilityLockGuard locker(abilityListMutex_);
-    AbilityRecord *lastRecord = abilityList_.Back();
+    AbilityRecord *lastRecord = tail_;
     if (lastRecord == nullptr) {
-        abilityList_.PopBack();
         return;
     }
     if (!IsPermanentAbility(*lastRecord)) {
-        abilityList_.PopBack();
-        delete lastRecord;
+        Unlink(lastRecord);
+        EvictRecord(lastRecord, GetEvictionInfo(*lastRecord, osKernelGetTickCount()));
         return;
     }
-    // last record is home
-    abilityList_.PopBack(); // pop home
-    AbilityRecord *secondLastRecord = abilityList_.Back();
-    abilityList_.PopBack(); // pop secondLastRecord
-    delete secondLastRecord;
-    abilityList_.PushBack(lastRecord); // push back home
+    // last record is home, keep it at the bottom and pop the record above it
+    AbilityRecord *secondLastRecord = lastRecord->prev;
+    if (secondLastRecord == nullptr) {
+        return;
+    }
+    Unlink(secondLastRecord);
+    EvictRecord(secondLastRecord, GetEvictionInfo(*secondLastRecord, osKernelGetTickCount()));
 }
 
-int32_t AbilityList::PopAllAbility(const char *excludedBundleName)
+void AbilityList::SetEvictionPolicy(AbilityEvictionPolicy *policy)
 {
     AbilityLockGuard locker(abilityListMutex_);
-    OHOS::List<AbilityRecord *> reservedRecordList {};
-    AbilityRecord *topRecord = abilityList_.Front();
-    if (topRecord == nullptr) {
-        return PARAM_NULL_ERROR;
+    evictionPolicy_ = policy;
+}
+
+void AbilityList::SetMemoryBudget(uint32_t budget)
+{
+    AbilityLockGuard locker(abilityListMutex_);
+    memoryBudget_ = budget;
+}
+
+uint32_t AbilityList::GetFootprint() const
+{
+    AbilityLockGuard locker(abilityListMutex_);
+    uint32_t footprint = 0;
+    for (AbilityRecord *record = head_; record != nullptr; record = record->next) {
+        footprint += record->GetFootprint();
     }
-    abilityList_.PopFront();
-    reservedRecordList.PushFront(topRecord);
+    return footprint;
+}
 
-    while (abilityList_.Size() > 0) {
-        AbilityRecord *record = abilityList_.Front();
-        abilityList_.PopFront();
-        if (record == nullptr) {
-            continue;
+void AbilityList::TrimToBudget()
+{
+    AbilityLockGuard locker(abilityListMutex_);
+    while (memoryBudget_ > 0 && GetFootprint() > memoryBudget_) {
+        if (!EvictAbility(0, true)) {
+            break;
         }
-        if (AbilityList::IsPermanentAbility(*record)) {
-            reservedRecordList.PushFront(record);
+    }
+}
+
+bool AbilityList::EvictAbility(uint32_t reserve, bool overBudget)
+{
+    uint32_t now = osKernelGetTickCount();
+    AbilityRecord *victim = nullptr;
+    AbilityEvictionInfo victimInfo;
+    int32_t victimScore = -1;
+    // the top record and records with a live app task are never evicted, ties go to the bottom-most record
+    for (AbilityRecord *record = tail_; record != nullptr && record != head_; record = record->prev) {
+        if (IsPermanentAbility(*record) || record->abilityThread != nullptr) {
             continue;
         }
-        if (excludedBundleName != nullptr && strcmp(record->appName, excludedBundleName) == 0) {
-            reservedRecordList.PushFront(record);
-            continue;
+        AbilityEvictionInfo info = GetEvictionInfo(*record, now);
+        info.overBudget = overBudget;
+        int32_t score = (evictionPolicy_ != nullptr) ? evictionPolicy_->GetEvictionScore(info) :
+            GetDefaultEvictionScore(info);
+        if (score > victimScore) {
+            victim = record;
+            victimInfo = info;
+            victimScore = score;
         }
-        AbilityRecordObserverManager::GetInstance().NotifyAbilityRecordCleanup(record->appName);
-        delete record;
     }
-    while (reservedRecordList.Size() > 0) {
-        AbilityRecord *record = reservedRecordList.Front();
-        reservedRecordList.PopFront();
-        if (record == nullptr) {
-            continue;
+    if (victim == nullptr) {
+        HILOG_WARN(HILOG_MODULE_AAFWK, "no ability can be evicted, footprint %{public}u reserve %{public}u",
+            GetFootprint(), reserve);
+        return false;
+    }
+    Unlink(victim);
+    EvictRecord(victim, victimInfo);
+    return true;
+}
+
+void AbilityList::EvictRecord(AbilityRecord *record, const AbilityEvictionInfo &info)
+{
+    HILOG_INFO(HILOG_MODULE_AAFWK, "evict ability [%{public}u], footprint %{public}u, idle %{public}u ms",
+        record->token, info.footprint, info.idleTime);
+    AbilityRecordObserverManager::GetInstance().NotifyAbilityRecordEvicted(info);
+    // an evicted ability was not terminated, keep its spilled saved data for the next start of the bundle
+    if (record->abilitySavedData != nullptr) {
+        record->abilitySavedData->Persist();
+    }
+    delete record;
+}
+
+AbilityEvictionInfo AbilityList::GetEvictionInfo(const AbilityRecord &abilityRecord, uint32_t now)
+{
+    AbilityEvictionInfo info;
+    info.bundleName = abilityRecord.appName;
+    info.footprint = abilityRecord.GetFootprint();
+    uint32_t tickFreq = osKernelGetTickFreq();
+    uint64_t idleTicks = now - abilityRecord.lastForegroundTick;
+    info.idleTime = (tickFreq == 0) ? 0 : static_cast<uint32_t>(idleTicks * MS_PER_SECOND / tickFreq);
+    info.isTemporary = abilityRecord.isTemporary;
+    return info;
+}
+
+int32_t AbilityList::GetDefaultEvictionScore(const AbilityEvictionInfo &info)
+{
+    // a second of idle time weighs as much as FOOTPRINT_SCORE_UNIT resident bytes, temporary bundles go early
+    uint32_t idleScore = info.idleTime / MS_PER_SECOND;
+    if (idleScore > MAX_IDLE_SCORE) {
+        idleScore = MAX_IDLE_SCORE;
+    }
+    int32_t score = static_cast<int32_t>(idleScore + info.footprint / FOOTPRINT_SCORE_UNIT);
+    if (info.isTemporary) {
+        score += TEMPORARY_BUNDLE_SCORE;
+    }
+    return score;
+}
+
+int32_t AbilityList::PopAllAbility(const char *excludedBundleName)
+{
+    AbilityLockGuard locker(abilityListMutex_);
+    AbilityRecord *topRecord = head_;
+    if (topRecord == nullptr) {
+        return PARAM_NULL_ERROR;
+    }
+
+    AbilityRecord *record = topRecord->next;
+    while (record != nullptr) {
+        AbilityRecord *next = record->next;
+        bool reserved = AbilityList::IsPermanentAbility(*record) ||
+            (excludedBundleName != nullptr && record->appName != nullptr &&
+            strcmp(record->appName, excludedBundleName) == 0);
+        if (!reserved) {
+            Unlink(record);
+            AbilityRecordObserverManager::GetInstance().NotifyAbilityRecordCleanup(record->appName);
+            delete record;
         }
-        abilityList_.PushFront(record);
+        record = next;
     }
     return ERR_OK;
 }
@@ -16,6 +16,7 @@
 #include "ability_mgr_service_slite.h"
 
 #include "ability_errors.h"
+#include "ability_mem_pool.h"
 #include "ability_record_observer.h"
 #include "ability_record_observer_manager.h"
 #include "ability_service_interface.h"
@@ -47,6 +48,7 @@ AbilityMgrServiceSliteImpl g_amsSliteImpl = {
     .ForceStopBundle = AbilityMgrServiceSlite::ForceStopBundle,
     .GetTopAbility = AbilityMgrServiceSlite::GetTopAbility,
     .GetMissionInfos = AbilityMgrServiceSlite::GetMissionInfos,
+    .DumpOperationStat = AbilityMgrServiceSlite::DumpOperationStat,
     DEFAULT_IUNKNOWN_ENTRY_END
 };
 
@@ -160,9 +162,9 @@ BOOL AbilityMgrServiceSlite::ServiceMessageHandle(Service *service, Request *req
         }
         AbilityRecordManager::GetInstance().curTask_ = data->curTask;
         ret = AbilityRecordManager::GetInstance().StartAbility(data->want);
-        ClearWant(data->want);
-        AdapterFree(data->want);
-        AdapterFree(request->data);
+        AbilityMemPool::GetInstance().ClearWant(data->want);
+        AbilityMemPool::GetInstance().Free(data->want);
+        AbilityMemPool::GetInstance().Free(request->data);
         request->data = nullptr;
         request->len = 0;
     } else if (request->msgId == TERMINATE_ABILITY) {
@@ -177,14 +179,14 @@ BOOL AbilityMgrServiceSlite::ServiceMessageHandle(Service *service, Request *req
             return FALSE;
         }
         ret = AbilityRecordManager::GetInstance().ForceStop(data);
-        ClearWant(data);
-        AdapterFree(request->data);
+        AbilityMemPool::GetInstance().ClearWant(data);
+        AbilityMemPool::GetInstance().Free(request->data);
         request->data = nullptr;
         request->len = 0;
     } else if (request->msgId == TERMINATE_ALL) {
         char *excludedBundleName = reinterpret_cast<char *>(request->data);
         ret = AbilityRecordManager::GetInstance().TerminateAll(excludedBundleName);
-        AdapterFree(request->data);
+        AbilityMemPool::GetInstance().Free(request->data);
         request->data = nullptr;
         request->len = 0;
     } else if (request->msgId == ABILITY_TRANSACTION_DONE) {
@@ -197,6 +199,12 @@ BOOL AbilityMgrServiceSlite::ServiceMessageHandle(Service *service, Request *req
     } else if (request->msgId == REMOVE_ABILITY_RECORD_OBSERVER) {
         AbilityRecordObserver *observer = reinterpret_cast<AbilityRecordObserver *>(request->msgValue);
         return AbilityRecordManager::GetInstance().RemoveAbilityRecordObserver(observer) == ERR_OK;
+    } else if (request->msgId == SET_ABILITY_EVICTION_POLICY) {
+        AbilityEvictionPolicy *policy = reinterpret_cast<AbilityEvictionPolicy *>(request->msgValue);
+        return AbilityRecordManager::GetInstance().SetAbilityEvictionPolicy(policy) == ERR_OK;
+    } else if (request->msgId == ABILITY_THREAD_DRAINED) {
+        AbilityRecordManager::GetInstance().FlushPendingMsgs();
+        return TRUE;
     }
     if ((ret != ERR_OK) || (!AbilityRecordManager::GetInstance().GetIsAppScheduling())) {
         AbilityRecordManager::GetInstance().SetIsAppScheduling(false);
@@ -246,6 +254,11 @@ void *AbilityMgrServiceSlite::GetMissionInfos(uint32_t maxNum)
     return static_cast<void *>(AbilityRecordManager::GetInstance().GetMissionInfos(maxNum));
 }
 
+uint32_t AbilityMgrServiceSlite::DumpOperationStat(char *buffer, uint32_t size)
+{
+    return AbilityRecordManager::GetInstance().DumpOperationStat(buffer, size);
+}
+
 static AbilityThread *CreateJsAbilityThread()
 {
     auto *jsThread = new JsAbilityThread();
@@ -15,11 +15,21 @@
 
 #include "ability_record.h"
 
+#include <cstring>
+
+#include "ability_mem_pool.h"
+#include "ability_record_index.h"
 #include "adapter.h"
 #include "utils.h"
 
 namespace OHOS {
 namespace AbilitySlite {
+#ifdef TASK_STACK_SIZE
+constexpr uint32_t APP_TASK_FOOTPRINT = TASK_STACK_SIZE;
+#else
+constexpr uint32_t APP_TASK_FOOTPRINT = 0;
+#endif
+
 AbilityData::AbilityData() = default;
 
 AbilityData::~AbilityData()
@@ -31,6 +41,7 @@ AbilityRecord::AbilityRecord() = default;
 
 AbilityRecord::~AbilityRecord()
 {
+    ClearPendingMsgs();
     AdapterFree(appName);
     AdapterFree(appPath);
     delete abilityData;
@@ -45,6 +56,7 @@ void AbilityRecord::SetAppName(const char *name)
 {
     AdapterFree(appName);
     appName = Utils::Strdup(name);
+    appNameHash = AbilityRecordIndex::HashBundleName(appName);
 }
 
 void AbilityRecord::SetAppPath(const char *path)
@@ -66,5 +78,40 @@ void AbilityRecord::SetWantData(const void *wantData, uint16_t wantDataSize)
     }
     abilityData->wantDataSize = wantDataSize;
 }
+
+uint32_t AbilityRecord::GetFootprint() const
+{
+    uint32_t footprint = sizeof(AbilityRecord);
+    if (appName != nullptr) {
+        footprint += strlen(appName) + 1;
+    }
+    if (appPath != nullptr) {
+        footprint += strlen(appPath) + 1;
+    }
+    if (abilityData != nullptr) {
+        footprint += sizeof(AbilityData) + abilityData->wantDataSize;
+    }
+    if (abilitySavedData != nullptr) {
+        footprint += sizeof(AbilitySavedData) + abilitySavedData->GetResidentSize();
+    }
+    // native abilities share one long-lived task, only a js app task is owned by its record
+    if (abilityThread != nullptr && !isNativeApp) {
+        footprint += APP_TASK_FOOTPRINT;
+    }
+    return footprint;
+}
+
+void AbilityRecord::ClearPendingMsgs()
+{
+    AbilityMemPool &pool = AbilityMemPool::GetInstance();
+    while (pendingMsgs.Size() > 0) {
+        SliteAbilityInnerMsg *innerMsg = pendingMsgs.Front();
+        pendingMsgs.PopFront();
+        pool.ClearWant(innerMsg->want);
+        pool.Free(innerMsg->want);
+        pool.Free(innerMsg);
+    }
+    isForegroundSuperseded = false;
+}
 } // namespace AbilitySlite
 } // namespace OHOS
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_record_index.h"
+
+#include <new>
+
+#include "abilityms_log.h"
+
+namespace OHOS {
+namespace AbilitySlite {
+namespace {
+constexpr uint32_t MIN_INDEX_SLOTS = 8;
+constexpr uint32_t FNV_OFFSET_BASIS = 2166136261u;
+constexpr uint32_t FNV_PRIME = 16777619u;
+constexpr uint32_t GOLDEN_RATIO = 0x9E3779B1u;
+constexpr uint32_t MIX_SHIFT = 16;
+}
+
+AbilityRecordIndex::AbilityRecordIndex(uint32_t capacity, HashFunc hashFunc) : hashFunc_(hashFunc)
+{
+    // keep the load factor at or below one half so probe sequences stay short
+    uint32_t slotNum = MIN_INDEX_SLOTS;
+    while (slotNum < (capacity << 1)) {
+        slotNum <<= 1;
+    }
+    slots_ = new (std::nothrow) AbilityRecord *[slotNum];
+    if (slots_ == nullptr) {
+        HILOG_ERROR(HILOG_MODULE_AAFWK, "Failed to new ability record index.");
+        return;
+    }
+    mask_ = slotNum - 1;
+    Clear();
+}
+
+AbilityRecordIndex::~AbilityRecordIndex()
+{
+    delete[] slots_;
+    slots_ = nullptr;
+}
+
+uint32_t AbilityRecordIndex::HashToken(uint16_t token)
+{
+    uint32_t hash = static_cast<uint32_t>(token) * GOLDEN_RATIO;
+    return hash ^ (hash >> MIX_SHIFT);
+}
+
+uint32_t AbilityRecordIndex::HashBundleName(const char *bundleName)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+    if (bundleName == nullptr) {
+        return hash;
+    }
+    for (const char *p = bundleName; *p != '\0'; ++p) {
+        hash ^= static_cast<uint8_t>(*p);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+uint32_t AbilityRecordIndex::HomeSlot(const AbilityRecord &record) const
+{
+    return hashFunc_(record) & mask_;
+}
+
+bool AbilityRecordIndex::Insert(AbilityRecord *record)
+{
+    if (slots_ == nullptr || record == nullptr || count_ >= mask_) {
+        return false;
+    }
+    uint32_t slot = HomeSlot(*record);
+    while (slots_[slot] != nullptr) {
+        if (slots_[slot] == record) {
+            return true;
+        }
+        slot = (slot + 1) & mask_;
+    }
+    slots_[slot] = record;
+    count_++;
+    return true;
+}
+
+void AbilityRecordIndex::Remove(const AbilityRecord *record)
+{
+    if (slots_ == nullptr || record == nullptr) {
+        return;
+    }
+    uint32_t hole = HomeSlot(*record);
+    while (slots_[hole] != record) {
+        if (slots_[hole] == nullptr) {
+            return;
+        }
+        hole = (hole + 1) & mask_;
+    }
+
+    // backward-shift deletion, so lookups never need tombstones
+    uint32_t next = hole;
+    while (true) {
+        next = (next + 1) & mask_;
+        AbilityRecord *candidate = slots_[next];
+        if (candidate == nullptr) {
+            break;
+        }
+        uint32_t home = HomeSlot(*candidate);
+        // the candidate may fill the hole only if its home slot is not cyclically inside (hole, next]
+        bool homeInRange = (hole <= next) ? (home > hole && home <= next) : (home > hole || home <= next);
+        if (!homeInRange) {
+            slots_[hole] = candidate;
+            hole = next;
+        }
+    }
+    slots_[hole] = nullptr;
+    count_--;
+}
+
+AbilityRecord *AbilityRecordIndex::Find(uint32_t hash, MatchFunc matchFunc, const void *key) const
+{
+    if (slots_ == nullptr || matchFunc == nullptr) {
+        return nullptr;
+    }
+    uint32_t slot = hash & mask_;
+    while (slots_[slot] != nullptr) {
+        if (matchFunc(*slots_[slot], key)) {
+            return slots_[slot];
+        }
+        slot = (slot + 1) & mask_;
+    }
+    return nullptr;
+}
+
+AbilityRecord *AbilityRecordIndex::Find(uint32_t hash, MatchFunc matchFunc, const void *key,
+    PreferFunc preferFunc) const
+{
+    if (slots_ == nullptr || matchFunc == nullptr || preferFunc == nullptr) {
+        return nullptr;
+    }
+    AbilityRecord *found = nullptr;
+    uint32_t slot = hash & mask_;
+    while (slots_[slot] != nullptr) {
+        if (matchFunc(*slots_[slot], key) && (found == nullptr || preferFunc(*slots_[slot], *found))) {
+            found = slots_[slot];
+        }
+        slot = (slot + 1) & mask_;
+    }
+    return found;
+}
+
+void AbilityRecordIndex::Clear()
+{
+    if (slots_ == nullptr) {
+        return;
+    }
+    for (uint32_t i = 0; i <= mask_; ++i) {
+        slots_[i] = nullptr;
+    }
+    count_ = 0;
+}
+} // namespace AbilitySlite
+} // namespace OHOS
@@ -19,8 +19,10 @@
 #include "ability_errors.h"
 #include "ability_inner_message.h"
 #include "ability_lock_guard.h"
+#include "ability_mem_pool.h"
 #include "ability_record.h"
 #include "ability_record_observer_manager.h"
+#include "ability_trace.h"
 #include "ability_service_interface.h"
 #include "ability_thread_loader.h"
 #include "abilityms_log.h"
@@ -71,7 +73,7 @@ void AbilityRecordManager::StartLauncher()
     abilityList_.Add(record);
     (void)ScheduleLifecycleInner(record, SLITE_STATE_FOREGROUND);
 #else // define _MINI_MULTI_TASKS_
-    Want *want = static_cast<Want *>(AdapterMalloc(sizeof(Want)));
+    Want *want = static_cast<Want *>(AbilityMemPool::GetInstance().Alloc(sizeof(Want)));
     if (want == nullptr) {
         return;
     }
@@ -87,7 +89,7 @@ void AbilityRecordManager::StartLauncher()
     ClearElement(&elementName);
     StartAbility(want);
     ClearWant(want);
-    AdapterFree(want);
+    AbilityMemPool::GetInstance().Free(want);
 #endif
 }
 
@@ -96,7 +98,7 @@ int32_t AbilityRecordManager::StartAbility(const AbilityRecord *record)
     if (record == nullptr) {
         return PARAM_NULL_ERROR;
     }
-    Want *want = static_cast<Want *>(AdapterMalloc(sizeof(Want)));
+    Want *want = static_cast<Want *>(AbilityMemPool::GetInstance().Alloc(sizeof(Want)));
     if (want == nullptr) {
         return PARAM_NULL_ERROR;
     }
@@ -121,7 +123,7 @@ int32_t AbilityRecordManager::StartAbility(const AbilityRecord *record)
     if (ret != ERR_OK) {
         HILOG_ERROR(HILOG_MODULE_AAFWK, "start ability failed [%{public}d]", ret);
     }
-    AdapterFree(want);
+    AbilityMemPool::GetInstance().Free(want);
     return ret;
 }
 
@@ -163,12 +165,12 @@ int32_t AbilityRecordManager::StartRemoteAbility(const Want *want)
 
     CallerInfo callerInfo = {
         .uid = 0,
-        .bundleName = OHOS::Utils::Strdup(callerBundleName)
+        .bundleName = AbilityMemPool::GetInstance().Strdup(callerBundleName)
     };
     retVal = dmsInterface->StartRemoteAbility(want, &callerInfo, nullptr);
 
     HILOG_INFO(HILOG_MODULE_AAFWK, "StartRemoteAbility retVal: [%{public}d]", retVal);
-    AdapterFree(callerInfo.bundleName);
+    AbilityMemPool::GetInstance().Free(callerInfo.bundleName);
     return retVal;
 #else
     return PARAM_NULL_ERROR;
@@ -177,6 +179,7 @@ int32_t AbilityRecordManager::StartRemoteAbility(const Want *want)
 
 int32_t AbilityRecordManager::StartAbility(const Want *want)
 {
+    ABILITY_TRACE_STAMP(startTraceTimeUs_);
     if (isAppScheduling_) {
         return AddAbilityOperation(START_ABILITY, want, 0);
     }
@@ -204,6 +207,7 @@ int32_t AbilityRecordManager::StartAbility(const Want *want)
 #ifdef _MINI_MULTI_TASKS_
     AbilityRecord *abilityRecord = abilityList_.Get(bundleName);
     if (abilityRecord != nullptr) {
+        ABILITY_TRACE_AT(START_ABILITY, abilityRecord->token, SLITE_STATE_UNINITIALIZED, startTraceTimeUs_);
         auto topRecord = abilityList_.GetTopAbility();
         if (topRecord == abilityRecord) {
             isAppScheduling_ = false;
@@ -226,7 +230,7 @@ int32_t AbilityRecordManager::StartAbility(const Want *want)
     }
 #endif
 
-    auto *info = static_cast<AbilitySvcInfo *>(AdapterMalloc(sizeof(AbilitySvcInfo)));
+    auto *info = static_cast<AbilitySvcInfo *>(AbilityMemPool::GetInstance().Alloc(sizeof(AbilitySvcInfo)));
     if (info == nullptr) {
         isAppScheduling_ = false;
         HILOG_ERROR(HILOG_MODULE_AAFWK, "Ability Service AbilitySvcInfo is null");
@@ -236,7 +240,7 @@ int32_t AbilityRecordManager::StartAbility(const Want *want)
     if (queryRet != ERR_OK) {
         isAppScheduling_ = false;
         HILOG_ERROR(HILOG_MODULE_AAFWK, "Ability BMS Helper return abilitySvcInfo failed");
-        AdapterFree(info);
+        AbilityMemPool::GetInstance().Free(info);
         return PARAM_CHECK_ERROR;
     }
 
@@ -246,7 +250,7 @@ int32_t AbilityRecordManager::StartAbility(const Want *want)
     auto ret = StartAbility(info);
     BMSHelper::GetInstance().ClearAbilitySvcInfo(info);
     AdapterFree(info->data);
-    AdapterFree(info);
+    AbilityMemPool::GetInstance().Free(info);
     return ret;
 }
 
@@ -572,6 +576,7 @@ int32_t AbilityRecordManager::ForceStopBundleInner(uint16_t token)
 
 int32_t AbilityRecordManager::PreCheckStartAbility(const AbilitySvcInfo &info)
 {
+    ABILITY_TRACE_STAMP(preCheckTraceTimeUs_);
 #ifndef _MINI_MULTI_TASKS_
     if (info.path == nullptr) {
         HILOG_ERROR(HILOG_MODULE_AAFWK, "PreCheckStartAbility path is null.");
@@ -584,6 +589,7 @@ int32_t AbilityRecordManager::PreCheckStartAbility(const AbilitySvcInfo &info)
         } else if (curRecord->state == SCHEDULE_BACKGROUND) {
             SchedulerLifecycle(LAUNCHER_TOKEN, SLITE_STATE_BACKGROUND);
         }
+        TraceStartAbility(curRecord->token);
         return ERR_OK;
     }
     auto record = new AbilityRecord();
@@ -591,6 +597,7 @@ int32_t AbilityRecordManager::PreCheckStartAbility(const AbilitySvcInfo &info)
     record->SetAppPath(info.path);
     record->SetWantData(info.data, info.dataLength);
     record->isNativeApp = BMSHelper::GetInstance().IsNativeApp(info.bundleName);
+    record->isTemporary = NeedToBeTerminated(info.bundleName);
     record->state = SCHEDULE_STOP;
     if (pendingToken_ != 0) {
         record->token = pendingToken_;
@@ -599,6 +606,7 @@ int32_t AbilityRecordManager::PreCheckStartAbility(const AbilitySvcInfo &info)
         record->token = GenerateToken();
         abilityList_.Add(record);
     }
+    TraceStartAbility(record->token);
     if (pendingToken_ == 0 && CreateAppTask(record) != ERR_OK) {
         HILOG_ERROR(HILOG_MODULE_AAFWK, "CheckResponse CreateAppTask fail");
         abilityList_.Erase(record->token);
@@ -619,6 +627,7 @@ int32_t AbilityRecordManager::PreCheckStartAbility(const AbilitySvcInfo &info)
             // update ability stack and move the ability to the top of ability stack
             abilityList_.MoveToTop(curRecord->token);
             pendingToken_ = curRecord->token;
+            TraceStartAbility(curRecord->token);
             return ERR_OK;
         }
     } else {
@@ -628,11 +637,13 @@ int32_t AbilityRecordManager::PreCheckStartAbility(const AbilitySvcInfo &info)
         } else {
             record->token = GenerateToken();
         }
+        TraceStartAbility(record->token);
         record->SetAppName(info.bundleName);
         record->SetAppPath(info.path);
         record->SetWantData(info.data, info.dataLength);
         record->state = SCHEDULE_STOP;
         record->isNativeApp = info.isNativeApp;
+        record->isTemporary = NeedToBeTerminated(info.bundleName);
         record->mission = info.mission;
         if (record->mission == UINT32_MAX) {
             record->mission = GenerateMission();
@@ -650,6 +661,13 @@ int32_t AbilityRecordManager::PreCheckStartAbility(const AbilitySvcInfo &info)
     return ERR_OK;
 }
 
+void AbilityRecordManager::TraceStartAbility(uint64_t token) const
+{
+    (void) token;
+    ABILITY_TRACE_AT(START_ABILITY, token, SLITE_STATE_UNINITIALIZED, startTraceTimeUs_);
+    ABILITY_TRACE_AT(PRE_CHECK_START, token, SLITE_STATE_UNINITIALIZED, preCheckTraceTimeUs_);
+}
+
 bool AbilityRecordManager::CheckResponse(const char *bundleName)
 {
     StartCheckFunc callBackFunc = GetAbilityCallback();
@@ -671,6 +689,7 @@ int32_t AbilityRecordManager::CreateAppTask(AbilityRecord *record)
         HILOG_ERROR(HILOG_MODULE_AAFWK, "CreateAppTask fail: null");
         return PARAM_NULL_ERROR;
     }
+    ABILITY_TRACE(CREATE_APP_TASK, record->token, record->state);
 
     if (record->isNativeApp) {
         record->abilityThread =
@@ -707,6 +726,17 @@ int32_t AbilityRecordManager::CreateAppTask(AbilityRecord *record)
     }
 #else
     APP_EVENT(MT_ACE_APP_START);
+#ifdef ABILITY_SAVED_DATA_DIR
+    if (record->abilitySavedData == nullptr) {
+        // pick up what an evicted record of the same bundle spilled
+        auto savedData = new AbilitySavedData();
+        if (savedData->Attach(record->appName) == SavedResultCode::SAVED_RESULT_OK) {
+            record->abilitySavedData = savedData;
+        } else {
+            delete savedData;
+        }
+    }
+#endif
     SchedulerLifecycle(record->token, SLITE_STATE_INITIAL);
 #endif
     return ERR_OK;
@@ -756,6 +786,11 @@ void AbilityRecordManager::DeleteAbilityThread(AbilityRecord *record)
         delete record->abilityThread;
         record->abilityThread = nullptr;
     }
+    // messages that never reached the app task die with it
+    record->ClearPendingMsgs();
+    // the task and queue may be parked and handed to another record
+    record->taskId = 0;
+    record->jsAppQueueId = nullptr;
     // free all JS native memory after exiting it
     // CleanTaskMem(taskId)
 }
@@ -910,6 +945,11 @@ void AbilityRecordManager::OnDestroyDone(uint16_t token)
     } else {
         // 2. ability is transferred to SCHEDULE_STOP state and still keep in the ability stack
         DeleteAbilityThread(onDestroyRecord);
+        if (onDestroyRecord->abilitySavedData != nullptr) {
+            (void) onDestroyRecord->abilitySavedData->Spill(onDestroyRecord->appName);
+        }
+        // the saved data just taken may have pushed the stack over the memory budget
+        abilityList_.TrimToBudget();
     }
 
     // start pending token
@@ -963,6 +1003,9 @@ void AbilityRecordManager::SetAbilityStateAndNotify(uint64_t token, int32_t stat
         return;
     }
     record->state = state;
+    if (state == SCHEDULE_FOREGROUND || state == SCHEDULE_BACKGROUND) {
+        record->lastForegroundTick = osKernelGetTickCount();
+    }
     AbilityRecordObserverManager::GetInstance().NotifyAbilityRecordStateChanged(
         AbilityRecordStateData(record->appName, static_cast<AbilityRecordState>(state)));
 }
@@ -983,7 +1026,7 @@ int32_t AbilityRecordManager::ScheduleLifecycleInner(const AbilityRecord *record
         return PARAM_NULL_ERROR;
     }
     // malloc want memory and release after use
-    Want *info = static_cast<Want *>(AdapterMalloc(sizeof(Want)));
+    Want *info = static_cast<Want *>(AbilityMemPool::GetInstance().Alloc(sizeof(Want)));
     if (info == nullptr) {
         return MEMORY_MALLOC_ERROR;
     }
@@ -1005,7 +1048,7 @@ int32_t AbilityRecordManager::ScheduleLifecycleInner(const AbilityRecord *record
     }
     SchedulerAbilityLifecycle(nativeAbility_, *info, state);
     ClearWant(info);
-    AdapterFree(info);
+    AbilityMemPool::GetInstance().Free(info);
     return ERR_OK;
 }
 #endif
@@ -1033,6 +1076,16 @@ void AbilityRecordManager::SchedulerAbilityLifecycle(SliteAbility *ability, cons
 
 int32_t AbilityRecordManager::SchedulerLifecycleDone(uint64_t token, int32_t state)
 {
+    ABILITY_TRACE(LIFECYCLE_DONE, token, state);
+    // the app task has just taken a message, so its queue has room for those that found it full
+    FlushPendingMsgs();
+    AbilityRecord *record = abilityList_.Get(token);
+    // the dropped foreground never ran, observers and the trace only see this background
+    bool foregroundSuperseded = state == SLITE_STATE_BACKGROUND && record != nullptr &&
+        record->isForegroundSuperseded;
+    if (foregroundSuperseded) {
+        record->isForegroundSuperseded = false;
+    }
     switch (state) {
         case SLITE_STATE_INITIAL: {
             OnCreateDone(token);
@@ -1056,6 +1109,11 @@ int32_t AbilityRecordManager::SchedulerLifecycleDone(uint64_t token, int32_t sta
             break;
         }
     }
+    if (foregroundSuperseded) {
+        // the scheduling the foreground started ends with it
+        isAppScheduling_ = false;
+        RunOperation();
+    }
     return ERR_OK;
 }
 
@@ -1092,26 +1150,122 @@ int32_t AbilityRecordManager::SendMsgToAbilityThread(int32_t state, const Abilit
             break;
     }
     innerMsg.abilityThread = record->abilityThread;
-    return record->abilityThread->SendScheduleMsgToAbilityThread(innerMsg);
+    innerMsg.token = record->token;
+    ABILITY_TRACE(SEND_TO_ABILITY_THREAD, record->token, state);
+    return PostMsgToAbilityThread(*const_cast<AbilityRecord *>(record), innerMsg);
+}
+
+int32_t AbilityRecordManager::PostMsgToAbilityThread(AbilityRecord &record, SliteAbilityInnerMsg &innerMsg)
+{
+    // nothing overtakes the messages already waiting, the app task sees the lifecycle in order
+    if (FlushPendingMsgs(record) && record.abilityThread->SendScheduleMsgToAbilityThread(innerMsg) == ERR_OK) {
+        return ERR_OK;
+    }
+    if (CoalescePendingMsg(record, innerMsg)) {
+        return ERR_OK;
+    }
+    AbilityMemPool &pool = AbilityMemPool::GetInstance();
+    auto pendingMsg = static_cast<SliteAbilityInnerMsg *>(pool.Alloc(sizeof(SliteAbilityInnerMsg)));
+    if (pendingMsg == nullptr ||
+        memcpy_s(pendingMsg, sizeof(SliteAbilityInnerMsg), &innerMsg, sizeof(SliteAbilityInnerMsg)) != EOK) {
+        pool.Free(pendingMsg);
+        HILOG_ERROR(HILOG_MODULE_AAFWK, "drop message %{public}d of [%{public}u]", innerMsg.msgId, record.token);
+        pool.ClearWant(innerMsg.want);
+        pool.Free(innerMsg.want);
+        return MEMORY_MALLOC_ERROR;
+    }
+    record.pendingMsgs.PushBack(pendingMsg);
+    overflowStat_.overflowCount++;
+    HILOG_WARN(HILOG_MODULE_AAFWK, "app task queue of [%{public}u] is full, %{public}u messages wait",
+        record.token, record.pendingMsgs.Size());
+    return ERR_OK;
+}
+
+bool AbilityRecordManager::FlushPendingMsgs(AbilityRecord &record)
+{
+    if (record.abilityThread == nullptr) {
+        record.ClearPendingMsgs();
+        return true;
+    }
+    while (record.pendingMsgs.Size() > 0) {
+        SliteAbilityInnerMsg *pendingMsg = record.pendingMsgs.Front();
+        if (record.abilityThread->SendScheduleMsgToAbilityThread(*pendingMsg) != ERR_OK) {
+            return false;
+        }
+        // the want now belongs to the app task
+        record.pendingMsgs.PopFront();
+        AbilityMemPool::GetInstance().Free(pendingMsg);
+    }
+    return true;
+}
+
+void AbilityRecordManager::FlushPendingMsgs()
+{
+    for (AbilityRecord *record = abilityList_.GetTopAbility(); record != nullptr; record = record->next) {
+        if (record->pendingMsgs.Size() > 0) {
+            (void) FlushPendingMsgs(*record);
+        }
+    }
+}
+
+bool AbilityRecordManager::CoalescePendingMsg(AbilityRecord &record, SliteAbilityInnerMsg &innerMsg)
+{
+    if (record.pendingMsgs.Size() == 0) {
+        return false;
+    }
+    SliteAbilityInnerMsg *last = record.pendingMsgs.Back();
+    bool isTransition = innerMsg.msgId == SliteAbilityMsgId::FOREGROUND ||
+        innerMsg.msgId == SliteAbilityMsgId::BACKGROUND || innerMsg.msgId == SliteAbilityMsgId::DESTROY;
+    if (isTransition && last->msgId == innerMsg.msgId) {
+        // a repeated transition, the app task only needs it once and with the newest want
+        AbilityMemPool &pool = AbilityMemPool::GetInstance();
+        pool.ClearWant(last->want);
+        pool.Free(last->want);
+        last->want = innerMsg.want;
+        overflowStat_.coalescedCount++;
+        return true;
+    }
+    // only while the foreground is the first message waiting, no earlier background can take its done
+    if (innerMsg.msgId == SliteAbilityMsgId::BACKGROUND && last->msgId == SliteAbilityMsgId::FOREGROUND &&
+        record.pendingMsgs.Size() == 1 && record.state == SCHEDULE_BACKGROUND) {
+        // the ability would come to the foreground only to be sent back, let it stay in the background
+        record.pendingMsgs.PopBack();
+        FreePendingMsg(last);
+        record.isForegroundSuperseded = true;
+        overflowStat_.coalescedCount++;
+    }
+    return false;
+}
+
+void AbilityRecordManager::FreePendingMsg(SliteAbilityInnerMsg *innerMsg)
+{
+    AbilityMemPool &pool = AbilityMemPool::GetInstance();
+    pool.ClearWant(innerMsg->want);
+    pool.Free(innerMsg->want);
+    pool.Free(innerMsg);
 }
 
 Want *AbilityRecordManager::CreateWant(const AbilityRecord *record)
 {
-    Want *want = static_cast<Want *>(AdapterMalloc(sizeof(Want)));
+    // released by the ability thread once the lifecycle message is handled
+    AbilityMemPool &pool = AbilityMemPool::GetInstance();
+    Want *want = static_cast<Want *>(pool.Alloc(sizeof(Want)));
+    if (want == nullptr) {
+        return nullptr;
+    }
     want->element = nullptr;
     want->data = nullptr;
     want->dataLength = 0;
-    want->appPath = OHOS::Utils::Strdup(record->appPath);
+    want->appPath = pool.Strdup(record->appPath);
     want->mission = record->mission;
     want->actions = nullptr;
     want->entities = nullptr;
     ElementName elementName = {};
-    SetElementBundleName(&elementName, record->appName);
-    SetWantElement(want, elementName);
+    elementName.bundleName = record->appName;
+    want->element = pool.CopyElement(elementName);
     if (record->abilityData != nullptr) {
         SetWantData(want, record->abilityData->wantData, record->abilityData->wantDataSize);
     }
-    ClearElement(&elementName);
     return want;
 }
 
@@ -1161,33 +1315,47 @@ int32_t AbilityRecordManager::RemoveAbilityRecordObserver(AbilityRecordObserver
     return ERR_OK;
 }
 
+int32_t AbilityRecordManager::SetAbilityEvictionPolicy(AbilityEvictionPolicy *policy)
+{
+    abilityList_.SetEvictionPolicy(policy);
+    return ERR_OK;
+}
+
 Want *AbilityRecordManager::CopyWant(const Want *want)
 {
     if (want == nullptr) {
         HILOG_ERROR(HILOG_MODULE_AAFWK, "want is nullptr");
         return nullptr;
     }
-    Want *copiedWant = static_cast<Want *>(AdapterMalloc(sizeof(Want)));
+    AbilityMemPool &pool = AbilityMemPool::GetInstance();
+    Want *copiedWant = static_cast<Want *>(pool.Alloc(sizeof(Want)));
+    if (copiedWant == nullptr) {
+        return nullptr;
+    }
     copiedWant->element = nullptr;
     copiedWant->data = OHOS::Utils::Memdup(want->data, want->dataLength);
     copiedWant->dataLength = want->dataLength;
-    copiedWant->appPath = OHOS::Utils::Strdup(want->appPath);
+    copiedWant->appPath = pool.Strdup(want->appPath);
+    copiedWant->mission = want->mission;
     copiedWant->actions = nullptr;
     copiedWant->entities = nullptr;
     if (want->element != nullptr) {
         ElementName elementName = {};
-        SetElementBundleName(&elementName, want->element->bundleName);
-        SetWantElement(copiedWant, elementName);
-        ClearElement(&elementName);
+        elementName.bundleName = want->element->bundleName;
+        copiedWant->element = pool.CopyElement(elementName);
     }
     return copiedWant;
 }
 
 int32_t AbilityRecordManager::AddAbilityOperation(uint16_t msgId, const Want *want, uint64_t token)
 {
-    AbilityOperation *operation = static_cast<AbilityOperation *>(AdapterMalloc(sizeof(AbilityOperation)));
+    if (CoalesceAbilityOperation(msgId, want, token)) {
+        return ERR_OK;
+    }
+    AbilityMemPool &pool = AbilityMemPool::GetInstance();
+    auto operation = static_cast<AbilityOperation *>(pool.Alloc(sizeof(AbilityOperation)));
     if (operation == nullptr || memset_s(operation, sizeof(AbilityOperation), 0, sizeof(AbilityOperation)) != EOK) {
-        AdapterFree(operation);
+        pool.Free(operation);
         HILOG_ERROR(HILOG_MODULE_AAFWK, "AddAbilityOperation failed");
         return PARAM_NULL_ERROR;
     }
@@ -1195,9 +1363,110 @@ int32_t AbilityRecordManager::AddAbilityOperation(uint16_t msgId, const Want *wa
     operation->want = CopyWant(want);
     operation->token = token;
     abilityOperation_.PushBack(operation);
+    operationStat_.queuedCount++;
+    if (abilityOperation_.Size() > operationStat_.peakQueueDepth) {
+        operationStat_.peakQueueDepth = abilityOperation_.Size();
+    }
     return ERR_OK;
 }
 
+bool AbilityRecordManager::CoalesceAbilityOperation(uint16_t msgId, const Want *want, uint64_t token)
+{
+    if (msgId == TERMINATE_ALL) {
+        DropQueuedStarts((want == nullptr) ? nullptr : static_cast<const char *>(want->data));
+        return false;
+    }
+    if (abilityOperation_.Size() == 0 || abilityOperation_.Back()->msgId != START_ABILITY) {
+        return false;
+    }
+    AbilityOperation *last = abilityOperation_.Back();
+    if (msgId == START_ABILITY) {
+        // only the last of consecutive starts decides the foreground ability
+        abilityOperation_.PopBack();
+        FreeAbilityOperation(last);
+        operationStat_.coalescedCount++;
+        return false;
+    }
+    const char *bundleName = GetTerminateBundleName(msgId, want, token);
+    if (bundleName == nullptr || last->want == nullptr || last->want->element == nullptr ||
+        last->want->element->bundleName == nullptr || strcmp(last->want->element->bundleName, bundleName) != 0) {
+        return false;
+    }
+    // the start would be undone by this terminate
+    HILOG_INFO(HILOG_MODULE_AAFWK, "cancel queued start of [%{public}s]", bundleName);
+    abilityOperation_.PopBack();
+    FreeAbilityOperation(last);
+    operationStat_.coalescedCount++;
+    // nothing left to terminate, the terminate is dropped along with the start it cancelled
+    return !IsBundleRunningOrQueued(bundleName);
+}
+
+void AbilityRecordManager::DropQueuedStarts(const char *excludedBundleName)
+{
+    auto node = abilityOperation_.Begin();
+    while (node != abilityOperation_.End()) {
+        auto next = node->next_;
+        AbilityOperation *operation = node->value_;
+        bool drop = false;
+        if (operation->msgId == START_ABILITY) {
+            // the excluded bundle survives terminate all, so starting it still matters
+            const char *bundleName = (operation->want == nullptr || operation->want->element == nullptr) ?
+                nullptr : operation->want->element->bundleName;
+            drop = excludedBundleName == nullptr || bundleName == nullptr ||
+                strcmp(bundleName, excludedBundleName) != 0;
+        } else if (operation->msgId == TERMINATE_ALL) {
+            const char *queuedExcluded = static_cast<const char *>(operation->want->data);
+            drop = (queuedExcluded == nullptr && excludedBundleName == nullptr) ||
+                (queuedExcluded != nullptr && excludedBundleName != nullptr &&
+                strcmp(queuedExcluded, excludedBundleName) == 0);
+        }
+        if (drop) {
+            abilityOperation_.Remove(node);
+            FreeAbilityOperation(operation);
+            operationStat_.coalescedCount++;
+        }
+        node = next;
+    }
+}
+
+const char *AbilityRecordManager::GetTerminateBundleName(uint16_t msgId, const Want *want, uint64_t token)
+{
+    switch (msgId) {
+        case TERMINATE_ABILITY:
+        case TERMINATE_APP: {
+            AbilityRecord *record = abilityList_.Get(static_cast<uint16_t>(token));
+            return (record == nullptr) ? nullptr : record->appName;
+        }
+        case TERMINATE_APP_BY_BUNDLENAME: {
+            return (want == nullptr || want->element == nullptr) ? nullptr : want->element->bundleName;
+        }
+        default: {
+            return nullptr;
+        }
+    }
+}
+
+bool AbilityRecordManager::IsBundleRunningOrQueued(const char *bundleName)
+{
+    if (abilityList_.Get(bundleName) != nullptr) {
+        return true;
+    }
+#ifndef _MINI_MULTI_TASKS_
+    if (pendingRecord != nullptr && pendingRecord->appName != nullptr &&
+        strcmp(pendingRecord->appName, bundleName) == 0) {
+        return true;
+    }
+#endif
+    for (auto node = abilityOperation_.Begin(); node != abilityOperation_.End(); node = node->next_) {
+        const Want *want = node->value_->want;
+        if (node->value_->msgId == START_ABILITY && want != nullptr && want->element != nullptr &&
+            want->element->bundleName != nullptr && strcmp(want->element->bundleName, bundleName) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
 int32_t AbilityRecordManager::RunOperation()
 {
     if (abilityOperation_.Size() == 0) {
@@ -1205,59 +1474,89 @@ int32_t AbilityRecordManager::RunOperation()
         return ERR_OK;
     }
 
-    if (isAppScheduling_) {
-        return ERR_OK;
+    int32_t ret = ERR_OK;
+    // an operation that completes synchronously leaves isAppScheduling_ unset, go on with the next one
+    while (!isAppScheduling_ && abilityOperation_.Size() > 0) {
+        AbilityOperation *operation = abilityOperation_.Front();
+        abilityOperation_.PopFront();
+        if (operation == nullptr) {
+            continue;
+        }
+        ret = RunAbilityOperation(*operation);
+        FreeAbilityOperation(operation);
+        if (ret != ERR_OK) {
+            HILOG_ERROR(HILOG_MODULE_AAFWK, "RunOperation failed due to error : [%{public}d]", ret);
+            isAppScheduling_ = false;
+        }
     }
+    return ret;
+}
 
-    AbilityOperation *operation = abilityOperation_.Front();
-    abilityOperation_.PopFront();
-    if (operation == nullptr) {
-        return PARAM_NULL_ERROR;
-    }
-    int32_t ret = ERR_OK;
-    switch (operation->msgId) {
+int32_t AbilityRecordManager::RunAbilityOperation(const AbilityOperation &operation)
+{
+    switch (operation.msgId) {
         case START_ABILITY: {
-            ret = StartAbility(operation->want);
-            break;
+            return StartAbility(operation.want);
         }
         case TERMINATE_ABILITY: {
-            ret = TerminateAbility(static_cast<uint16_t>(operation->token));
-            break;
+            return TerminateAbility(static_cast<uint16_t>(operation.token));
         }
         case TERMINATE_APP: {
-            ret = ForceStopBundle(static_cast<uint16_t>(operation->token));
-            break;
+            return ForceStopBundle(static_cast<uint16_t>(operation.token));
         }
         case TERMINATE_MISSION: {
-            ret = TerminateMission(static_cast<uint32_t>(operation->token));
-            break;
+            return TerminateMission(static_cast<uint32_t>(operation.token));
         }
         case TERMINATE_APP_BY_BUNDLENAME: {
-            ret = ForceStop(operation->want);
-            break;
+            return ForceStop(operation.want);
         }
         case TERMINATE_ALL: {
-            ret = TerminateAll(reinterpret_cast<char *>(operation->want->data));
-            break;
+            return TerminateAll(reinterpret_cast<char *>(operation.want->data));
         }
         default: {
-            break;
+            return ERR_OK;
         }
     }
-    ClearWant(operation->want);
-    AdapterFree(operation->want);
-    AdapterFree(operation);
-    if (ret != ERR_OK) {
-        HILOG_ERROR(HILOG_MODULE_AAFWK, "RunOperation failed due to error : [%{public}d]", ret);
-        isAppScheduling_ = false;
-        return RunOperation();
-    }
+}
 
-    if (!isAppScheduling_) {
-        return RunOperation();
-    }
+void AbilityRecordManager::FreeAbilityOperation(AbilityOperation *operation)
+{
+    AbilityMemPool &pool = AbilityMemPool::GetInstance();
+    pool.ClearWant(operation->want);
+    pool.Free(operation->want);
+    pool.Free(operation);
+}
 
-    return ret;
+void AbilityRecordManager::GetOperationStat(AbilityOperationStat &stat) const
+{
+    stat = operationStat_;
+    stat.queueDepth = abilityOperation_.Size();
+}
+
+uint32_t AbilityRecordManager::DumpOperationStat(char *buffer, uint32_t size) const
+{
+    if (buffer == nullptr || size == 0) {
+        return 0;
+    }
+    AbilityOperationStat stat;
+    GetOperationStat(stat);
+    int32_t ret = snprintf_s(buffer, size, size - 1,
+        "ability operations: depth %u, peak %u, queued %u, coalesced %u\n", stat.queueDepth, stat.peakQueueDepth,
+        stat.queuedCount, stat.coalescedCount);
+    if (ret < 0) {
+        buffer[0] = '\0';
+        return 0;
+    }
+    return static_cast<uint32_t>(ret);
+}
+
+void AbilityRecordManager::GetMsgOverflowStat(AbilityMsgOverflowStat &stat) const
+{
+    stat = overflowStat_;
+    stat.pendingCount = 0;
+    for (AbilityRecord *record = abilityList_.GetTopAbility(); record != nullptr; record = record->next) {
+        stat.pendingCount += record->pendingMsgs.Size();
+    }
 }
 
 void AbilityRecordManager::SetIsAppScheduling(bool runState)
@@ -60,5 +60,14 @@ void AbilityRecordObserverManager::NotifyAbilityRecordCleanup(char *appName)
         }
     }
 }
+
+void AbilityRecordObserverManager::NotifyAbilityRecordEvicted(const AbilityEvictionInfo &info)
+{
+    for (auto it = observers_.Begin(); it != observers_.End(); it = it->next_) {
+        if (it->value_ != nullptr) {
+            it->value_->OnAbilityRecordEvicted(info);
+        }
+    }
+}
 } // namespace AbilitySlite
 } // namespace OHOS
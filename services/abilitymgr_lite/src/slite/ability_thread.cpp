@@ -18,7 +18,9 @@
 #include "abilityms_log.h"
 #include "ability_errors.h"
 #include "ability_inner_message.h"
+#include "abilityms_slite_client.h"
 #include "adapter.h"
+#include "slite_ability_state.h"
 
 namespace OHOS {
 namespace AbilitySlite {
@@ -27,6 +29,22 @@ AbilityThread::AbilityThread() = default;
 
 AbilityThread::~AbilityThread() = default;
 
+int32_t AbilityThread::GetTargetState(SliteAbilityMsgId msgId)
+{
+    switch (msgId) {
+        case SliteAbilityMsgId::CREATE:
+            return SLITE_STATE_INITIAL;
+        case SliteAbilityMsgId::FOREGROUND:
+            return SLITE_STATE_FOREGROUND;
+        case SliteAbilityMsgId::BACKGROUND:
+            return SLITE_STATE_BACKGROUND;
+        case SliteAbilityMsgId::DESTROY:
+            return SLITE_STATE_UNINITIALIZED;
+        default:
+            return SLITE_STATE_UNKNOWN;
+    }
+}
+
 int32_t AbilityThread::HandleCreate(const Want *want)
 {
     if (ability_ == nullptr) {
@@ -50,6 +68,8 @@ int32_t AbilityThread::HandleRestore(AbilitySavedData *data)
         return PARAM_NULL_ERROR;
     }
     if (data != nullptr) {
+        // data of a stopped ability is kept compressed or spilled until it is needed again
+        (void) data->Restore();
         ability_->OnRestoreData(data);
     }
     return ERR_OK;
@@ -103,21 +123,28 @@ int32_t AbilityThread::HandleDestroy()
 
 int32_t AbilityThread::SendScheduleMsgToAbilityThread(SliteAbilityInnerMsg &innerMsg)
 {
-    constexpr uint32_t maxRetryTimes = 5;
-
-    uint32_t retryTimes = 0;
-    while (retryTimes < maxRetryTimes) {
-        osStatus_t ret = osMessageQueuePut(GetMessageQueueId(), static_cast<void *>(&innerMsg), 0, 0);
-        if (ret == osOK) {
-            return ERR_OK;
-        }
-        HILOG_WARN(HILOG_MODULE_AAFWK, "AbilityThread osMessageQueuePut failed with %{public}d", ret);
-        osDelay(200); // sleep 200ms
-        retryTimes++;
+    osStatus_t ret = osMessageQueuePut(GetMessageQueueId(), static_cast<void *>(&innerMsg), 0, 0);
+    if (ret == osOK) {
+        return ERR_OK;
     }
-
-    HILOG_ERROR(HILOG_MODULE_AAFWK, "AbilityThread SendScheduleMsgToAbilityThread failed.");
+    // the app task may have taken a message since the put failed, so try once more with the flag raised
+    isBackpressured_ = true;
+    ret = osMessageQueuePut(GetMessageQueueId(), static_cast<void *>(&innerMsg), 0, 0);
+    if (ret == osOK) {
+        isBackpressured_ = false;
+        return ERR_OK;
+    }
+    HILOG_WARN(HILOG_MODULE_AAFWK, "AbilityThread osMessageQueuePut failed with %{public}d", ret);
     return IPC_REQUEST_ERROR;
 }
+
+void AbilityThread::NotifyIfDrained()
+{
+    if (!isBackpressured_) {
+        return;
+    }
+    isBackpressured_ = false;
+    (void) AbilityMsClient::GetInstance().NotifyAbilityThreadDrained();
+}
 } // namespace AbilitySlite
 } // namespace OHOS
@@ -16,6 +16,7 @@
 #include "bms_helper.h"
 #include "aafwk_event_error_code.h"
 #include "ability_errors.h"
+#include "ability_mem_pool.h"
 #include "abilityms_log.h"
 #include "utils.h"
 
@@ -129,7 +130,7 @@ uint8_t BMSHelper::QueryAbilitySvcInfo(const Want *want, AbilitySvcInfo *svcInfo
         return PARAM_NULL_ERROR;
     }
     if (IsNativeApp(want->element->bundleName)) {
-        svcInfo->bundleName = OHOS::Utils::Strdup(want->element->bundleName);
+        svcInfo->bundleName = AbilityMemPool::GetInstance().Strdup(want->element->bundleName);
         svcInfo->path = nullptr;
         svcInfo->isNativeApp = true;
         return ERR_OK;
@@ -144,15 +145,16 @@ uint8_t BMSHelper::QueryAbilitySvcInfo(const Want *want, AbilitySvcInfo *svcInfo
         ClearAbilityInfo(&abilityInfo);
         return PARAM_CHECK_ERROR;
     }
-    svcInfo->bundleName = OHOS::Utils::Strdup(abilityInfo.bundleName);
-    svcInfo->path = OHOS::Utils::Strdup(abilityInfo.srcPath);
+    svcInfo->bundleName = AbilityMemPool::GetInstance().Strdup(abilityInfo.bundleName);
+    svcInfo->path = AbilityMemPool::GetInstance().Strdup(abilityInfo.srcPath);
     svcInfo->isNativeApp = false;
     ClearAbilityInfo(&abilityInfo);
     return ERR_OK;
 #else
-    svcInfo->bundleName = Utils::Strdup(want->element->bundleName);
+    svcInfo->bundleName = AbilityMemPool::GetInstance().Strdup(want->element->bundleName);
     // Here users assign want->data with js app path.
-    svcInfo->path = Utils::Strdup((const char *)want->data);
+    svcInfo->path = AbilityMemPool::GetInstance().Strdup((const char *)want->data);
+    svcInfo->isNativeApp = IsNativeApp(want->element->bundleName);
     return ERR_OK;
 #endif
 }
@@ -176,7 +178,7 @@ void BMSHelper::ClearAbilitySvcInfo(AbilitySvcInfo *abilitySvcInfo)
     if (abilitySvcInfo == nullptr) {
         return;
     }
-    AdapterFree(abilitySvcInfo->bundleName);
-    AdapterFree(abilitySvcInfo->path);
+    AbilityMemPool::GetInstance().Free(abilitySvcInfo->bundleName);
+    AbilityMemPool::GetInstance().Free(abilitySvcInfo->path);
 }
 }
@@ -18,6 +18,8 @@
 #include "abilityms_log.h"
 #include "ability_errors.h"
 #include "ability_inner_message.h"
+#include "ability_mem_pool.h"
+#include "ability_trace.h"
 #include "adapter.h"
 #include "js_ability.h"
 #include "js_async_work.h"
@@ -30,6 +32,42 @@ constexpr uint16_t APP_TASK_PRI = 25;
 constexpr uint32_t QUEUE_LENGTH = 32;
 static char g_jsAppTask[] = "AppTask";
 
+#ifndef JS_APP_TASK_POOL_SIZE
+#define JS_APP_TASK_POOL_SIZE 0
+#endif
+
+constexpr uint32_t APP_TASK_POOL_SIZE = JS_APP_TASK_POOL_SIZE;
+
+struct ParkedAppTask {
+    UINT32 taskId;
+    osMessageQueueId_t messageQueueId;
+};
+
+// AppTasks whose ability was destroyed, kept with their queue for the next js ability instead of being deleted
+static ParkedAppTask g_parkedAppTasks[(APP_TASK_POOL_SIZE > 0) ? APP_TASK_POOL_SIZE : 1];
+static uint32_t g_parkedAppTaskCount = 0;
+
+static bool TakeParkedAppTask(UINT32 &taskId, osMessageQueueId_t &messageQueueId)
+{
+    if (g_parkedAppTaskCount == 0) {
+        return false;
+    }
+    --g_parkedAppTaskCount;
+    taskId = g_parkedAppTasks[g_parkedAppTaskCount].taskId;
+    messageQueueId = g_parkedAppTasks[g_parkedAppTaskCount].messageQueueId;
+    return true;
+}
+
+static bool ParkAppTask(UINT32 taskId, osMessageQueueId_t messageQueueId)
+{
+    if (g_parkedAppTaskCount >= APP_TASK_POOL_SIZE) {
+        return false;
+    }
+    g_parkedAppTasks[g_parkedAppTaskCount] = { taskId, messageQueueId };
+    ++g_parkedAppTaskCount;
+    return true;
+}
+
 JsAbilityThread::JsAbilityThread() = default;
 
 JsAbilityThread::~JsAbilityThread()
@@ -57,6 +95,34 @@ int32_t JsAbilityThread::InitAbilityThread(const AbilityRecord *abilityRecord)
         return PARAM_CHECK_ERROR;
     }
 
+    LOS_TaskLock();
+    if (TakeParkedAppTask(appTaskId_, messageQueueId_)) {
+        HILOG_INFO(HILOG_MODULE_AAFWK, "JsAbilityThread reuses parked AppTask %{public}u", appTaskId_);
+    } else {
+        int32_t ret = StartAppTask();
+        if (ret != ERR_OK) {
+            LOS_TaskUnlock();
+            return ret;
+        }
+    }
+    state_ = AbilityThreadState::ABILITY_THREAD_INITIALIZED;
+    ability_ = SliteAbilityLoader::GetInstance().CreateAbility(SliteAbilityType::JS_ABILITY, abilityRecord->appName);
+    if (ability_ == nullptr) {
+        HILOG_INFO(HILOG_MODULE_AAFWK, "JsAbility create fail");
+        // the task has not taken any message of this thread yet
+        RecycleAppTask(true);
+        LOS_TaskUnlock();
+        return MEMORY_MALLOC_ERROR;
+    }
+    ability_->SetToken(abilityRecord->token);
+    ACELite::JsAsyncWork::SetAppQueueHandler(messageQueueId_);
+    LOS_TaskUnlock();
+    HILOG_INFO(HILOG_MODULE_AAFWK, "JsAbilityThread init done");
+    return ERR_OK;
+}
+
+int32_t JsAbilityThread::StartAppTask()
+{
     messageQueueId_ = osMessageQueueNew(QUEUE_LENGTH, sizeof(SliteAbilityInnerMsg), nullptr);
     if (messageQueueId_ == nullptr) {
         HILOG_ERROR(HILOG_MODULE_AAFWK, "JsAbilityThread init fail: messageQueueId is null");
@@ -64,7 +130,6 @@ int32_t JsAbilityThread::InitAbilityThread(const AbilityRecord *abilityRecord)
     }
 
     TSK_INIT_PARAM_S stTskInitParam = { nullptr };
-    LOS_TaskLock();
     stTskInitParam.pfnTaskEntry = (TSK_ENTRY_FUNC) (JsAbilityThread::AppTaskHandler);
     stTskInitParam.uwStackSize = TASK_STACK_SIZE;
     stTskInitParam.usTaskPrio = OS_TASK_PRIORITY_LOWEST - APP_TASK_PRI;
@@ -75,19 +140,9 @@ int32_t JsAbilityThread::InitAbilityThread(const AbilityRecord *abilityRecord)
     if (ret != LOS_OK) {
         HILOG_ERROR(HILOG_MODULE_AAFWK, "JsAbilityThread init fail: LOS_TaskCreate ret %{public}d", ret);
         osMessageQueueDelete(messageQueueId_);
-        LOS_TaskUnlock();
+        messageQueueId_ = nullptr;
         return CREATE_APPTASK_ERROR;
     }
-    state_ = AbilityThreadState::ABILITY_THREAD_INITIALIZED;
-    ability_ = SliteAbilityLoader::GetInstance().CreateAbility(SliteAbilityType::JS_ABILITY, abilityRecord->appName);
-    if (ability_ == nullptr) {
-        HILOG_INFO(HILOG_MODULE_AAFWK, "JsAbility create fail");
-        return MEMORY_MALLOC_ERROR;
-    }
-    ability_->SetToken(abilityRecord->token);
-    ACELite::JsAsyncWork::SetAppQueueHandler(messageQueueId_);
-    LOS_TaskUnlock();
-    HILOG_INFO(HILOG_MODULE_AAFWK, "JsAbilityThread init done");
     return ERR_OK;
 }
 
@@ -99,11 +154,24 @@ int32_t JsAbilityThread::ReleaseAbilityThread()
         return PARAM_CHECK_ERROR;
     }
     state_ = AbilityThreadState::ABILITY_THREAD_RELEASED;
-    LOS_TaskDelete(appTaskId_);
+    LOS_TaskLock();
+    // a thread released without its DESTROY handled, e.g. by terminate all or eviction, leaves the task bound to it
+    RecycleAppTask(isDestroyHandled_);
+    LOS_TaskUnlock();
+    return ERR_OK;
+}
+
+void JsAbilityThread::RecycleAppTask(bool reusable)
+{
+    // messages left in the queue would still be handled for this thread
+    if (reusable && osMessageQueueGetCount(messageQueueId_) == 0 && ParkAppTask(appTaskId_, messageQueueId_)) {
+        HILOG_INFO(HILOG_MODULE_AAFWK, "JsAbilityThread parks AppTask %{public}u", appTaskId_);
+    } else {
+        LOS_TaskDelete(appTaskId_);
+        osMessageQueueDelete(messageQueueId_);
+    }
     appTaskId_ = 0;
-    osMessageQueueDelete(messageQueueId_);
     messageQueueId_ = nullptr;
-    return ERR_OK;
 }
 
 osMessageQueueId_t JsAbilityThread::GetMessageQueueId() const
@@ -123,6 +191,7 @@ void JsAbilityThread::AppTaskHandler(UINT32 uwArg)
         return;
     }
     AbilityThread *defaultAbilityThread = nullptr;
+    bool destroyed = false;
 
     for (;;) {
         SliteAbilityInnerMsg innerMsg;
@@ -131,6 +200,15 @@ void JsAbilityThread::AppTaskHandler(UINT32 uwArg)
         if (ret != osOK) {
             return;
         }
+        if (destroyed && innerMsg.msgId != SliteAbilityMsgId::CREATE) {
+            // left over for the destroyed ability, the next one bound to this parked task starts with CREATE
+            if (innerMsg.msgId == SliteAbilityMsgId::FOREGROUND) {
+                AbilityMemPool::GetInstance().ClearWant(innerMsg.want);
+                AbilityMemPool::GetInstance().Free(innerMsg.want);
+            }
+            continue;
+        }
+        destroyed = false;
         AbilityThread *abilityThread = innerMsg.abilityThread;
         if (abilityThread == nullptr) {
             if (defaultAbilityThread == nullptr) {
@@ -138,20 +216,22 @@ void JsAbilityThread::AppTaskHandler(UINT32 uwArg)
             }
             abilityThread = defaultAbilityThread;
         }
+        abilityThread->NotifyIfDrained();
         LP_TaskBegin();
+        ABILITY_TRACE(HANDLE_IN_ABILITY_THREAD, innerMsg.token, AbilityThread::GetTargetState(innerMsg.msgId));
         switch (innerMsg.msgId) {
             case SliteAbilityMsgId::CREATE:
                 defaultAbilityThread = abilityThread;
                 abilityThread->HandleCreate(innerMsg.want);
                 abilityThread->HandleRestore(innerMsg.abilitySavedData);
-                ClearWant(innerMsg.want);
-                AdapterFree(innerMsg.want);
+                AbilityMemPool::GetInstance().ClearWant(innerMsg.want);
+                AbilityMemPool::GetInstance().Free(innerMsg.want);
                 innerMsg.want = nullptr;
                 break;
             case SliteAbilityMsgId::FOREGROUND:
                 abilityThread->HandleForeground(innerMsg.want);
-                ClearWant(innerMsg.want);
-                AdapterFree(innerMsg.want);
+                AbilityMemPool::GetInstance().ClearWant(innerMsg.want);
+                AbilityMemPool::GetInstance().Free(innerMsg.want);
                 innerMsg.want = nullptr;
                 break;
             case SliteAbilityMsgId::BACKGROUND:
@@ -159,9 +239,17 @@ void JsAbilityThread::AppTaskHandler(UINT32 uwArg)
                 break;
             case SliteAbilityMsgId::DESTROY:
                 abilityThread->HandleSave(innerMsg.abilitySavedData);
+                // raised first, the AMS may release the thread as soon as OnDestroy reports the state
+                static_cast<JsAbilityThread *>(abilityThread)->isDestroyHandled_ = true;
                 abilityThread->HandleDestroy();
-                LP_TaskEnd();
-                return; // here exit the loop, and abort all messages afterwards
+                if (APP_TASK_POOL_SIZE == 0) {
+                    LP_TaskEnd();
+                    return; // here exit the loop, and abort all messages afterwards
+                }
+                // keep the task alive, it may be parked for the next js ability
+                defaultAbilityThread = nullptr;
+                destroyed = true;
+                break;
             default:
                 if (abilityThread->ability_ != nullptr) {
                     abilityThread->ability_->HandleExtraMessage(innerMsg);
@@ -19,6 +19,8 @@
 #include "aafwk_event_error_code.h"
 #include "ability_errors.h"
 #include "ability_inner_message.h"
+#include "ability_mem_pool.h"
+#include "ability_trace.h"
 #include "ability_record_manager.h"
 #include "adapter.h"
 #include "ability_thread.h"
@@ -174,20 +176,22 @@ void NativeAbilityThread::NativeAppTaskHandler(UINT32 uwArg)
             }
             abilityThread = defaultAbilityThread;
         }
+        abilityThread->NotifyIfDrained();
         LP_TaskBegin();
+        ABILITY_TRACE(HANDLE_IN_ABILITY_THREAD, innerMsg.token, AbilityThread::GetTargetState(innerMsg.msgId));
         switch (innerMsg.msgId) {
             case SliteAbilityMsgId::CREATE:
                 defaultAbilityThread = abilityThread;
                 abilityThread->HandleCreate(innerMsg.want);
                 abilityThread->HandleRestore(innerMsg.abilitySavedData);
-                ClearWant(innerMsg.want);
-                AdapterFree(innerMsg.want);
+                AbilityMemPool::GetInstance().ClearWant(innerMsg.want);
+                AbilityMemPool::GetInstance().Free(innerMsg.want);
                 innerMsg.want = nullptr;
                 break;
             case SliteAbilityMsgId::FOREGROUND:
                 abilityThread->HandleForeground(innerMsg.want);
-                ClearWant(innerMsg.want);
-                AdapterFree(innerMsg.want);
+                AbilityMemPool::GetInstance().ClearWant(innerMsg.want);
+                AbilityMemPool::GetInstance().Free(innerMsg.want);
                 innerMsg.want = nullptr;
                 break;
             case SliteAbilityMsgId::BACKGROUND:
@@ -16,6 +16,7 @@
 #include "ability_attach_task.h"
 
 #include "app_manager.h"
+#include "util/ability_trace.h"
 
 namespace OHOS {
 AbilityAttachTask::AbilityAttachTask(const AbilityThreadClient *client)
@@ -40,9 +41,11 @@ AbilityMsStatus AbilityAttachTask::Execute()
     if (appRecord == nullptr) {
         return AbilityMsStatus::TaskStatus("Attach", "appRecord not found");
     }
+    ABILITY_TRACE(ATTACH_BUNDLE, appRecord->GetPendingAbilityToken(), STATE_INITIAL);
     // step2: Save ability thread client.
     AbilityMsStatus status = appRecord->SetAbilityThreadClient(*client_);
     CHECK_RESULT(status);
+    AppManager::GetInstance().OnAppAttached(*appRecord);
 
     // step3: Load permission
     status = appRecord->LoadPermission();
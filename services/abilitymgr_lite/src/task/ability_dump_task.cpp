@@ -15,9 +15,27 @@
 
 #include "ability_dump_task.h"
 
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include <string>
+
+#include "util/ability_trace.h"
+
+#ifndef ABILITY_TRACE_EXPORT_PATH
+#define ABILITY_TRACE_EXPORT_PATH "/storage/data/ability_trace.json"
+#endif
+
 namespace OHOS {
-AbilityDumpTask::AbilityDumpTask(AbilityMgrContext *context, const AbilityDumpClient *client)
-    : AbilityTask(context), client_(client)
+namespace {
+    constexpr char TRACE_DUMP_OPTION[] = "trace";
+    constexpr char TRACE_EXPORT_OPTION[] = "trace-export";
+    // the reply goes back in one ipc message, keep it well below the io size
+    constexpr uint32_t TRACE_DUMP_SIZE = 4096;
+}
+
+AbilityDumpTask::AbilityDumpTask(AbilityMgrContext *context, const AbilityDumpClient *client,
+    const char *extraInfo) : AbilityTask(context), client_(client), extraInfo_(extraInfo)
 {
 }
 
@@ -37,13 +55,67 @@ AbilityMsStatus AbilityDumpTask::Execute()
         }
         return targetAbility->DumpAbilitySlice(client_->GetWant());
     } else {
+        if (IsExtraOption(TRACE_DUMP_OPTION)) {
+            return DumpTrace();
+        }
+        if (IsExtraOption(TRACE_EXPORT_OPTION)) {
+            return ExportTrace();
+        }
         // Query all ability
 #ifdef OHOS_DEBUG
         AbilityMsStatus status = stackManager.DumpAllAbilityRecord(*abilityMgrContext_);
-        return client_->AbilityDumpTransaction(status.Dump());
 #else
-        return client_->AbilityDumpTransaction("Dump is not available in release\n");
+        AbilityMsStatus status = AbilityMsStatus::DumpStatus("Dump is not available in release\n");
 #endif
+        if (extraInfo_ != nullptr) {
+            status.DumpAppend(extraInfo_);
+        }
+        return client_->AbilityDumpTransaction(status.Dump());
+    }
+}
+
+bool AbilityDumpTask::IsExtraOption(const char *option) const
+{
+    const Want &want = client_->GetWant();
+    if (want.data == nullptr || want.dataLength == 0) {
+        return false;
+    }
+    auto data = static_cast<const char *>(want.data);
+    return strnlen(data, want.dataLength) < want.dataLength && strcmp(data, option) == 0;
+}
+
+AbilityMsStatus AbilityDumpTask::DumpTrace() const
+{
+    char *buffer = new (std::nothrow) char[TRACE_DUMP_SIZE];
+    if (buffer == nullptr) {
+        return AbilityMsStatus::DumpStatus("dump trace alloc fail");
+    }
+    (void) AbilityTrace::GetInstance().Dump(buffer, TRACE_DUMP_SIZE);
+    AbilityMsStatus status = client_->AbilityDumpTransaction(buffer);
+    delete[] buffer;
+    return status;
+}
+
+AbilityMsStatus AbilityDumpTask::ExportTrace() const
+{
+    uint32_t size = AbilityTrace::GetChromeTraceSize();
+    char *buffer = new (std::nothrow) char[size];
+    if (buffer == nullptr) {
+        return AbilityMsStatus::DumpStatus("export trace alloc fail");
+    }
+    uint32_t length = AbilityTrace::GetInstance().ExportChromeTrace(buffer, size);
+    FILE *file = (length == 0) ? nullptr : fopen(ABILITY_TRACE_EXPORT_PATH, "w");
+    if (file == nullptr) {
+        delete[] buffer;
+        return client_->AbilityDumpTransaction("export ability trace failed\n");
+    }
+    size_t written = fwrite(buffer, 1, length, file);
+    (void) fclose(file);
+    delete[] buffer;
+    if (written != length) {
+        return client_->AbilityDumpTransaction("export ability trace failed\n");
     }
+    std::string result = std::string("ability trace exported to ") + ABILITY_TRACE_EXPORT_PATH + "\n";
+    return client_->AbilityDumpTransaction(result.c_str());
 }
 }  // namespace OHOS
@@ -16,6 +16,7 @@
 #include "ability_start_task.h"
 
 #include "ability_stack_manager.h"
+#include "util/ability_trace.h"
 
 namespace OHOS {
 AbilityStartTask::AbilityStartTask(AbilityMgrContext *context, const Want *want,
@@ -57,6 +58,8 @@ AbilityMsStatus AbilityStartTask::Execute()
         return AbilityMsStatus::TaskStatus("start", "generate ability record failure");
     }
     targetAbility->SetBundleInfo(*bundleInfo_);
+    targetAbility->SetStartCallback(*want_);
+    ABILITY_TRACE(START_TASK, targetAbility->GetToken(), STATE_INITIAL);
     if (topAbility != nullptr) {
         // step3：If topAbility is not nullptr, inactive top ability.
         PRINTD("AbilityStartTask", "topAbility is not nullptr, first inactive");
@@ -92,6 +95,7 @@ AbilityMsStatus AbilityStartTask::StartService()
     }
     auto targetAbility = new PageAbilityRecord(*target_, *want_);
     targetAbility->SetBundleInfo(*bundleInfo_);
+    ABILITY_TRACE(START_TASK, targetAbility->GetToken(), STATE_INITIAL);
     if (waitConnect_) {
         targetAbility->SetStartDone(false);
         targetAbility->SetConnectStatus(ConnectStatus::WAIT_CONNECT);
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_mem_pool.h"
+
+#include <cstring>
+
+#include "adapter.h"
+#ifdef __LITEOS_M__
+#include "los_task.h"
+#else
+#include <pthread.h>
+#endif
+#include "securec.h"
+
+#ifndef ABILITY_MEM_POOL_SMALL_BLOCKS
+#define ABILITY_MEM_POOL_SMALL_BLOCKS 16
+#endif
+
+#ifndef ABILITY_MEM_POOL_MEDIUM_BLOCKS
+#define ABILITY_MEM_POOL_MEDIUM_BLOCKS 16
+#endif
+
+#ifndef ABILITY_MEM_POOL_LARGE_BLOCKS
+#define ABILITY_MEM_POOL_LARGE_BLOCKS 8
+#endif
+
+namespace OHOS {
+namespace {
+    // in pointer-sized words: ElementName and request headers, Want and operation headers, longer bundle names
+    constexpr uint16_t SMALL_BLOCK_SIZE = 4 * sizeof(void *);
+    constexpr uint16_t MEDIUM_BLOCK_SIZE = 8 * sizeof(void *);
+    constexpr uint16_t LARGE_BLOCK_SIZE = 16 * sizeof(void *);
+
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+
+    struct SizeClass {
+        uint8_t *begin;
+        uint16_t blockSize;
+        uint16_t blockCount;
+        FreeBlock *freeList;
+        uint16_t used;
+        uint16_t highWater;
+        uint32_t exhausted;
+    };
+
+    alignas(alignof(max_align_t)) uint8_t g_smallArena[SMALL_BLOCK_SIZE * ABILITY_MEM_POOL_SMALL_BLOCKS];
+    alignas(alignof(max_align_t)) uint8_t g_mediumArena[MEDIUM_BLOCK_SIZE * ABILITY_MEM_POOL_MEDIUM_BLOCKS];
+    alignas(alignof(max_align_t)) uint8_t g_largeArena[LARGE_BLOCK_SIZE * ABILITY_MEM_POOL_LARGE_BLOCKS];
+
+    SizeClass g_sizeClasses[] = {
+        { g_smallArena, SMALL_BLOCK_SIZE, ABILITY_MEM_POOL_SMALL_BLOCKS, nullptr, 0, 0, 0 },
+        { g_mediumArena, MEDIUM_BLOCK_SIZE, ABILITY_MEM_POOL_MEDIUM_BLOCKS, nullptr, 0, 0, 0 },
+        { g_largeArena, LARGE_BLOCK_SIZE, ABILITY_MEM_POOL_LARGE_BLOCKS, nullptr, 0, 0, 0 },
+    };
+    constexpr uint32_t SIZE_CLASS_COUNT = sizeof(g_sizeClasses) / sizeof(g_sizeClasses[0]);
+
+#ifndef __LITEOS_M__
+    pthread_mutex_t g_poolMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+    SizeClass *FindOwner(const void *ptr)
+    {
+        auto address = static_cast<const uint8_t *>(ptr);
+        for (auto &sizeClass : g_sizeClasses) {
+            const uint8_t *end = sizeClass.begin + sizeClass.blockSize * sizeClass.blockCount;
+            if (address >= sizeClass.begin && address < end) {
+                return &sizeClass;
+            }
+        }
+        return nullptr;
+    }
+}
+
+AbilityMemPool &AbilityMemPool::GetInstance()
+{
+    static AbilityMemPool instance;
+    return instance;
+}
+
+AbilityMemPool::AbilityMemPool()
+{
+    for (auto &sizeClass : g_sizeClasses) {
+        sizeClass.freeList = nullptr;
+        for (uint16_t i = sizeClass.blockCount; i > 0; --i) {
+            auto block = reinterpret_cast<FreeBlock *>(sizeClass.begin + (i - 1) * sizeClass.blockSize);
+            block->next = sizeClass.freeList;
+            sizeClass.freeList = block;
+        }
+    }
+}
+
+void AbilityMemPool::Lock() const
+{
+#ifdef __LITEOS_M__
+    LOS_TaskLock();
+#else
+    (void) pthread_mutex_lock(&g_poolMutex);
+#endif
+}
+
+void AbilityMemPool::Unlock() const
+{
+#ifdef __LITEOS_M__
+    LOS_TaskUnlock();
+#else
+    (void) pthread_mutex_unlock(&g_poolMutex);
+#endif
+}
+
+void *AbilityMemPool::Alloc(size_t size)
+{
+    Lock();
+    for (auto &sizeClass : g_sizeClasses) {
+        if (size > sizeClass.blockSize) {
+            continue;
+        }
+        if (sizeClass.freeList == nullptr) {
+            // a larger class may still have room
+            sizeClass.exhausted++;
+            continue;
+        }
+        FreeBlock *block = sizeClass.freeList;
+        sizeClass.freeList = block->next;
+        sizeClass.used++;
+        if (sizeClass.used > sizeClass.highWater) {
+            sizeClass.highWater = sizeClass.used;
+        }
+        Unlock();
+        return block;
+    }
+    fallbacks_++;
+    Unlock();
+
+    void *ptr = AdapterMalloc(size);
+    if (ptr == nullptr) {
+        Lock();
+        failures_++;
+        Unlock();
+    }
+    return ptr;
+}
+
+void AbilityMemPool::Free(void *ptr)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+    SizeClass *sizeClass = FindOwner(ptr);
+    if (sizeClass == nullptr) {
+        AdapterFree(ptr);
+        return;
+    }
+    auto block = static_cast<FreeBlock *>(ptr);
+    Lock();
+    block->next = sizeClass->freeList;
+    sizeClass->freeList = block;
+    sizeClass->used--;
+    Unlock();
+}
+
+char *AbilityMemPool::Strdup(const char *str)
+{
+    if (str == nullptr) {
+        return nullptr;
+    }
+    size_t size = strlen(str) + 1;
+    auto copy = static_cast<char *>(Alloc(size));
+    if (copy == nullptr) {
+        return nullptr;
+    }
+    if (memcpy_s(copy, size, str, size) != EOK) {
+        Free(copy);
+        return nullptr;
+    }
+    return copy;
+}
+
+ElementName *AbilityMemPool::CopyElement(const ElementName &element)
+{
+    auto copy = static_cast<ElementName *>(Alloc(sizeof(ElementName)));
+    if (copy == nullptr) {
+        return nullptr;
+    }
+    copy->deviceId = Strdup(element.deviceId);
+    copy->bundleName = Strdup(element.bundleName);
+    copy->abilityName = Strdup(element.abilityName);
+    return copy;
+}
+
+void AbilityMemPool::ClearWant(Want *want)
+{
+    if (want == nullptr) {
+        return;
+    }
+    ClearElement(want->element);
+    Free(want->element);
+    want->element = nullptr;
+#ifdef OHOS_APPEXECFWK_BMS_BUNDLEMANAGER
+    Free(want->sid);
+    want->sid = nullptr;
+#endif
+    Free(const_cast<char *>(want->appPath));
+    want->appPath = nullptr;
+    Free(want->data);
+    want->data = nullptr;
+    want->dataLength = 0;
+#ifndef OHOS_APPEXECFWK_BMS_BUNDLEMANAGER
+    Free(want->actions);
+    want->actions = nullptr;
+    Free(want->entities);
+    want->entities = nullptr;
+#endif
+}
+
+void AbilityMemPool::ClearElement(ElementName *element)
+{
+    if (element == nullptr) {
+        return;
+    }
+    Free(element->deviceId);
+    element->deviceId = nullptr;
+    Free(element->bundleName);
+    element->bundleName = nullptr;
+    Free(element->abilityName);
+    element->abilityName = nullptr;
+}
+
+uint32_t AbilityMemPool::GetClassCount() const
+{
+    return SIZE_CLASS_COUNT;
+}
+
+bool AbilityMemPool::GetStat(uint32_t index, AbilityMemPoolStat &stat) const
+{
+    if (index >= SIZE_CLASS_COUNT) {
+        return false;
+    }
+    Lock();
+    const SizeClass &sizeClass = g_sizeClasses[index];
+    stat = { sizeClass.blockSize, sizeClass.blockCount, sizeClass.used, sizeClass.highWater, sizeClass.exhausted };
+    Unlock();
+    return true;
+}
+
+uint32_t AbilityMemPool::GetFallbackCount() const
+{
+    return fallbacks_;
+}
+
+uint32_t AbilityMemPool::GetFailureCount() const
+{
+    return failures_;
+}
+
+uint32_t AbilityMemPool::Dump(char *buffer, uint32_t size) const
+{
+    if (buffer == nullptr || size == 0) {
+        return 0;
+    }
+    buffer[0] = '\0';
+    uint32_t offset = 0;
+    int ret = snprintf_s(buffer, size, size - 1, "ability mem pool, heap fallbacks %u, failures %u\n",
+        fallbacks_, failures_);
+    if (ret < 0) {
+        return 0;
+    }
+    offset += static_cast<uint32_t>(ret);
+    for (uint32_t i = 0; i < SIZE_CLASS_COUNT && offset < size; ++i) {
+        AbilityMemPoolStat stat = {};
+        (void) GetStat(i, stat);
+        ret = snprintf_s(buffer + offset, size - offset, size - offset - 1,
+            "  block %u: used %u/%u, high water %u, exhausted %u\n",
+            stat.blockSize, stat.used, stat.blockCount, stat.highWater, stat.exhausted);
+        if (ret < 0) {
+            buffer[offset] = '\0';
+            break;
+        }
+        offset += static_cast<uint32_t>(ret);
+    }
+    return offset;
+}
+} // namespace OHOS
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_trace.h"
+
+#include <cinttypes>
+#include <cstdarg>
+#include <new>
+
+#ifdef __LITEOS_M__
+#include "cmsis_os2.h"
+#include "los_task.h"
+#else
+#include <ctime>
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#include "securec.h"
+
+namespace OHOS {
+namespace {
+#ifndef __LITEOS_M__
+    pthread_mutex_t g_traceMutex = PTHREAD_MUTEX_INITIALIZER;
+    constexpr uint64_t US_PER_SECOND = 1000000;
+    constexpr uint64_t NS_PER_US = 1000;
+#endif
+    constexpr uint32_t CHROME_EVENT_MAX_LEN = 160;
+    constexpr uint32_t CHROME_FRAME_LEN = 64;
+
+    const char *g_eventNames[] = {
+        "StartAbility",
+        "PreCheckStartAbility",
+        "CreateAppTask",
+        "SendMsgToAbilityThread",
+        "AbilityThreadHandle",
+        "SchedulerLifecycleDone",
+        "AbilityStartTask",
+        "SpawnProcess",
+        "AttachBundle",
+        "ScheduleTransaction",
+        "AbilityTransactionDone",
+    };
+
+    uint64_t GetMonotonicTimeUs()
+    {
+#ifdef __LITEOS_M__
+        // the kernel tick is the finest clock every LiteOS-M board provides
+        uint64_t freq = osKernelGetTickFreq();
+        return (freq == 0) ? 0 : static_cast<uint64_t>(osKernelGetTickCount()) * 1000000 / freq;
+#else
+        struct timespec now = {};
+        (void) clock_gettime(CLOCK_MONOTONIC, &now);
+        return static_cast<uint64_t>(now.tv_sec) * US_PER_SECOND + static_cast<uint64_t>(now.tv_nsec) / NS_PER_US;
+#endif
+    }
+
+    bool Append(char *buffer, uint32_t size, uint32_t &offset, const char *format, ...)
+    {
+        if (offset >= size) {
+            return false;
+        }
+        va_list args;
+        va_start(args, format);
+        int ret = vsnprintf_s(buffer + offset, size - offset, size - offset - 1, format, args);
+        va_end(args);
+        if (ret < 0) {
+            // keep the output ending at a complete line
+            buffer[offset] = '\0';
+            return false;
+        }
+        offset += static_cast<uint32_t>(ret);
+        return true;
+    }
+}
+
+AbilityTrace &AbilityTrace::GetInstance()
+{
+    static AbilityTrace instance;
+    return instance;
+}
+
+AbilityTrace::AbilityTrace()
+{
+#ifdef ABILITY_TRACE_ENABLE
+    records_ = new (std::nothrow) AbilityTraceRecord[ABILITY_TRACE_CAPACITY];
+#endif
+}
+
+AbilityTrace::~AbilityTrace()
+{
+    delete[] records_;
+    records_ = nullptr;
+}
+
+void AbilityTrace::Lock() const
+{
+#ifdef __LITEOS_M__
+    LOS_TaskLock();
+#else
+    (void) pthread_mutex_lock(&g_traceMutex);
+#endif
+}
+
+void AbilityTrace::Unlock() const
+{
+#ifdef __LITEOS_M__
+    LOS_TaskUnlock();
+#else
+    (void) pthread_mutex_unlock(&g_traceMutex);
+#endif
+}
+
+void AbilityTrace::Record(AbilityTraceEvent event, uint64_t token, int32_t state)
+{
+    Record(event, token, state, GetMonotonicTimeUs());
+}
+
+void AbilityTrace::Record(AbilityTraceEvent event, uint64_t token, int32_t state, uint64_t timeUs)
+{
+    if (records_ == nullptr) {
+        return;
+    }
+    Lock();
+    records_[recordCount_ % ABILITY_TRACE_CAPACITY] = { timeUs, token, state, event };
+    recordCount_++;
+    Unlock();
+}
+
+uint64_t AbilityTrace::GetTimeUs()
+{
+    return GetMonotonicTimeUs();
+}
+
+void AbilityTrace::Clear()
+{
+    Lock();
+    recordCount_ = 0;
+    Unlock();
+}
+
+const char *AbilityTrace::GetEventName(AbilityTraceEvent event)
+{
+    auto index = static_cast<uint32_t>(event);
+    if (index >= static_cast<uint32_t>(AbilityTraceEvent::EVENT_MAX)) {
+        return "Unknown";
+    }
+    return g_eventNames[index];
+}
+
+uint32_t AbilityTrace::Snapshot(AbilityTraceRecord *records) const
+{
+    Lock();
+    uint32_t count = (recordCount_ < ABILITY_TRACE_CAPACITY) ? recordCount_ : ABILITY_TRACE_CAPACITY;
+    uint32_t first = recordCount_ - count;
+    for (uint32_t i = 0; i < count; ++i) {
+        records[i] = records_[(first + i) % ABILITY_TRACE_CAPACITY];
+    }
+    Unlock();
+    return count;
+}
+
+int64_t AbilityTrace::GetDuration(const AbilityTraceRecord *records, uint32_t count, uint32_t index)
+{
+    for (uint32_t next = index + 1; next < count; ++next) {
+        if (records[next].token == records[index].token) {
+            return static_cast<int64_t>(records[next].timeUs - records[index].timeUs);
+        }
+    }
+    return -1;
+}
+
+uint32_t AbilityTrace::Dump(char *buffer, uint32_t size) const
+{
+    if (buffer == nullptr || size == 0) {
+        return 0;
+    }
+    buffer[0] = '\0';
+    uint32_t offset = 0;
+    if (records_ == nullptr) {
+        (void) Append(buffer, size, offset, "ability trace is disabled\n");
+        return offset;
+    }
+    auto records = new (std::nothrow) AbilityTraceRecord[ABILITY_TRACE_CAPACITY];
+    if (records == nullptr) {
+        return 0;
+    }
+    uint32_t count = Snapshot(records);
+    bool fit = Append(buffer, size, offset, "ability trace, %u records, newest first:\n", count);
+    for (uint32_t i = count; fit && i > 0; --i) {
+        const AbilityTraceRecord &record = records[i - 1];
+        int64_t duration = GetDuration(records, count, i - 1);
+        if (duration < 0) {
+            fit = Append(buffer, size, offset, "  %" PRIu64 " us  %-24s token %" PRIu64 "  state %d\n",
+                record.timeUs, GetEventName(record.event), record.token, record.state);
+        } else {
+            fit = Append(buffer, size, offset, "  %" PRIu64 " us  %-24s token %" PRIu64 "  state %d  +%" PRId64
+                " us\n", record.timeUs, GetEventName(record.event), record.token, record.state, duration);
+        }
+    }
+    delete[] records;
+    return offset;
+}
+
+uint32_t AbilityTrace::GetChromeTraceSize()
+{
+    return ABILITY_TRACE_CAPACITY * CHROME_EVENT_MAX_LEN + CHROME_FRAME_LEN;
+}
+
+uint32_t AbilityTrace::ExportChromeTrace(char *buffer, uint32_t size) const
+{
+    if (buffer == nullptr || size == 0) {
+        return 0;
+    }
+    buffer[0] = '\0';
+    auto records = new (std::nothrow) AbilityTraceRecord[ABILITY_TRACE_CAPACITY];
+    if (records == nullptr) {
+        return 0;
+    }
+    uint32_t count = (records_ == nullptr) ? 0 : Snapshot(records);
+#ifdef __LITEOS_M__
+    int pid = 0;
+#else
+    int pid = getpid();
+#endif
+    uint32_t offset = 0;
+    bool fit = Append(buffer, size, offset, "{\"traceEvents\":[");
+    for (uint32_t i = 0; fit && i < count; ++i) {
+        const AbilityTraceRecord &record = records[i];
+        const char *separator = (i == 0) ? "" : ",";
+        // a transition lasts until the next transition of the same ability, the last one is an instant event
+        int64_t duration = GetDuration(records, count, i);
+        if (duration < 0) {
+            fit = Append(buffer, size, offset, "%s{\"name\":\"%s\",\"cat\":\"ability\",\"ph\":\"i\",\"s\":\"t\","
+                "\"ts\":%" PRIu64 ",\"pid\":%d,\"tid\":%" PRIu64 ",\"args\":{\"state\":%d}}", separator,
+                GetEventName(record.event), record.timeUs, pid, record.token, record.state);
+        } else {
+            fit = Append(buffer, size, offset, "%s{\"name\":\"%s\",\"cat\":\"ability\",\"ph\":\"X\","
+                "\"ts\":%" PRIu64 ",\"dur\":%" PRId64 ",\"pid\":%d,\"tid\":%" PRIu64 ",\"args\":{\"state\":%d}}",
+                separator, GetEventName(record.event), record.timeUs, duration, pid, record.token, record.state);
+        }
+    }
+    delete[] records;
+    if (!fit || !Append(buffer, size, offset, "],\"displayTimeUnit\":\"ms\"}\n")) {
+        buffer[0] = '\0';
+        return 0;
+    }
+    return offset;
+}
+} // namespace OHOS
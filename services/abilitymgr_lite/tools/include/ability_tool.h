@@ -16,7 +16,12 @@
 #ifndef OHOS_ABILITY_TOOL_H
 #define OHOS_ABILITY_TOOL_H
 
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
 #include <iproxy_client.h>
+#include "ability_connection.h"
 #include "ipc_skeleton.h"
 #include "want.h"
 
@@ -31,8 +36,22 @@ public:
     bool SetCommand(const char *command);
     bool RunCommand();
     void SetDumpAll();
+    bool SetBenchMode(const char *mode);
+    bool SetIterations(const char *iterations);
+    bool SetWarmup(const char *warmup);
+    bool SetBackBundleName(const char *bundleName);
+    bool SetBackAbilityName(const char *abilityName);
+    void SetCsvPath(const char *csvPath);
 
 private:
+    // callbacks a bench wait can end on, several may be done at a time
+    enum BenchCallback : uint32_t {
+        BENCH_START_DONE = 1,
+        BENCH_CONNECT_DONE = 2,
+        BENCH_DISCONNECT_DONE = 4,
+        BENCH_DUMP_DONE = 8,
+    };
+
     Want* BuildWant();
     bool InnerStartAbility();
     bool InnerStopAbility();
@@ -40,10 +59,33 @@ private:
     bool Dump(IClientProxy *proxy);
     static int32_t AaCallback(uint32_t code, IpcIo *data, IpcIo *reply, MessageOption option);
 
+    // bench
+    bool Bench(IClientProxy *proxy);
+    bool BenchOnce(IClientProxy *proxy, uint32_t iteration, uint64_t &latency, uint64_t &teardown);
+    bool StartAndWait(const ElementName &element, uint64_t &latency);
+    bool TerminateAndWait(IClientProxy *proxy);
+    bool IsAbilityRecorded(IClientProxy *proxy, bool &recorded);
+    bool ConnectAndWait(uint64_t &latency);
+    bool WaitCallback(uint32_t callback);
+    void ReportBench(std::vector<uint64_t> &latencies, uint64_t elapsed) const;
+    static void OnBenchConnectDone(ElementName *elementName, SvcIdentity *serviceSid, int resultCode, void *data);
+    static void OnBenchDisconnectDone(ElementName *elementName, int resultCode, void *data);
+
     ElementName elementName_ { nullptr, nullptr, nullptr };
     char *extra_ { nullptr };
     char *command_ { nullptr };
     bool dumpAll_ { false };
+    ElementName backElementName_ { nullptr, nullptr, nullptr };
+    char *benchMode_ { nullptr };
+    char *csvPath_ { nullptr };
+    uint32_t iterations_ { 0 };
+    uint32_t warmup_ { 0 };
+    bool benchmarking_ { false };
+    int32_t callbackResult_ { 0 };
+    int32_t connectResult_ { 0 };
+    bool abilityRecorded_ { false };
+    std::atomic<uint32_t> doneCallbacks_ { 0 };
+    IAbilityConnection benchConnection_ { nullptr, nullptr };
     SvcIdentity identity_ {};
     static const int MAX_OBJECTS = 2;
     IpcObjectStub objectStub_;
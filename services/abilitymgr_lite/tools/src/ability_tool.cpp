@@ -15,13 +15,17 @@
 
 #include "ability_tool.h"
 
+#include <algorithm>
+#include <cerrno>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <ohos_errno.h>
 #include <ctime>
 #include <samgr_lite.h>
 #include <securec.h>
 #include <semaphore.h>
+#include <unistd.h>
 
 #include "ability_errors.h"
 #include "ability_kit_command.h"
@@ -39,6 +43,49 @@ constexpr char CMD_START_ABILITY[] = "start";
 constexpr char CMD_STOP_ABILITY[] = "stopability";
 constexpr char CMD_TERMINATE_APP[] = "terminate";
 constexpr char CMD_DUMP_ABILITY[] = "dump";
+constexpr char CMD_BENCH[] = "bench";
+constexpr char BENCH_START[] = "start";
+constexpr char BENCH_SWITCH[] = "switch";
+constexpr char BENCH_CONNECT[] = "connect";
+constexpr uint32_t DEFAULT_BENCH_ITERATIONS = 100;
+constexpr int BENCH_WAIT_TIMEOUT = 10; // 10 second
+constexpr useconds_t BENCH_POLL_INTERVAL = 10000; // 10 ms
+// the dump reply of ams for an ability it has no record of
+constexpr char ABILITY_NOT_FOUND[] = "Ability not found\n";
+constexpr uint64_t NS_PER_SECOND = 1000000000;
+constexpr double NS_PER_US = 1000.0;
+constexpr uint32_t PERCENT_P50 = 50;
+constexpr uint32_t PERCENT_P99 = 99;
+constexpr uint32_t PERCENT_ALL = 100;
+
+uint64_t GetMonotonicTime()
+{
+    struct timespec ts = { 0, 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * NS_PER_SECOND + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+bool ParseCount(const char *value, uint32_t &count)
+{
+    if (value == nullptr || *value == '\0') {
+        return false;
+    }
+    char *end = nullptr;
+    errno = 0;
+    unsigned long result = strtoul(value, &end, 10); // decimal
+    if (errno != 0 || *end != '\0' || result > UINT32_MAX) {
+        return false;
+    }
+    count = static_cast<uint32_t>(result);
+    return true;
+}
+
+// nearest rank percentile of sorted latencies
+uint64_t GetPercentile(const std::vector<uint64_t> &latencies, uint32_t percent)
+{
+    size_t rank = (latencies.size() * percent + PERCENT_ALL - 1) / PERCENT_ALL;
+    return latencies[(rank == 0) ? 0 : rank - 1];
+}
 } // namespace
 
 static sem_t g_sem;
@@ -46,6 +93,7 @@ static sem_t g_sem;
 AbilityTool::~AbilityTool()
 {
     ClearElement(&elementName_);
+    ClearElement(&backElementName_);
 }
 
 bool AbilityTool::SetBundleName(const char *bundleName)
@@ -79,7 +127,8 @@ bool AbilityTool::SetCommand(const char *command)
     if (strcmp(command, CMD_START_ABILITY) != 0 &&
         strcmp(command, CMD_STOP_ABILITY) != 0 &&
         strcmp(command, CMD_TERMINATE_APP) != 0 &&
-        strcmp(command, CMD_DUMP_ABILITY) != 0) {
+        strcmp(command, CMD_DUMP_ABILITY) != 0 &&
+        strcmp(command, CMD_BENCH) != 0) {
         return false;
     }
     printf("receive command: %s\n", command);
@@ -92,6 +141,49 @@ void AbilityTool::SetDumpAll()
     dumpAll_ = true;
 }
 
+bool AbilityTool::SetBenchMode(const char *mode)
+{
+    if (mode == nullptr ||
+        (strcmp(mode, BENCH_START) != 0 && strcmp(mode, BENCH_SWITCH) != 0 && strcmp(mode, BENCH_CONNECT) != 0)) {
+        return false;
+    }
+    benchMode_ = const_cast<char *>(mode);
+    return true;
+}
+
+bool AbilityTool::SetIterations(const char *iterations)
+{
+    return ParseCount(iterations, iterations_) && iterations_ > 0;
+}
+
+bool AbilityTool::SetWarmup(const char *warmup)
+{
+    return ParseCount(warmup, warmup_);
+}
+
+bool AbilityTool::SetBackBundleName(const char *bundleName)
+{
+    if (bundleName == nullptr || strlen(bundleName) == 0) {
+        return false;
+    }
+    SetElementBundleName(&backElementName_, bundleName);
+    return true;
+}
+
+bool AbilityTool::SetBackAbilityName(const char *abilityName)
+{
+    if (abilityName == nullptr || strlen(abilityName) == 0) {
+        return false;
+    }
+    SetElementAbilityName(&backElementName_, abilityName);
+    return true;
+}
+
+void AbilityTool::SetCsvPath(const char *csvPath)
+{
+    csvPath_ = const_cast<char *>(csvPath);
+}
+
 bool AbilityTool::RunCommand()
 {
     if (command_ == nullptr) {
@@ -126,6 +218,8 @@ bool AbilityTool::RunCommand()
         retVal = TerminateApp(innerProxy);
     } else if (strcmp(command_, CMD_DUMP_ABILITY) == 0) {
         retVal = Dump(innerProxy);
+    } else if (strcmp(command_, CMD_BENCH) == 0) {
+        retVal = Bench(innerProxy);
     } else {
         printf("unknown command: %s\n", command_);
     }
@@ -237,25 +331,36 @@ bool AbilityTool::Dump(IClientProxy *proxy)
 
 int32_t AbilityTool::AaCallback(uint32_t code, IpcIo *data, IpcIo *reply, MessageOption option)
 {
-    printf("get ability info\n");
     auto abilityTool = static_cast<AbilityTool *>(option.args);
     if (abilityTool == nullptr) {
         printf("ams call back error, abilityTool is null\n");
         return -1;
     }
+    if (!abilityTool->benchmarking_) {
+        printf("get ability info\n");
+    }
     switch (code) {
         case SCHEDULER_APP_INIT: {
             ElementName element = {};
             DeserializeElement(&element, data);
             int32_t ret = 0;
             ReadInt32(data, &ret);
-            printf("ams call back, start %s.%s ret = %d\n", element.bundleName, element.abilityName, ret);
+            abilityTool->callbackResult_ = ret;
+            abilityTool->doneCallbacks_.fetch_or(BENCH_START_DONE);
+            if (!abilityTool->benchmarking_ || ret != 0) {
+                printf("ams call back, start %s.%s ret = %d\n", element.bundleName, element.abilityName, ret);
+            }
             ClearElement(&element);
             break;
         }
         case SCHEDULER_DUMP_ABILITY: {
             size_t len = 0;
             char *result = reinterpret_cast<char *>(ReadString(data, &len));
+            if (abilityTool->benchmarking_) {
+                abilityTool->abilityRecorded_ = (result != nullptr && strcmp(result, ABILITY_NOT_FOUND) != 0);
+                abilityTool->doneCallbacks_.fetch_or(BENCH_DUMP_DONE);
+                break;
+            }
             printf("dump ability info:\n");
             if (!abilityTool->dumpAll_) {
                 printf("[%s][%s]\n", abilityTool->elementName_.bundleName, abilityTool->elementName_.abilityName);
@@ -277,4 +382,225 @@ int32_t AbilityTool::AaCallback(uint32_t code, IpcIo *data, IpcIo *reply, Messag
     sem_post(&g_sem);
     return 0;
 }
+
+bool AbilityTool::Bench(IClientProxy *proxy)
+{
+    if (benchMode_ == nullptr) {
+        printf("bench needs one of start, switch or connect\n");
+        return false;
+    }
+    if (elementName_.bundleName == nullptr || elementName_.abilityName == nullptr) {
+        printf("ability name or bundle name is not entered\n");
+        return false;
+    }
+    if (strcmp(benchMode_, BENCH_SWITCH) == 0 &&
+        (backElementName_.bundleName == nullptr || backElementName_.abilityName == nullptr)) {
+        printf("bench switch needs the ability to switch back to, -b bundlename -m ability_name\n");
+        return false;
+    }
+    if (iterations_ == 0) {
+        iterations_ = DEFAULT_BENCH_ITERATIONS;
+    }
+    if (sem_init(&g_sem, 0, 0)) {
+        printf("sem_init failed\n");
+        return false;
+    }
+    benchmarking_ = true;
+    benchConnection_.OnAbilityConnectDone = AbilityTool::OnBenchConnectDone;
+    benchConnection_.OnAbilityDisconnectDone = AbilityTool::OnBenchDisconnectDone;
+
+    uint64_t latency = 0;
+    uint64_t teardown = 0;
+    if (strcmp(benchMode_, BENCH_SWITCH) == 0) {
+        // both abilities must be running before a start only switches between them
+        if (!StartAndWait(backElementName_, latency) || !StartAndWait(elementName_, latency)) {
+            printf("bench switch failed to start the abilities\n");
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < warmup_; i++) {
+        if (!BenchOnce(proxy, i, latency, teardown)) {
+            printf("bench %s failed in warmup iteration %u\n", benchMode_, i);
+            return false;
+        }
+    }
+    std::vector<uint64_t> latencies;
+    latencies.reserve(iterations_);
+    uint64_t teardowns = 0;
+    uint64_t begin = GetMonotonicTime();
+    for (uint32_t i = 0; i < iterations_; i++) {
+        if (!BenchOnce(proxy, warmup_ + i, latency, teardown)) {
+            printf("bench %s failed in iteration %u\n", benchMode_, i);
+            return false;
+        }
+        latencies.push_back(latency);
+        teardowns += teardown;
+    }
+    // like the latencies, the throughput leaves out the terminate or disconnect between the iterations
+    ReportBench(latencies, GetMonotonicTime() - begin - teardowns);
+    return true;
+}
+
+bool AbilityTool::BenchOnce(IClientProxy *proxy, uint32_t iteration, uint64_t &latency, uint64_t &teardown)
+{
+    teardown = 0;
+    if (strcmp(benchMode_, BENCH_START) == 0) {
+        // terminate the app after each start so that every start is a cold start
+        if (!StartAndWait(elementName_, latency)) {
+            return false;
+        }
+        uint64_t begin = GetMonotonicTime();
+        bool terminated = TerminateAndWait(proxy);
+        teardown = GetMonotonicTime() - begin;
+        return terminated;
+    }
+    if (strcmp(benchMode_, BENCH_SWITCH) == 0) {
+        // the target is on top after the setup, so even iterations switch back
+        return StartAndWait((iteration % 2 == 0) ? backElementName_ : elementName_, latency);
+    }
+    if (!ConnectAndWait(latency)) {
+        return false;
+    }
+    // the next connect must not overtake the disconnect of this one
+    uint64_t begin = GetMonotonicTime();
+    doneCallbacks_.fetch_and(~BENCH_DISCONNECT_DONE);
+    bool disconnected = DisconnectAbility(&benchConnection_) == ERR_OK && WaitCallback(BENCH_DISCONNECT_DONE);
+    teardown = GetMonotonicTime() - begin;
+    return disconnected && connectResult_ == 0;
+}
+
+bool AbilityTool::StartAndWait(const ElementName &element, uint64_t &latency)
+{
+    Want want = {};
+    SetWantElement(&want, element);
+    // the start callback reports when the ability became active
+    SetWantSvcIdentity(&want, identity_);
+    callbackResult_ = -1;
+    doneCallbacks_.fetch_and(~BENCH_START_DONE);
+    uint64_t begin = GetMonotonicTime();
+    int ret = StartAbility(&want);
+    ClearWant(&want);
+    if (ret != ERR_OK || !WaitCallback(BENCH_START_DONE)) {
+        return false;
+    }
+    latency = GetMonotonicTime() - begin;
+    return callbackResult_ == 0;
+}
+
+bool AbilityTool::TerminateAndWait(IClientProxy *proxy)
+{
+    if (!TerminateApp(proxy)) {
+        return false;
+    }
+    // the terminate is only queued, the next start must not find the records of the app still there
+    uint64_t deadline = GetMonotonicTime() + BENCH_WAIT_TIMEOUT * NS_PER_SECOND;
+    bool recorded = true;
+    while (IsAbilityRecorded(proxy, recorded) && recorded) {
+        if (GetMonotonicTime() > deadline) {
+            printf("wait for app exit timeout\n");
+            return false;
+        }
+        (void)usleep(BENCH_POLL_INTERVAL);
+    }
+    return !recorded;
+}
+
+bool AbilityTool::IsAbilityRecorded(IClientProxy *proxy, bool &recorded)
+{
+    Want want = {};
+    SetWantElement(&want, elementName_);
+    SetWantSvcIdentity(&want, identity_);
+    IpcIo req;
+    char data[MAX_IO_SIZE];
+    IpcIoInit(&req, data, MAX_IO_SIZE, MAX_OBJECTS);
+    bool serialized = SerializeWant(&req, &want);
+    ClearWant(&want);
+    if (!serialized) {
+        return false;
+    }
+    doneCallbacks_.fetch_and(~BENCH_DUMP_DONE);
+    if (proxy->Invoke(proxy, DUMP_ABILITY, &req, nullptr, nullptr) != EC_SUCCESS || !WaitCallback(BENCH_DUMP_DONE)) {
+        return false;
+    }
+    recorded = abilityRecorded_;
+    return true;
+}
+
+bool AbilityTool::ConnectAndWait(uint64_t &latency)
+{
+    Want want = {};
+    SetWantElement(&want, elementName_);
+    connectResult_ = -1;
+    doneCallbacks_.fetch_and(~BENCH_CONNECT_DONE);
+    uint64_t begin = GetMonotonicTime();
+    int ret = ConnectAbility(&want, &benchConnection_, this);
+    ClearWant(&want);
+    if (ret != ERR_OK || !WaitCallback(BENCH_CONNECT_DONE)) {
+        return false;
+    }
+    latency = GetMonotonicTime() - begin;
+    return connectResult_ == 0;
+}
+
+bool AbilityTool::WaitCallback(uint32_t callback)
+{
+    struct timespec ts = { 0, 0 };
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += BENCH_WAIT_TIMEOUT;
+    // every callback posts g_sem, the wait only ends once the awaited one is done
+    while ((doneCallbacks_.load() & callback) == 0) {
+        if (sem_timedwait(&g_sem, &ts) != 0 && errno != EINTR) {
+            printf("wait for callback timeout\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+void AbilityTool::ReportBench(std::vector<uint64_t> &latencies, uint64_t elapsed) const
+{
+    if (csvPath_ != nullptr) {
+        FILE *csv = fopen(csvPath_, "w");
+        if (csv == nullptr) {
+            printf("failed to open %s\n", csvPath_);
+        } else {
+            fprintf(csv, "iteration,latency_us\n");
+            for (size_t i = 0; i < latencies.size(); i++) {
+                fprintf(csv, "%zu,%.1f\n", i, latencies[i] / NS_PER_US);
+            }
+            (void)fclose(csv);
+        }
+    }
+    std::sort(latencies.begin(), latencies.end());
+    printf("bench %s %s.%s: %zu iterations, %u warmup\n", benchMode_, elementName_.bundleName,
+        elementName_.abilityName, latencies.size(), warmup_);
+    printf("latency(us): min %.1f, p50 %.1f, p99 %.1f, max %.1f\n", latencies.front() / NS_PER_US,
+        GetPercentile(latencies, PERCENT_P50) / NS_PER_US, GetPercentile(latencies, PERCENT_P99) / NS_PER_US,
+        latencies.back() / NS_PER_US);
+    printf("throughput: %.2f ops/s\n", static_cast<double>(latencies.size()) * NS_PER_SECOND / elapsed);
+}
+
+void AbilityTool::OnBenchConnectDone(ElementName *elementName, SvcIdentity *serviceSid, int resultCode, void *data)
+{
+    auto abilityTool = static_cast<AbilityTool *>(data);
+    if (abilityTool == nullptr) {
+        return;
+    }
+    abilityTool->connectResult_ = resultCode;
+    abilityTool->doneCallbacks_.fetch_or(BENCH_CONNECT_DONE);
+    sem_post(&g_sem);
+}
+
+void AbilityTool::OnBenchDisconnectDone(ElementName *elementName, int resultCode, void *data)
+{
+    auto abilityTool = static_cast<AbilityTool *>(data);
+    if (abilityTool == nullptr) {
+        return;
+    }
+    if (resultCode != 0) {
+        abilityTool->connectResult_ = resultCode;
+    }
+    abilityTool->doneCallbacks_.fetch_or(BENCH_DISCONNECT_DONE);
+    sem_post(&g_sem);
+}
 } // namespace OHOS
@@ -15,6 +15,7 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <getopt.h>
 
 #include "ability_tool.h"
@@ -29,6 +30,9 @@ static void PrintUsage()
     printf("aa terminate -p bundlename\n");
     printf("aa dump -p bundlename -n ability_name -e extra_option\n");
     printf("aa dump -a\n");
+    printf("aa dump -a -e trace|trace-export\n");
+    printf("aa bench start|connect -p bundlename -n ability_name [-c iterations] [-w warmup] [-o csv_file]\n");
+    printf("aa bench switch -p bundlename -n ability_name -b bundlename -m ability_name [-c iterations]\n");
     printf("\n");
     printf("Options:\n");
     printf(" -h (--help)                Show the help information.             [eg: aa -h]\n");
@@ -36,19 +40,25 @@ static void PrintUsage()
     printf(" -n (--abilityname)         Appoint the ability name.              [eg: -n MyAbility]\n");
     printf(" -a (--all)                 [Unnecessary]dump all ability info.    [eg: -a]\n");
     printf(" -e (--extra)               [Unnecessary]extra info when dump.     [eg: -e]\n");
+    printf(" -c (--count)               [Unnecessary]bench iterations.         [eg: -c 100]\n");
+    printf(" -w (--warmup)              [Unnecessary]bench warmup iterations.  [eg: -w 5]\n");
+    printf(" -b (--backbundlename)      Bundle name to switch back to.         [eg: -b com.huawei.launcher]\n");
+    printf(" -m (--backabilityname)     Ability name to switch back to.        [eg: -m MainAbility]\n");
+    printf(" -o (--output)              [Unnecessary]bench latencies csv file. [eg: -o /data/bench.csv]\n");
     printf("\n");
     printf("Commands:\n");
     printf("aa start                    Start the target ability.\n");
     printf("aa stopability              Stop the target service ability.\n");
     printf("aa terminate                Terminate the target app.\n");
     printf("aa dump                     Dump ability\n");
+    printf("aa bench                    Measure start, switch or connect latency.\n");
 }
 
 static void SetOptions(int argc, char *argv[], const option *options, AbilityTool &tool)
 {
     const char *command = argv[1];
     int index = 0;
-    const char *optStr = "hap:n:e:";
+    const char *optStr = "hap:n:e:c:w:b:m:o:";
     int para = 0;
     while ((para = getopt_long(argc, argv, optStr, options, &index)) != -1) {
         switch (para) {
@@ -72,6 +82,38 @@ static void SetOptions(int argc, char *argv[], const option *options, AbilityToo
                 tool.SetExtra(optarg);
                 break;
             }
+            case 'c': {
+                if (!tool.SetIterations(optarg)) {
+                    printf("Invalid iterations: %s\n", optarg);
+                    exit(-1);
+                }
+                break;
+            }
+            case 'w': {
+                if (!tool.SetWarmup(optarg)) {
+                    printf("Invalid warmup: %s\n", optarg);
+                    exit(-1);
+                }
+                break;
+            }
+            case 'b': {
+                if (!tool.SetBackBundleName(optarg)) {
+                    printf("Invalid back bundle name: %s\n", optarg);
+                    exit(-1);
+                }
+                break;
+            }
+            case 'm': {
+                if (!tool.SetBackAbilityName(optarg)) {
+                    printf("Invalid back ability name: %s\n", optarg);
+                    exit(-1);
+                }
+                break;
+            }
+            case 'o': {
+                tool.SetCsvPath(optarg);
+                break;
+            }
             default:
                 printf("Try 'aa -h' for more information.\n");
                 exit(-1);
@@ -81,6 +123,11 @@ static void SetOptions(int argc, char *argv[], const option *options, AbilityToo
         printf("Unsupported this command. Try 'aa -h' for more information.\n");
         exit(-1);
     }
+    // getopt moves the operands behind the options, the bench mode follows the command
+    if (strcmp(command, "bench") == 0 && (optind + 1 >= argc || !tool.SetBenchMode(argv[optind + 1]))) {
+        printf("Unsupported bench mode. Try 'aa -h' for more information.\n");
+        exit(-1);
+    }
 }
 
 int main(int argc, char *argv[])
@@ -91,6 +138,11 @@ int main(int argc, char *argv[])
         {"abilityname", required_argument, nullptr, 'n'},
         {"all",         no_argument,       nullptr, 'a'},
         {"extra",       required_argument, nullptr, 'e'},
+        {"count",       required_argument, nullptr, 'c'},
+        {"warmup",      required_argument, nullptr, 'w'},
+        {"backbundlename",  required_argument, nullptr, 'b'},
+        {"backabilityname", required_argument, nullptr, 'm'},
+        {"output",      required_argument, nullptr, 'o'},
         {nullptr,       no_argument,       nullptr, 0},
     };
 
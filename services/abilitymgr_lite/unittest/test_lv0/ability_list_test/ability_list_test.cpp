@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+#include "ability_list.h"
+#include "ability_lock_guard.h"
+#include "ability_record.h"
+#include "ability_record_observer_manager.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AbilitySlite {
+    constexpr uint32_t BENCHMARK_ROUNDS = 20000;
+    constexpr uint32_t BENCHMARK_REPEATS = 5;
+    constexpr uint32_t BUNDLE_NAME_LEN = 64;
+    constexpr uint16_t LARGE_WANT_DATA_SIZE = 2048;
+
+    // the list walk AbilityList used before the token and bundle name indexes were added, under the same kind of lock
+    static AbilityRecord *LinearGet(const List<AbilityRecord *> &list, osMutexId_t mutex, uint16_t token)
+    {
+        AbilityLockGuard locker(mutex);
+        for (auto node = list.Begin(); node != list.End(); node = node->next_) {
+            if (node->value_ != nullptr && node->value_->token == token) {
+                return node->value_;
+            }
+        }
+        return nullptr;
+    }
+
+    static AbilityRecord *LinearGet(const List<AbilityRecord *> &list, osMutexId_t mutex, const char *bundleName)
+    {
+        AbilityLockGuard locker(mutex);
+        for (auto node = list.Begin(); node != list.End(); node = node->next_) {
+            AbilityRecord *record = node->value_;
+            if (record != nullptr && record->appName != nullptr && strcmp(bundleName, record->appName) == 0) {
+                return record;
+            }
+        }
+        return nullptr;
+    }
+
+    // the fastest of a few runs, so a preempted run does not decide the comparison
+    template<typename Lookup>
+    static int64_t MeasureLookups(Lookup lookup, uint32_t &hits)
+    {
+        int64_t best = INT64_MAX;
+        for (uint32_t repeat = 0; repeat < BENCHMARK_REPEATS; repeat++) {
+            auto begin = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < BENCHMARK_ROUNDS; i++) {
+                hits += lookup() ? 1 : 0;
+            }
+            auto cost = std::chrono::steady_clock::now() - begin;
+            best = std::min(best,
+                static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(cost).count()));
+        }
+        return best;
+    }
+
+    static AbilityRecord *NewRecord(uint16_t token)
+    {
+        char bundleName[BUNDLE_NAME_LEN] = { 0 };
+        (void)snprintf(bundleName, sizeof(bundleName), "com.example.bundle%u", token);
+        auto record = new AbilityRecord();
+        record->SetAppName((token == LAUNCHER_TOKEN) ? MAIN_BUNDLE_NAME : bundleName);
+        record->token = token;
+        return record;
+    }
+
+    class SingleVictimPolicy : public AbilityEvictionPolicy {
+    public:
+        int32_t GetEvictionScore(const AbilityEvictionInfo &info) override
+        {
+            return (strcmp(info.bundleName, victim_) == 0) ? 1 : -1;
+        }
+
+        const char *victim_ = nullptr;
+    };
+
+    class EvictionObserver : public AbilityRecordObserver {
+    public:
+        void OnAbilityRecordEvicted(const AbilityEvictionInfo &info) override
+        {
+            evictedCount_++;
+            overBudget_ = info.overBudget;
+            (void)snprintf(bundleName_, sizeof(bundleName_), "%s", info.bundleName);
+        }
+
+        uint32_t evictedCount_ = 0;
+        bool overBudget_ = false;
+        char bundleName_[BUNDLE_NAME_LEN] = { 0 };
+    };
+
+    class AbilityListTest : public testing::Test {
+    public:
+        void SetUp() override
+        {
+            abilityList_ = new AbilityList();
+        }
+
+        void TearDown() override
+        {
+            AbilityRecord *record = abilityList_->GetTopAbility();
+            while (record != nullptr) {
+                abilityList_->Erase(record->token);
+                delete record;
+                record = abilityList_->GetTopAbility();
+            }
+            delete abilityList_;
+            abilityList_ = nullptr;
+        }
+
+        AbilityList *abilityList_ = nullptr;
+    };
+
+    /**
+     * @tc.name: AbilityListGet001
+     * @tc.desc: test Get by token and by bundle name after MoveToTop and Erase.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilityListTest, AbilityListGet001, TestSize.Level0)
+    {
+        for (uint16_t token = LAUNCHER_TOKEN; token < ABILITY_LIST_CAPACITY; token++) {
+            abilityList_->Add(NewRecord(token));
+        }
+        EXPECT_EQ(abilityList_->Size(), static_cast<uint32_t>(ABILITY_LIST_CAPACITY));
+        AbilityRecord *record = abilityList_->Get(static_cast<uint16_t>(1));
+        ASSERT_NE(record, nullptr);
+        EXPECT_EQ(abilityList_->Get(record->appName), record);
+
+        EXPECT_TRUE(abilityList_->MoveToTop(record->token));
+        EXPECT_EQ(abilityList_->GetTopAbility(), record);
+        EXPECT_EQ(abilityList_->Get(record->token), record);
+
+        abilityList_->Erase(record->token);
+        EXPECT_EQ(abilityList_->Get(record->token), nullptr);
+        EXPECT_EQ(abilityList_->Get(record->appName), nullptr);
+        delete record;
+
+        for (uint16_t token = 2; token < ABILITY_LIST_CAPACITY; token++) {
+            EXPECT_NE(abilityList_->Get(token), nullptr);
+        }
+    }
+
+    /**
+     * @tc.name: AbilityListGet002
+     * @tc.desc: test Get by a bundle name several records share returns the most recently used one.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilityListTest, AbilityListGet002, TestSize.Level0)
+    {
+        AbilityRecord *older = NewRecord(1);
+        AbilityRecord *newer = NewRecord(2);
+        newer->SetAppName(older->appName);
+        abilityList_->Add(older);
+        abilityList_->Add(newer);
+        EXPECT_EQ(abilityList_->Get(older->appName), newer);
+
+        EXPECT_TRUE(abilityList_->MoveToTop(older->token));
+        EXPECT_EQ(abilityList_->Get(older->appName), older);
+
+        abilityList_->Erase(older->token);
+        EXPECT_EQ(abilityList_->Get(newer->appName), newer);
+        delete older;
+    }
+
+    /**
+     * @tc.name: AbilityListPopBottom001
+     * @tc.desc: test eviction keeps the permanent record at the bottom of the list.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilityListTest, AbilityListPopBottom001, TestSize.Level0)
+    {
+        for (uint16_t token = LAUNCHER_TOKEN; token < ABILITY_LIST_CAPACITY; token++) {
+            abilityList_->Add(NewRecord(token));
+        }
+        abilityList_->Add(NewRecord(ABILITY_LIST_CAPACITY));
+        EXPECT_EQ(abilityList_->Size(), static_cast<uint32_t>(ABILITY_LIST_CAPACITY));
+        EXPECT_NE(abilityList_->Get(static_cast<uint16_t>(LAUNCHER_TOKEN)), nullptr);
+        EXPECT_EQ(abilityList_->Get(static_cast<uint16_t>(1)), nullptr);
+        EXPECT_EQ(abilityList_->Get("com.example.bundle1"), nullptr);
+    }
+
+    /**
+     * @tc.name: AbilityListEviction001
+     * @tc.desc: test a full list evicts the record chosen by the eviction policy and reports it.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilityListTest, AbilityListEviction001, TestSize.Level0)
+    {
+        EvictionObserver observer;
+        AbilityRecordObserverManager::GetInstance().AddObserver(&observer);
+        SingleVictimPolicy policy;
+        policy.victim_ = "com.example.bundle3";
+        abilityList_->SetEvictionPolicy(&policy);
+        for (uint16_t token = LAUNCHER_TOKEN; token <= ABILITY_LIST_CAPACITY; token++) {
+            abilityList_->Add(NewRecord(token));
+        }
+        abilityList_->SetEvictionPolicy(nullptr);
+        AbilityRecordObserverManager::GetInstance().RemoveObserver(&observer);
+
+        EXPECT_EQ(abilityList_->Size(), static_cast<uint32_t>(ABILITY_LIST_CAPACITY));
+        EXPECT_EQ(abilityList_->Get(static_cast<uint16_t>(3)), nullptr);
+        EXPECT_NE(abilityList_->Get(static_cast<uint16_t>(1)), nullptr);
+        EXPECT_EQ(observer.evictedCount_, 1u);
+        EXPECT_FALSE(observer.overBudget_);
+        EXPECT_STREQ(observer.bundleName_, "com.example.bundle3");
+    }
+
+    /**
+     * @tc.name: AbilityListEviction002
+     * @tc.desc: test the memory budget evicts the record with the largest footprint before the list is full.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilityListTest, AbilityListEviction002, TestSize.Level0)
+    {
+        constexpr uint16_t recordCount = 4;
+        static uint8_t wantData[LARGE_WANT_DATA_SIZE] = { 0 };
+        for (uint16_t token = LAUNCHER_TOKEN; token < recordCount; token++) {
+            AbilityRecord *record = NewRecord(token);
+            if (token == 2) {
+                record->SetWantData(wantData, sizeof(wantData));
+            }
+            abilityList_->Add(record);
+        }
+        EvictionObserver observer;
+        AbilityRecordObserverManager::GetInstance().AddObserver(&observer);
+        AbilityRecord *newRecord = NewRecord(recordCount);
+        abilityList_->SetMemoryBudget(abilityList_->GetFootprint() + newRecord->GetFootprint() - 1);
+        abilityList_->Add(newRecord);
+        AbilityRecordObserverManager::GetInstance().RemoveObserver(&observer);
+
+        EXPECT_EQ(abilityList_->Size(), static_cast<uint32_t>(recordCount));
+        EXPECT_EQ(abilityList_->Get(static_cast<uint16_t>(2)), nullptr);
+        EXPECT_NE(abilityList_->Get(static_cast<uint16_t>(1)), nullptr);
+        EXPECT_EQ(abilityList_->GetTopAbility(), newRecord);
+        EXPECT_EQ(observer.evictedCount_, 1u);
+        EXPECT_TRUE(observer.overBudget_);
+        EXPECT_STREQ(observer.bundleName_, "com.example.bundle2");
+    }
+
+    /**
+     * @tc.name: AbilityListBenchmark001
+     * @tc.desc: test indexed lookups in a full ability list are no slower than the list walk they replace.
+     * @tc.type: PERF
+     */
+    HWTEST_F(AbilityListTest, AbilityListBenchmark001, TestSize.Level1)
+    {
+        List<AbilityRecord *> reference;
+        for (uint16_t token = LAUNCHER_TOKEN; token < ABILITY_LIST_CAPACITY; token++) {
+            AbilityRecord *record = NewRecord(token);
+            abilityList_->Add(record);
+            reference.PushFront(record);
+        }
+        osMutexId_t referenceMutex = osMutexNew(nullptr);
+        ASSERT_NE(referenceMutex, nullptr);
+        // the bottom records are the worst case of the list walk
+        AbilityRecord *bottom = abilityList_->Get(static_cast<uint16_t>(1));
+        ASSERT_NE(bottom, nullptr);
+
+        uint32_t hits = 0;
+        int64_t linearCost = MeasureLookups([&] {
+            return (LinearGet(reference, referenceMutex, bottom->token) != nullptr) &&
+                (LinearGet(reference, referenceMutex, bottom->appName) != nullptr);
+        }, hits);
+        int64_t indexedCost = MeasureLookups([&] {
+            return (abilityList_->Get(bottom->token) != nullptr) && (abilityList_->Get(bottom->appName) != nullptr);
+        }, hits);
+        osMutexDelete(referenceMutex);
+        EXPECT_EQ(hits, BENCHMARK_ROUNDS * BENCHMARK_REPEATS * 2);
+
+        printf("AbilityList lookup with %d records, %u rounds: list walk %lld ns, index %lld ns\n",
+            ABILITY_LIST_CAPACITY, BENCHMARK_ROUNDS, static_cast<long long>(linearCost),
+            static_cast<long long>(indexedCost));
+        EXPECT_LE(indexedCost, linearCost);
+    }
+} // namespace AbilitySlite
+} // namespace OHOS
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ability_errors.h"
+#include "ability_manager_inner.h"
+#include "ability_record_manager.h"
+#include "ability_record_observer.h"
+#include "slite_host.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AbilitySlite {
+    constexpr uint32_t WAIT_TIMEOUT_MS = 5000;
+    constexpr uint32_t BENCHMARK_ROUNDS = 200;
+    constexpr uint32_t BUNDLE_NAME_LEN = 64;
+    constexpr uint32_t MAX_DEPTH = 8;
+    constexpr uint32_t COALESCED_STARTS = 4;
+    constexpr uint32_t STAT_DUMP_SIZE = 128;
+    constexpr uint32_t NS_PER_US = 1000;
+    constexpr uint64_t NS_PER_SECOND = 1000000000;
+
+    static void GetBundleName(uint32_t index, char *bundleName, uint32_t size)
+    {
+        (void)snprintf(bundleName, size, "com.example.app%u", index);
+    }
+
+    // records every state change the AMS reports, with the time it was reported
+    class LifecycleRecorder : public AbilityRecordObserver {
+    public:
+        struct Event {
+            std::string appName;
+            AbilityRecordState state;
+            uint64_t timeNs;
+        };
+
+        void OnAbilityRecordStateChanged(const AbilityRecordStateData &data) override
+        {
+            uint64_t now = SliteHost::GetTimeNs();
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::string appName = (data.GetAppName() == nullptr) ? "" : data.GetAppName();
+            if (data.GetState() == SCHEDULE_INITED) {
+                (void)records_.insert(appName);
+            } else if (data.GetState() == SCHEDULE_FOREGROUND) {
+                foreground_ = appName;
+            }
+            events_.push_back({ appName, data.GetState(), now });
+            changed_.notify_all();
+        }
+
+        void OnAbilityRecordCleanup(char *appName) override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (appName != nullptr) {
+                (void)records_.erase(appName);
+            }
+            changed_.notify_all();
+        }
+
+        size_t Mark()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return events_.size();
+        }
+
+        std::string GetForeground()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return foreground_;
+        }
+
+        size_t GetRecordCount()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return records_.size();
+        }
+
+        // waits for appName to reach state after the event at from, a null appName matches any app
+        bool Wait(size_t from, const char *appName, AbilityRecordState state, Event &found)
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            return changed_.wait_for(lock, std::chrono::milliseconds(WAIT_TIMEOUT_MS), [&] {
+                for (size_t index = from; index < events_.size(); index++) {
+                    const Event &event = events_[index];
+                    if (event.state == state && (appName == nullptr || event.appName == appName)) {
+                        found = event;
+                        return true;
+                    }
+                }
+                return false;
+            });
+        }
+
+        bool Wait(size_t from, const char *appName, AbilityRecordState state, uint64_t &timeNs)
+        {
+            Event found;
+            if (!Wait(from, appName, state, found)) {
+                return false;
+            }
+            timeNs = found.timeNs;
+            return true;
+        }
+
+        bool Wait(size_t from, const char *appName, AbilityRecordState state)
+        {
+            uint64_t timeNs = 0;
+            return Wait(from, appName, state, timeNs);
+        }
+
+        // waits until the AMS has cleaned up every record but count of them
+        bool WaitRecords(size_t count)
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            return changed_.wait_for(lock, std::chrono::milliseconds(WAIT_TIMEOUT_MS), [&] {
+                return records_.size() <= count;
+            });
+        }
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable changed_;
+        std::vector<Event> events_;
+        // the apps that have a record in the AMS, from their first inited state to their cleanup
+        std::set<std::string> records_;
+        std::string foreground_;
+    };
+
+    // the latency of each step of a switch from the top ability to the one being started
+    struct SwitchCost {
+        uint64_t total = 0;
+        uint64_t toBackground = 0;
+        uint64_t toStop = 0;
+        uint64_t toInited = 0;
+        uint64_t toForeground = 0;
+        uint32_t count = 0;
+
+        void Print(const char *name, uint32_t depth) const
+        {
+            if (count == 0) {
+                return;
+            }
+            printf("AbilityRecordManager %s at stack depth %u, %u rounds: %llu us/op, %.0f op/s, "
+                "background %llu us, stop %llu us, inited %llu us, foreground %llu us\n",
+                name, depth, count, static_cast<unsigned long long>(total / count / NS_PER_US),
+                static_cast<double>(count) * NS_PER_SECOND / static_cast<double>(total),
+                static_cast<unsigned long long>(toBackground / count / NS_PER_US),
+                static_cast<unsigned long long>(toStop / count / NS_PER_US),
+                static_cast<unsigned long long>(toInited / count / NS_PER_US),
+                static_cast<unsigned long long>(toForeground / count / NS_PER_US));
+        }
+    };
+
+    class AbilityRecordManagerTest : public testing::Test {
+    public:
+        static void SetUpTestCase()
+        {
+            ASSERT_TRUE(SliteHost::Boot(&recorder_));
+            ASSERT_TRUE(recorder_.Wait(0, LAUNCHER_BUNDLE_NAME, SCHEDULE_FOREGROUND));
+        }
+
+        void TearDown() override
+        {
+            Reset();
+        }
+
+        // brings the launcher back to the top and drops every other record
+        static void Reset()
+        {
+            if (recorder_.GetForeground() != LAUNCHER_BUNDLE_NAME) {
+                size_t mark = recorder_.Mark();
+                ASSERT_EQ(SliteHost::StartAbility(LAUNCHER_BUNDLE_NAME), ERR_OK);
+                ASSERT_TRUE(recorder_.Wait(mark, LAUNCHER_BUNDLE_NAME, SCHEDULE_FOREGROUND));
+            }
+            // only the launcher record is left
+            if (recorder_.GetRecordCount() > 1) {
+                ASSERT_EQ(SliteHost::TerminateAll(nullptr), ERR_OK);
+                ASSERT_TRUE(recorder_.WaitRecords(1));
+            }
+        }
+
+        // starts appName over top and adds the latency of each step to cost
+        static bool Switch(const char *top, const char *appName, SwitchCost &cost)
+        {
+            size_t mark = recorder_.Mark();
+            uint64_t begin = SliteHost::GetTimeNs();
+            if (SliteHost::StartAbility(appName) != ERR_OK) {
+                return false;
+            }
+            uint64_t background = 0;
+            uint64_t stop = 0;
+            uint64_t inited = 0;
+            uint64_t foreground = 0;
+            if (!recorder_.Wait(mark, appName, SCHEDULE_FOREGROUND, foreground) ||
+                !recorder_.Wait(mark, top, SCHEDULE_BACKGROUND, background) ||
+                !recorder_.Wait(mark, top, SCHEDULE_STOP, stop) ||
+                !recorder_.Wait(mark, appName, SCHEDULE_INITED, inited)) {
+                return false;
+            }
+            cost.total += foreground - begin;
+            cost.toBackground += background - begin;
+            cost.toStop += stop - background;
+            cost.toInited += inited - stop;
+            cost.toForeground += foreground - inited;
+            cost.count++;
+            return true;
+        }
+
+        static LifecycleRecorder recorder_;
+    };
+
+    LifecycleRecorder AbilityRecordManagerTest::recorder_;
+
+    /**
+     * @tc.name: AbilityRecordManagerStart001
+     * @tc.desc: test a started app takes the foreground from the launcher and gives it back when force stopped.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilityRecordManagerTest, AbilityRecordManagerStart001, TestSize.Level0)
+    {
+        const char *appName = "com.example.app";
+        size_t mark = recorder_.Mark();
+        ASSERT_EQ(SliteHost::StartAbility(appName), ERR_OK);
+        EXPECT_TRUE(recorder_.Wait(mark, LAUNCHER_BUNDLE_NAME, SCHEDULE_BACKGROUND));
+        EXPECT_TRUE(recorder_.Wait(mark, appName, SCHEDULE_INITED));
+        ASSERT_TRUE(recorder_.Wait(mark, appName, SCHEDULE_FOREGROUND));
+
+        mark = recorder_.Mark();
+        ASSERT_EQ(SliteHost::ForceStop(appName), ERR_OK);
+        EXPECT_TRUE(recorder_.Wait(mark, appName, SCHEDULE_STOP));
+        EXPECT_TRUE(recorder_.Wait(mark, LAUNCHER_BUNDLE_NAME, SCHEDULE_FOREGROUND));
+    }
+
+    /**
+     * @tc.name: AbilityRecordManagerCoalesce001
+     * @tc.desc: test starts queued behind a running start are coalesced and only the last of them is started.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilityRecordManagerTest, AbilityRecordManagerCoalesce001, TestSize.Level1)
+    {
+        AbilityOperationStat before;
+        AbilityRecordManager::GetInstance().GetOperationStat(before);
+        size_t mark = recorder_.Mark();
+        char bundleName[BUNDLE_NAME_LEN] = { 0 };
+        // the first start keeps the AMS scheduling while the others arrive
+        for (uint32_t i = 1; i <= COALESCED_STARTS; i++) {
+            GetBundleName(i, bundleName, sizeof(bundleName));
+            ASSERT_EQ(SliteHost::StartAbility(bundleName), ERR_OK);
+        }
+        ASSERT_TRUE(recorder_.Wait(mark, bundleName, SCHEDULE_FOREGROUND));
+        EXPECT_EQ(recorder_.GetForeground(), bundleName);
+
+        AbilityOperationStat after;
+        AbilityRecordManager::GetInstance().GetOperationStat(after);
+        EXPECT_EQ(after.queueDepth, 0);
+        EXPECT_GE(after.coalescedCount - before.coalescedCount, 1);
+        EXPECT_LE(after.coalescedCount - before.coalescedCount, COALESCED_STARTS - 1);
+
+        char dump[STAT_DUMP_SIZE] = { 0 };
+        EXPECT_GT(DumpAbilityOperationStat(dump, sizeof(dump)), 0);
+        EXPECT_NE(strstr(dump, "coalesced"), nullptr);
+    }
+
+    /**
+     * @tc.name: AbilityRecordManagerBenchmark001
+     * @tc.desc: measure start, switch and terminate latency and throughput at stack depths 1, 4 and 8.
+     * @tc.type: PERF
+     */
+    HWTEST_F(AbilityRecordManagerTest, AbilityRecordManagerBenchmark001, TestSize.Level1)
+    {
+        const uint32_t depths[] = { 1, 4, MAX_DEPTH };
+        char bundleNames[MAX_DEPTH][BUNDLE_NAME_LEN] = { { 0 } };
+        for (uint32_t index = 0; index < MAX_DEPTH; index++) {
+            GetBundleName(index, bundleNames[index], BUNDLE_NAME_LEN);
+        }
+        for (uint32_t depth : depths) {
+            Reset();
+            // open depth apps over the launcher
+            SwitchCost start;
+            const char *top = LAUNCHER_BUNDLE_NAME;
+            for (uint32_t index = 0; index < depth; index++) {
+                ASSERT_TRUE(Switch(top, bundleNames[index], start));
+                top = bundleNames[index];
+            }
+
+            // bring the other open apps back in turn, at depth 1 the launcher is the only other one
+            SwitchCost switchCost;
+            for (uint32_t round = 0; round < BENCHMARK_ROUNDS; round++) {
+                const char *next = (depth == 1) ? LAUNCHER_BUNDLE_NAME : bundleNames[round % depth];
+                if (strcmp(next, top) == 0) {
+                    next = (depth == 1) ? bundleNames[0] : bundleNames[(round + 1) % depth];
+                }
+                ASSERT_TRUE(Switch(top, next, switchCost));
+                top = next;
+            }
+
+            // force stop the top until the launcher is back in the foreground
+            uint64_t terminateCost = 0;
+            uint32_t terminated = 0;
+            std::string current = top;
+            while (current != LAUNCHER_BUNDLE_NAME) {
+                size_t mark = recorder_.Mark();
+                uint64_t begin = SliteHost::GetTimeNs();
+                ASSERT_EQ(SliteHost::ForceStop(current.c_str()), ERR_OK);
+                LifecycleRecorder::Event foreground;
+                ASSERT_TRUE(recorder_.Wait(mark, nullptr, SCHEDULE_FOREGROUND, foreground));
+                terminateCost += foreground.timeNs - begin;
+                terminated++;
+                current = foreground.appName;
+            }
+
+            start.Print("start", depth);
+            switchCost.Print("switch", depth);
+            if (terminated > 0) {
+                printf("AbilityRecordManager terminate at stack depth %u, %u rounds: %llu us/op\n", depth, terminated,
+                    static_cast<unsigned long long>(terminateCost / terminated / NS_PER_US));
+            }
+        }
+    }
+} // namespace AbilitySlite
+} // namespace OHOS
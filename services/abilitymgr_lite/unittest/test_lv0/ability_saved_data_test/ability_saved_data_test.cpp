@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "gtest/gtest.h"
+
+#include "ability_saved_data.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AbilitySlite {
+    constexpr char BUNDLE_NAME[] = "com.example.saved";
+    constexpr char SPILL_FILE[] = ABILITY_SAVED_DATA_DIR "/com.example.saved.sav";
+    constexpr uint16_t STATE_SIZE = 700;
+    constexpr uint16_t USER_STATE_SIZE = 300;
+    constexpr uint32_t MAX_FILE_SIZE = 4096;
+    constexpr uint32_t RANDOM_SEED = 7;
+
+    static uint32_t ReadSpillFile(uint8_t *buffer)
+    {
+        FILE *file = fopen(SPILL_FILE, "rb");
+        if (file == nullptr) {
+            return 0;
+        }
+        auto size = static_cast<uint32_t>(fread(buffer, 1, MAX_FILE_SIZE, file));
+        (void)fclose(file);
+        return size;
+    }
+
+    static void WriteSpillFile(const uint8_t *buffer, uint32_t size)
+    {
+        FILE *file = fopen(SPILL_FILE, "wb");
+        ASSERT_NE(file, nullptr);
+        EXPECT_EQ(fwrite(buffer, 1, size, file), size);
+        (void)fclose(file);
+    }
+
+    class AbilitySavedDataTest : public testing::Test {
+    public:
+        static void SetUpTestCase()
+        {
+            (void)mkdir(ABILITY_SAVED_DATA_DIR, S_IRWXU);
+        }
+
+        void SetUp() override
+        {
+            (void)unlink(SPILL_FILE);
+            // repeated text as a page state looks, and bytes the compressor cannot shrink
+            const char pattern[] = "{\"page\":\"index\",\"scroll\":12}";
+            for (uint16_t i = 0; i < STATE_SIZE; i++) {
+                state_[i] = static_cast<uint8_t>(pattern[i % (sizeof(pattern) - 1)]);
+            }
+            srand(RANDOM_SEED);
+            for (uint16_t i = 0; i < USER_STATE_SIZE; i++) {
+                userState_[i] = static_cast<uint8_t>(rand());
+            }
+        }
+
+        void TearDown() override
+        {
+            (void)unlink(SPILL_FILE);
+        }
+
+        // spills the states and keeps the file, as the eviction of a record does
+        void SpillAndPersist()
+        {
+            auto savedData = new AbilitySavedData();
+            ASSERT_EQ(savedData->SetSavedData(state_, STATE_SIZE), SavedResultCode::SAVED_RESULT_OK);
+            ASSERT_EQ(savedData->SetUserSavedData(userState_, USER_STATE_SIZE), SavedResultCode::SAVED_RESULT_OK);
+            ASSERT_EQ(savedData->Spill(BUNDLE_NAME), SavedResultCode::SAVED_RESULT_OK);
+            EXPECT_EQ(savedData->GetResidentSize(), 0);
+            savedData->Persist();
+            delete savedData;
+            EXPECT_EQ(access(SPILL_FILE, F_OK), 0);
+        }
+
+        void ExpectStates(AbilitySavedData &savedData)
+        {
+            uint8_t buffer[SAVED_DATA_LIMIT] = { 0 };
+            uint16_t size = 0;
+            EXPECT_EQ(savedData.GetSavedData(buffer, sizeof(buffer), &size), SavedResultCode::SAVED_RESULT_OK);
+            ASSERT_EQ(size, STATE_SIZE);
+            EXPECT_EQ(memcmp(buffer, state_, STATE_SIZE), 0);
+            EXPECT_EQ(savedData.GetUserSavedData(buffer, sizeof(buffer), &size), SavedResultCode::SAVED_RESULT_OK);
+            ASSERT_EQ(size, USER_STATE_SIZE);
+            EXPECT_EQ(memcmp(buffer, userState_, USER_STATE_SIZE), 0);
+        }
+
+        uint8_t state_[STATE_SIZE] = { 0 };
+        uint8_t userState_[USER_STATE_SIZE] = { 0 };
+    };
+
+    /**
+     * @tc.name: AbilitySavedData001
+     * @tc.desc: test Compress shrinks repetitive data and gives back the same bytes, incompressible data included.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilitySavedDataTest, AbilitySavedData001, TestSize.Level0)
+    {
+        AbilitySavedData savedData;
+        EXPECT_EQ(savedData.Compress(), SavedResultCode::SAVED_RESULT_NO_DATA);
+        ASSERT_EQ(savedData.SetSavedData(state_, STATE_SIZE), SavedResultCode::SAVED_RESULT_OK);
+        ASSERT_EQ(savedData.Compress(), SavedResultCode::SAVED_RESULT_OK);
+        EXPECT_LT(savedData.GetResidentSize(), STATE_SIZE);
+        ASSERT_EQ(savedData.SetUserSavedData(userState_, USER_STATE_SIZE), SavedResultCode::SAVED_RESULT_OK);
+        ASSERT_EQ(savedData.Compress(), SavedResultCode::SAVED_RESULT_OK);
+        ExpectStates(savedData);
+    }
+
+    /**
+     * @tc.name: AbilitySavedData002
+     * @tc.desc: test spilled data is attached by the next record of the bundle and the file removed on restore.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilitySavedDataTest, AbilitySavedData002, TestSize.Level0)
+    {
+        SpillAndPersist();
+        AbilitySavedData savedData;
+        ASSERT_EQ(savedData.Attach(BUNDLE_NAME), SavedResultCode::SAVED_RESULT_OK);
+        EXPECT_EQ(savedData.Restore(), SavedResultCode::SAVED_RESULT_OK);
+        EXPECT_NE(access(SPILL_FILE, F_OK), 0);
+        ExpectStates(savedData);
+
+        EXPECT_EQ(savedData.Attach(BUNDLE_NAME), SavedResultCode::SAVED_RESULT_NO_DATA);
+        EXPECT_EQ(savedData.Attach("../saved"), SavedResultCode::SAVED_RESULT_INVALID_PARAM);
+
+        // spilled but not persisted, the file goes with the object
+        auto spilled = new AbilitySavedData();
+        ASSERT_EQ(spilled->SetSavedData(state_, STATE_SIZE), SavedResultCode::SAVED_RESULT_OK);
+        ASSERT_EQ(spilled->Spill(BUNDLE_NAME), SavedResultCode::SAVED_RESULT_OK);
+        EXPECT_EQ(access(SPILL_FILE, F_OK), 0);
+        delete spilled;
+        EXPECT_NE(access(SPILL_FILE, F_OK), 0);
+    }
+
+    /**
+     * @tc.name: AbilitySavedData003
+     * @tc.desc: test a corrupted or truncated spill file is rejected and removed.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilitySavedDataTest, AbilitySavedData003, TestSize.Level1)
+    {
+        uint8_t file[MAX_FILE_SIZE] = { 0 };
+        SpillAndPersist();
+        uint32_t fileSize = ReadSpillFile(file);
+        ASSERT_GT(fileSize, 0);
+        file[fileSize - 1] ^= 0xFF;
+        WriteSpillFile(file, fileSize);
+        AbilitySavedData corrupted;
+        ASSERT_EQ(corrupted.Attach(BUNDLE_NAME), SavedResultCode::SAVED_RESULT_OK);
+        EXPECT_EQ(corrupted.Restore(), SavedResultCode::SAVED_RESULT_INVALID_PARAM);
+        EXPECT_NE(access(SPILL_FILE, F_OK), 0);
+        uint8_t buffer[SAVED_DATA_LIMIT] = { 0 };
+        uint16_t size = 0;
+        EXPECT_NE(corrupted.GetSavedData(buffer, sizeof(buffer), &size), SavedResultCode::SAVED_RESULT_OK);
+        EXPECT_EQ(size, 0);
+
+        SpillAndPersist();
+        fileSize = ReadSpillFile(file);
+        WriteSpillFile(file, fileSize / 2);
+        AbilitySavedData truncated;
+        ASSERT_EQ(truncated.Attach(BUNDLE_NAME), SavedResultCode::SAVED_RESULT_OK);
+        EXPECT_EQ(truncated.Restore(), SavedResultCode::SAVED_RESULT_INVALID_PARAM);
+        EXPECT_NE(access(SPILL_FILE, F_OK), 0);
+    }
+
+    /**
+     * @tc.name: AbilitySavedData004
+     * @tc.desc: test a spill file left by an earlier boot is not attached and is removed.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(AbilitySavedDataTest, AbilitySavedData004, TestSize.Level1)
+    {
+        uint8_t file[MAX_FILE_SIZE] = { 0 };
+        SpillAndPersist();
+        uint32_t fileSize = ReadSpillFile(file);
+        ASSERT_GT(fileSize, sizeof(uint32_t));
+        // the file starts with the boot generation
+        uint32_t generation = 0;
+        (void)memcpy(&generation, file, sizeof(generation));
+        generation--;
+        (void)memcpy(file, &generation, sizeof(generation));
+        WriteSpillFile(file, fileSize);
+
+        AbilitySavedData savedData;
+        EXPECT_EQ(savedData.Attach(BUNDLE_NAME), SavedResultCode::SAVED_RESULT_NO_DATA);
+        EXPECT_NE(access(SPILL_FILE, F_OK), 0);
+    }
+} // namespace AbilitySlite
+} // namespace OHOS
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "ability_connect_mission.h"
+#include "page_ability_record.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+    constexpr uint64_t PAGE_TOKEN = 1;
+
+    class ConnectMissionTest : public testing::Test {
+    public:
+        void SetUp() override
+        {
+            connectMission_ = new AbilityConnectMission();
+        }
+
+        void TearDown() override
+        {
+            delete connectMission_;
+            connectMission_ = nullptr;
+        }
+
+        PageAbilityRecord *PushService(const char *bundleName, const char *abilityName)
+        {
+            AbilityInfo abilityInfo = {};
+            abilityInfo.bundleName = const_cast<char *>(bundleName);
+            abilityInfo.name = const_cast<char *>(abilityName);
+            Want want = {};
+            auto service = new PageAbilityRecord(abilityInfo, want);
+            connectMission_->PushServiceRecord(*service);
+            service->SetConnectMission(connectMission_);
+            return service;
+        }
+
+        static void Connect(PageAbilityRecord *service, int32_t handle, uint64_t pageToken)
+        {
+            SvcIdentity connectSid = {};
+            connectSid.handle = handle;
+            service->pushConnectRecord(new AbilityConnectRecord(connectSid, pageToken));
+        }
+
+        AbilityConnectMission *connectMission_ = nullptr;
+    };
+
+    /**
+     * @tc.name: ConnectMissionFind001
+     * @tc.desc: test services are found by token, by name and by connection until they are removed.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(ConnectMissionTest, ConnectMissionFind001, TestSize.Level0)
+    {
+        PageAbilityRecord *first = PushService("com.example.first", "FirstService");
+        PageAbilityRecord *second = PushService("com.example.first", "SecondService");
+        PageAbilityRecord *other = PushService("com.example.other", "FirstService");
+        EXPECT_EQ(connectMission_->FindServiceRecord(second->GetToken()), second);
+        EXPECT_EQ(connectMission_->FindServiceRecord("com.example.other", "FirstService"), other);
+        EXPECT_EQ(connectMission_->CountServiceInApp("com.example.first"), 2);
+
+        Connect(first, 1, PAGE_TOKEN);
+        Connect(other, 2, PAGE_TOKEN);
+        SvcIdentity connectSid = {};
+        connectSid.handle = 2;
+        EXPECT_EQ(connectMission_->FindServiceRecord(connectSid, PAGE_TOKEN), other);
+        EXPECT_EQ(connectMission_->FindServiceRecord(connectSid, PAGE_TOKEN + 1), nullptr);
+        other->RemoveConnectRecord(connectSid);
+        EXPECT_EQ(connectMission_->FindServiceRecord(connectSid, PAGE_TOKEN), nullptr);
+
+        uint64_t firstToken = first->GetToken();
+        connectMission_->RemoveServiceRecord(firstToken);
+        connectSid.handle = 1;
+        EXPECT_EQ(connectMission_->FindServiceRecord(firstToken), nullptr);
+        EXPECT_EQ(connectMission_->FindServiceRecord("com.example.first", "FirstService"), nullptr);
+        EXPECT_EQ(connectMission_->FindServiceRecord(connectSid, PAGE_TOKEN), nullptr);
+        EXPECT_EQ(connectMission_->CountServiceInApp("com.example.first"), 1);
+    }
+
+    /**
+     * @tc.name: ConnectMissionPageToken001
+     * @tc.desc: test the connections of a terminated page are dropped from the services of other bundles only.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(ConnectMissionTest, ConnectMissionPageToken001, TestSize.Level0)
+    {
+        PageAbilityRecord *own = PushService("com.example.page", "PageService");
+        PageAbilityRecord *other = PushService("com.example.other", "OtherService");
+        Connect(own, 1, PAGE_TOKEN);
+        Connect(other, 2, PAGE_TOKEN);
+        Connect(other, 3, PAGE_TOKEN);
+        Connect(other, 4, PAGE_TOKEN + 1);
+
+        connectMission_->RemoveConnectRecordByPageToken(PAGE_TOKEN, "com.example.page");
+        SvcIdentity connectSid = {};
+        connectSid.handle = 1;
+        EXPECT_EQ(connectMission_->FindServiceRecord(connectSid, PAGE_TOKEN), own);
+        connectSid.handle = 3;
+        EXPECT_EQ(connectMission_->FindServiceRecord(connectSid, PAGE_TOKEN), nullptr);
+        connectSid.handle = 4;
+        EXPECT_EQ(connectMission_->FindServiceRecord(connectSid, PAGE_TOKEN + 1), other);
+        EXPECT_EQ(other->GetConnectRecords().size(), 1u);
+    }
+
+    /**
+     * @tc.name: ConnectMissionSharedSid001
+     * @tc.desc: test two services connected from one page with the sid of its process are disconnected in turn.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(ConnectMissionTest, ConnectMissionSharedSid001, TestSize.Level0)
+    {
+        PageAbilityRecord *first = PushService("com.example.first", "SharedService");
+        PageAbilityRecord *second = PushService("com.example.second", "SharedService");
+        PageAbilityRecord *same = PushService("com.example.first", "SharedService");
+        Connect(first, 1, PAGE_TOKEN);
+        Connect(second, 1, PAGE_TOKEN);
+        SvcIdentity connectSid = {};
+        connectSid.handle = 1;
+        EXPECT_EQ(connectMission_->FindServiceRecord(connectSid, PAGE_TOKEN), first);
+
+        // the disconnect of the first service leaves the second one bound to the same sid
+        first->RemoveConnectRecord(connectSid);
+        EXPECT_EQ(connectMission_->FindServiceRecord(connectSid, PAGE_TOKEN), second);
+        Connect(first, 1, PAGE_TOKEN);
+        uint64_t secondToken = second->GetToken();
+        connectMission_->RemoveServiceRecord(secondToken);
+        EXPECT_EQ(connectMission_->FindServiceRecord(connectSid, PAGE_TOKEN), first);
+        first->RemoveConnectRecord(connectSid);
+        EXPECT_EQ(connectMission_->FindServiceRecord(connectSid, PAGE_TOKEN), nullptr);
+
+        // a service pushed twice under one name is found until both are removed
+        EXPECT_EQ(connectMission_->FindServiceRecord("com.example.first", "SharedService"), first);
+        connectMission_->RemoveServiceRecord(first->GetToken());
+        EXPECT_EQ(connectMission_->FindServiceRecord("com.example.first", "SharedService"), same);
+        connectMission_->RemoveServiceRecord(same->GetToken());
+        EXPECT_EQ(connectMission_->FindServiceRecord("com.example.first", "SharedService"), nullptr);
+    }
+} // namespace OHOS
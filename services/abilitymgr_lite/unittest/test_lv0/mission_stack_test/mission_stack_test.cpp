@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ability_mission_record.h"
+#include "ability_mission_stack.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+    constexpr uint32_t BUNDLE_NAME_LEN = 64;
+    constexpr uint32_t BENCHMARK_MISSIONS = 1000;
+    constexpr uint32_t BENCHMARK_ROUNDS = 2000;
+    constexpr uint32_t BENCHMARK_REPEATS = 5;
+
+    static void GetBundleName(uint32_t index, char *bundleName, uint32_t size)
+    {
+        (void)snprintf(bundleName, size, "com.example.mission%u", index);
+    }
+
+    // the list operations AbilityMissionStack used before the intrusive links and the bundle index were added
+    class ListMissionStack {
+    public:
+        void MoveToTop(AbilityMissionRecord *missionRecord)
+        {
+            if (missionRecords_.back() != missionRecord) {
+                missionRecords_.remove(missionRecord);
+                missionRecords_.emplace_back(missionRecord);
+            }
+        }
+
+        AbilityMissionRecord *Get(const char *bundleName) const
+        {
+            for (const auto missionRecord : missionRecords_) {
+                if (missionRecord->IsSameMissionRecord(bundleName)) {
+                    return missionRecord;
+                }
+            }
+            return nullptr;
+        }
+
+        void Remove(AbilityMissionRecord *missionRecord)
+        {
+            missionRecords_.remove(missionRecord);
+            for (const auto currentMission : missionRecords_) {
+                if (currentMission->GetPrevMissionRecord() == missionRecord) {
+                    currentMission->SetPrevMissionRecord(nullptr);
+                }
+            }
+        }
+
+        std::list<AbilityMissionRecord *> missionRecords_;
+    };
+
+    /*
+     * Each round starts the bottom mission, as GeneratePageAbility does, then terminates it and starts it again, so
+     * the missions rotate and round i always works on mission i of the push order. Returns the best of the repeats.
+     */
+    template<typename Round>
+    static int64_t MeasureRounds(Round round, uint32_t &hits)
+    {
+        int64_t best = INT64_MAX;
+        for (uint32_t repeat = 0; repeat < BENCHMARK_REPEATS; repeat++) {
+            auto begin = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < BENCHMARK_ROUNDS; i++) {
+                hits += round((repeat * BENCHMARK_ROUNDS + i) % BENCHMARK_MISSIONS) ? 1 : 0;
+            }
+            auto cost = std::chrono::steady_clock::now() - begin;
+            best = std::min(best,
+                static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(cost).count()));
+        }
+        return best;
+    }
+
+    class MissionStackTest : public testing::Test {
+    public:
+        void SetUp() override
+        {
+            missionStack_ = new AbilityMissionStack(DEFAULT);
+        }
+
+        void TearDown() override
+        {
+            delete missionStack_;
+            missionStack_ = nullptr;
+        }
+
+        AbilityMissionRecord *PushMission(uint32_t index)
+        {
+            char bundleName[BUNDLE_NAME_LEN] = { 0 };
+            GetBundleName(index, bundleName, sizeof(bundleName));
+            auto missionRecord = new AbilityMissionRecord(missionStack_, bundleName);
+            missionStack_->PushTopMissionRecord(*missionRecord);
+            return missionRecord;
+        }
+
+        AbilityMissionStack *missionStack_ = nullptr;
+    };
+
+    /**
+     * @tc.name: MissionStackMoveToTop001
+     * @tc.desc: test a mission moved to the top is found by its bundle name and the order of the others is kept.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(MissionStackTest, MissionStackMoveToTop001, TestSize.Level0)
+    {
+        AbilityMissionRecord *first = PushMission(1);
+        AbilityMissionRecord *second = PushMission(2);
+        AbilityMissionRecord *third = PushMission(3);
+        EXPECT_EQ(missionStack_->GetTopMissionRecord(), third);
+
+        missionStack_->MoveMissionRecordToTop(*first);
+        EXPECT_EQ(missionStack_->GetTopMissionRecord(), first);
+        EXPECT_TRUE(missionStack_->IsTopMissionRecord("com.example.mission1"));
+        EXPECT_EQ(missionStack_->GetTargetMissionRecord("com.example.mission2"), second);
+        EXPECT_EQ(missionStack_->GetMissionRecordCount(), 3u);
+
+        missionStack_->RemoveMissionRecord(*first);
+        delete first;
+        EXPECT_EQ(missionStack_->GetTopMissionRecord(), third);
+        EXPECT_EQ(missionStack_->GetTargetMissionRecord("com.example.mission1"), nullptr);
+        EXPECT_EQ(missionStack_->GetMissionRecordCount(), 2u);
+    }
+
+    /**
+     * @tc.name: MissionStackPrevMission001
+     * @tc.desc: test removing a mission clears the prev mission of every mission that returns to it.
+     * @tc.type: FUNC
+     */
+    HWTEST_F(MissionStackTest, MissionStackPrevMission001, TestSize.Level0)
+    {
+        AbilityMissionRecord *first = PushMission(1);
+        AbilityMissionRecord *second = PushMission(2);
+        AbilityMissionRecord *third = PushMission(3);
+        second->SetPrevMissionRecord(first);
+        third->SetPrevMissionRecord(first);
+        third->SetPrevMissionRecord(second);
+        EXPECT_EQ(third->GetPrevMissionRecord(), second);
+
+        missionStack_->RemoveMissionRecord(*first);
+        delete first;
+        EXPECT_EQ(second->GetPrevMissionRecord(), nullptr);
+        EXPECT_EQ(third->GetPrevMissionRecord(), second);
+
+        missionStack_->RemoveMissionRecord(*second);
+        delete second;
+        EXPECT_EQ(third->GetPrevMissionRecord(), nullptr);
+        EXPECT_EQ(missionStack_->GetTopMissionRecord(), third);
+    }
+
+    /**
+     * @tc.name: MissionStackBenchmark001
+     * @tc.desc: test starting and terminating the bottom of 1k missions is no slower than the list operations.
+     * @tc.type: PERF
+     */
+    HWTEST_F(MissionStackTest, MissionStackBenchmark001, TestSize.Level1)
+    {
+        std::vector<AbilityMissionRecord *> missions;
+        std::vector<std::string> bundleNames;
+        ListMissionStack reference;
+        char bundleName[BUNDLE_NAME_LEN] = { 0 };
+        for (uint32_t index = 0; index < BENCHMARK_MISSIONS; index++) {
+            AbilityMissionRecord *missionRecord = PushMission(index);
+            if (index > 0) {
+                missionRecord->SetPrevMissionRecord(missions.front());
+            }
+            missions.emplace_back(missionRecord);
+            reference.missionRecords_.emplace_back(missionRecord);
+            GetBundleName(index, bundleName, sizeof(bundleName));
+            bundleNames.emplace_back(bundleName);
+        }
+
+        uint32_t hits = 0;
+        int64_t listCost = MeasureRounds([&](uint32_t index) {
+            AbilityMissionRecord *bottom = missions[index];
+            bool found = reference.Get(bundleNames[index].c_str()) == bottom;
+            reference.MoveToTop(bottom);
+            reference.Remove(bottom);
+            reference.missionRecords_.emplace_back(bottom);
+            return found;
+        }, hits);
+        int64_t indexedCost = MeasureRounds([&](uint32_t index) {
+            AbilityMissionRecord *bottom = missions[index];
+            bool found = missionStack_->GetTargetMissionRecord(bundleNames[index].c_str()) == bottom;
+            missionStack_->MoveMissionRecordToTop(*bottom);
+            missionStack_->RemoveMissionRecord(*bottom);
+            missionStack_->PushTopMissionRecord(*bottom);
+            return found;
+        }, hits);
+        EXPECT_EQ(hits, BENCHMARK_ROUNDS * BENCHMARK_REPEATS * 2);
+        EXPECT_EQ(missionStack_->GetMissionRecordCount(), BENCHMARK_MISSIONS);
+
+        printf("MissionStack start and terminate with %u missions, %u rounds: list %lld ns, indexed %lld ns\n",
+            BENCHMARK_MISSIONS, BENCHMARK_ROUNDS, static_cast<long long>(listCost),
+            static_cast<long long>(indexedCost));
+        EXPECT_LE(indexedCost, listCost);
+    }
+} // namespace OHOS
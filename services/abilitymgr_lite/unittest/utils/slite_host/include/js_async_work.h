@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_SLITE_HOST_JS_ASYNC_WORK_H
+#define OHOS_SLITE_HOST_JS_ASYNC_WORK_H
+
+namespace OHOS {
+namespace ACELite {
+class JsAsyncWork {
+public:
+    // no js engine runs on the host, so there is no async work to route to the app task
+    static void SetAppQueueHandler(const void *handler) {}
+};
+} // namespace ACELite
+} // namespace OHOS
+#endif // OHOS_SLITE_HOST_JS_ASYNC_WORK_H
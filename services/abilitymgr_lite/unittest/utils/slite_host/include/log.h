@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_SLITE_HOST_LOG_H
+#define OHOS_SLITE_HOST_LOG_H
+
+/* the hilog of the boards is not linked on the host, the AMS logs are dropped */
+#define HILOG_MODULE_AAFWK 0
+#define HILOG_MODULE_APP 0
+
+#define HILOG_DEBUG(mod, format, ...)
+#define HILOG_INFO(mod, format, ...)
+#define HILOG_WARN(mod, format, ...)
+#define HILOG_ERROR(mod, format, ...)
+#define HILOG_FATAL(mod, format, ...)
+#endif // OHOS_SLITE_HOST_LOG_H
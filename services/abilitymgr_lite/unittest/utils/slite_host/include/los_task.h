@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_SLITE_HOST_LOS_TASK_H
+#define OHOS_SLITE_HOST_LOS_TASK_H
+
+#include <cstdint>
+
+/*
+ * The part of the LiteOS-M task API the slite AMS uses, implemented with pthreads in slite_host_kernel.cpp.
+ * UINT32 is as wide as a pointer here: the app tasks get their message queue through uwArg, which only holds
+ * a pointer on the 32-bit boards.
+ */
+typedef uintptr_t UINT32;
+typedef uint16_t UINT16;
+typedef void *(*TSK_ENTRY_FUNC)(UINT32 arg);
+
+typedef struct {
+    TSK_ENTRY_FUNC pfnTaskEntry;
+    UINT16 usTaskPrio;
+    UINT32 uwArg;
+    UINT32 uwStackSize;
+    char *pcName;
+    UINT32 uwResved;
+} TSK_INIT_PARAM_S;
+
+constexpr UINT32 LOS_OK = 0;
+constexpr UINT32 LOS_NOK = 1;
+constexpr UINT16 OS_TASK_PRIORITY_LOWEST = 31;
+
+extern "C" {
+UINT32 LOS_TaskCreate(UINT32 *taskId, TSK_INIT_PARAM_S *initParam);
+UINT32 LOS_TaskDelete(UINT32 taskId);
+UINT32 LOS_CurTaskIDGet(void);
+void LOS_TaskLock(void);
+void LOS_TaskUnlock(void);
+}
+#endif // OHOS_SLITE_HOST_LOS_TASK_H
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_SLITE_HOST_OHOS_INIT_H
+#define OHOS_SLITE_HOST_OHOS_INIT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+typedef void (*InitCall)(void);
+
+/* the device links init calls into sections run at boot, the host collects them for SAMGR_Bootstrap */
+void SliteHostAddInitCall(InitCall call, int layer);
+
+#define SLITE_HOST_INIT_SERVICE 0
+#define SLITE_HOST_INIT_FEATURE 1
+
+#define SLITE_HOST_INIT(func, layer) \
+    static void __attribute__((constructor)) SliteHostInit_##func(void) { SliteHostAddInitCall(func, layer); }
+
+#define SYS_SERVICE_INIT(func) SLITE_HOST_INIT(func, SLITE_HOST_INIT_SERVICE)
+#define SYS_FEATURE_INIT(func) SLITE_HOST_INIT(func, SLITE_HOST_INIT_FEATURE)
+#define SYSEX_SERVICE_INIT(func) SLITE_HOST_INIT(func, SLITE_HOST_INIT_SERVICE)
+#define SYSEX_FEATURE_INIT(func) SLITE_HOST_INIT(func, SLITE_HOST_INIT_FEATURE)
+#define APP_SERVICE_INIT(func) SLITE_HOST_INIT(func, SLITE_HOST_INIT_SERVICE)
+#define APP_FEATURE_INIT(func) SLITE_HOST_INIT(func, SLITE_HOST_INIT_FEATURE)
+#ifdef __cplusplus
+}
+#endif
+#endif // OHOS_SLITE_HOST_OHOS_INIT_H
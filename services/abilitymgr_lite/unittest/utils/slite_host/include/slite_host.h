@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_SLITE_HOST_H
+#define OHOS_SLITE_HOST_H
+
+#include <cstdint>
+
+#include "ability_record_observer.h"
+
+namespace OHOS {
+namespace AbilitySlite {
+/*
+ * Runs the slite AMS on a Linux host. The kernel, samgr and ace calls of the AMS sources are served by pthread
+ * shims, the launcher is a native SliteAbility and js abilities are SliteAceAbility stand-ins, so every
+ * lifecycle transition completes as soon as its app task handles the message.
+ */
+class SliteHost {
+public:
+    SliteHost() = delete;
+    ~SliteHost() = delete;
+
+    /* registers and boots the AMS the way its SYSEX init functions do on a board, once per process */
+    static bool Boot(AbilityRecordObserver *observer);
+
+    /* starts a js ability, the want data carries its path as the BMS helper expects without _MINI_BMS_ */
+    static int32_t StartAbility(const char *bundleName);
+
+    static int32_t ForceStop(const char *bundleName);
+
+    static int32_t TerminateAll(const char *excludedBundleName);
+
+    static uint64_t GetTimeNs();
+};
+} // namespace AbilitySlite
+} // namespace OHOS
+#endif // OHOS_SLITE_HOST_H
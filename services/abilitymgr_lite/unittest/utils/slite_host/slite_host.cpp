@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "slite_host.h"
+
+#include <climits>
+#include <cstring>
+#include <ctime>
+
+#include "ability_errors.h"
+#include "ability_record_observer_manager.h"
+#include "abilityms_slite_client.h"
+#include "bms_helper.h"
+#include "samgr_lite.h"
+#include "slite_ability_loader.h"
+#include "utils_list.h"
+#include "want.h"
+
+namespace OHOS {
+namespace AbilitySlite {
+namespace {
+    constexpr uint64_t NS_PER_SECOND = 1000000000;
+    // js apps are looked up without the BMS, any non-empty path is accepted
+    const char *const HOST_APP_PATH = "/data/host";
+
+    SliteAbility *CreateNativeAbility(const char *bundleName)
+    {
+        return new SliteAbility(bundleName);
+    }
+}
+
+bool SliteHost::Boot(AbilityRecordObserver *observer)
+{
+    static bool booted = false;
+    if (booted) {
+        return true;
+    }
+    List<char *> nativeApps;
+    nativeApps.PushBack(const_cast<char *>(BMSHelper::GetInstance().GetStartupBundleName()));
+    if (BMSHelper::GetInstance().RegisterBundleNames(nativeApps) != ERR_OK) {
+        return false;
+    }
+    SliteAbilityLoader::GetInstance().SetAbilityCreatorFunc(SliteAbilityType::NATIVE_ABILITY, CreateNativeAbility);
+    if (observer != nullptr) {
+        AbilityRecordObserverManager::GetInstance().AddObserver(observer);
+    }
+    SAMGR_Bootstrap();
+    booted = AbilityMsClient::GetInstance().Initialize();
+    return booted;
+}
+
+int32_t SliteHost::StartAbility(const char *bundleName)
+{
+    Want want = {};
+    ElementName element = {};
+    SetElementBundleName(&element, bundleName);
+    SetWantElement(&want, element);
+    ClearElement(&element);
+    SetWantData(&want, HOST_APP_PATH, strlen(HOST_APP_PATH) + 1);
+    want.mission = UINT32_MAX;
+    int32_t ret = AbilityMsClient::GetInstance().StartAbility(&want);
+    ClearWant(&want);
+    return ret;
+}
+
+int32_t SliteHost::ForceStop(const char *bundleName)
+{
+    return AbilityMsClient::GetInstance().ForceStop(bundleName);
+}
+
+int32_t SliteHost::TerminateAll(const char *excludedBundleName)
+{
+    return AbilityMsClient::GetInstance().TerminateAll(excludedBundleName);
+}
+
+uint64_t SliteHost::GetTimeNs()
+{
+    struct timespec now = {};
+    (void) clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<uint64_t>(now.tv_sec) * NS_PER_SECOND + static_cast<uint64_t>(now.tv_nsec);
+}
+} // namespace AbilitySlite
+} // namespace OHOS
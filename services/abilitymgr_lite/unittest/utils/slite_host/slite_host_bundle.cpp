@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+#include <cstring>
+
+#include "element_name.h"
+#include "utils.h"
+
+/* the element and copy helpers come from the bundle library of the boards, the host serves them from the heap */
+namespace {
+    bool ReplaceString(char *&target, const char *value)
+    {
+        char *copy = nullptr;
+        if (value != nullptr) {
+            copy = strdup(value);
+            if (copy == nullptr) {
+                return false;
+            }
+        }
+        free(target);
+        target = copy;
+        return true;
+    }
+}
+
+extern "C" {
+void ClearElement(ElementName *element)
+{
+    if (element == nullptr) {
+        return;
+    }
+    free(element->deviceId);
+    free(element->bundleName);
+    free(element->abilityName);
+    element->deviceId = nullptr;
+    element->bundleName = nullptr;
+    element->abilityName = nullptr;
+}
+
+bool SetElementDeviceID(ElementName *element, const char *deviceId)
+{
+    return (element != nullptr) && ReplaceString(element->deviceId, deviceId);
+}
+
+bool SetElementBundleName(ElementName *element, const char *bundleName)
+{
+    return (element != nullptr) && ReplaceString(element->bundleName, bundleName);
+}
+
+bool SetElementAbilityName(ElementName *element, const char *abilityName)
+{
+    return (element != nullptr) && ReplaceString(element->abilityName, abilityName);
+}
+}
+
+namespace OHOS {
+char *Utils::Strdup(const char *str)
+{
+    return (str == nullptr) ? nullptr : strdup(str);
+}
+
+void *Utils::Memdup(const void *src, uint32_t size)
+{
+    if ((src == nullptr) || (size == 0)) {
+        return nullptr;
+    }
+    void *copy = malloc(size);
+    if (copy != nullptr) {
+        (void) memcpy(copy, src, size);
+    }
+    return copy;
+}
+} // namespace OHOS
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "utils_file.h"
+
+/* the file system of the boards is served by the host one, the _FS open flags carry the posix values */
+namespace {
+    constexpr mode_t HOST_FILE_MODE = 0600;
+}
+
+extern "C" {
+int UtilsFileOpen(const char *path, int oflag, int mode)
+{
+    (void) mode;
+    return open(path, oflag, HOST_FILE_MODE);
+}
+
+int UtilsFileClose(int fd)
+{
+    return close(fd);
+}
+
+int UtilsFileRead(int fd, char *buf, unsigned int len)
+{
+    return static_cast<int>(read(fd, buf, len));
+}
+
+int UtilsFileWrite(int fd, const char *buf, unsigned int len)
+{
+    return static_cast<int>(write(fd, buf, len));
+}
+
+int UtilsFileDelete(const char *path)
+{
+    return unlink(path);
+}
+
+int UtilsFileStat(const char *path, unsigned int *fileSize)
+{
+    struct stat fileStat = {};
+    if (fileSize == nullptr || stat(path, &fileStat) != 0) {
+        return -1;
+    }
+    *fileSize = static_cast<unsigned int>(fileStat.st_size);
+    return 0;
+}
+}
@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cerrno>
+#include <cstdlib>
+#include <ctime>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "cmsis_os2.h"
+#include "los_task.h"
+#include "securec.h"
+
+namespace {
+    constexpr uint32_t MAX_HOST_TASKS = 64;
+    constexpr uint32_t TICKS_PER_SECOND = 1000;
+    constexpr uint64_t NS_PER_TICK = 1000000;
+    constexpr uint64_t NS_PER_SECOND = 1000000000;
+
+    struct HostQueue {
+        pthread_mutex_t mutex;
+        pthread_cond_t notEmpty;
+        pthread_cond_t notFull;
+        uint8_t *buffer;
+        uint32_t msgSize;
+        uint32_t capacity;
+        uint32_t head;
+        uint32_t count;
+    };
+
+    struct HostTask {
+        pthread_t thread;
+        TSK_ENTRY_FUNC entry;
+        UINT32 arg;
+        bool used;
+    };
+
+    HostTask g_tasks[MAX_HOST_TASKS];
+    pthread_mutex_t g_taskMutex = PTHREAD_MUTEX_INITIALIZER;
+    thread_local UINT32 g_currentTaskId = 0;
+
+    // LOS_TaskLock keeps the other tasks off the cpu, on the host it is one lock the owner may take again
+    pthread_mutex_t g_schedMutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t g_schedCond = PTHREAD_COND_INITIALIZER;
+    pthread_t g_schedOwner;
+    uint32_t g_schedCount = 0;
+
+    uint64_t GetMonotonicNs()
+    {
+        struct timespec now = {};
+        (void) clock_gettime(CLOCK_MONOTONIC, &now);
+        return static_cast<uint64_t>(now.tv_sec) * NS_PER_SECOND + static_cast<uint64_t>(now.tv_nsec);
+    }
+
+    const uint64_t g_bootNs = GetMonotonicNs();
+
+    // returns false once timeout ticks have passed, osWaitForever never expires
+    bool WaitCond(pthread_cond_t *cond, pthread_mutex_t *mutex, uint32_t timeout)
+    {
+        if (timeout == osWaitForever) {
+            return pthread_cond_wait(cond, mutex) == 0;
+        }
+        struct timespec deadline = {};
+        (void) clock_gettime(CLOCK_REALTIME, &deadline);
+        uint64_t ns = static_cast<uint64_t>(deadline.tv_nsec) + timeout * NS_PER_TICK;
+        deadline.tv_sec += static_cast<time_t>(ns / NS_PER_SECOND);
+        deadline.tv_nsec = static_cast<long>(ns % NS_PER_SECOND);
+        return pthread_cond_timedwait(cond, mutex, &deadline) != ETIMEDOUT;
+    }
+
+    void UnlockMutex(void *mutex)
+    {
+        (void) pthread_mutex_unlock(static_cast<pthread_mutex_t *>(mutex));
+    }
+
+    void *RunTask(void *arg)
+    {
+        auto task = static_cast<HostTask *>(arg);
+        g_currentTaskId = static_cast<UINT32>(task - g_tasks) + 1;
+        // a deleted task only stops where a LiteOS-M task may be switched out for good, waiting on its queue
+        (void) pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, nullptr);
+        (void) task->entry(task->arg);
+        return nullptr;
+    }
+}
+
+extern "C" {
+UINT32 LOS_TaskCreate(UINT32 *taskId, TSK_INIT_PARAM_S *initParam)
+{
+    if (taskId == nullptr || initParam == nullptr || initParam->pfnTaskEntry == nullptr) {
+        return LOS_NOK;
+    }
+    (void) pthread_mutex_lock(&g_taskMutex);
+    for (uint32_t index = 0; index < MAX_HOST_TASKS; index++) {
+        HostTask &task = g_tasks[index];
+        if (task.used) {
+            continue;
+        }
+        task.entry = initParam->pfnTaskEntry;
+        task.arg = initParam->uwArg;
+        if (pthread_create(&task.thread, nullptr, RunTask, &task) != 0) {
+            break;
+        }
+        task.used = true;
+        *taskId = index + 1;
+        (void) pthread_mutex_unlock(&g_taskMutex);
+        return LOS_OK;
+    }
+    (void) pthread_mutex_unlock(&g_taskMutex);
+    return LOS_NOK;
+}
+
+UINT32 LOS_TaskDelete(UINT32 taskId)
+{
+    (void) pthread_mutex_lock(&g_taskMutex);
+    if (taskId == 0 || taskId > MAX_HOST_TASKS || !g_tasks[taskId - 1].used) {
+        (void) pthread_mutex_unlock(&g_taskMutex);
+        return LOS_NOK;
+    }
+    HostTask &task = g_tasks[taskId - 1];
+    task.used = false;
+    pthread_t thread = task.thread;
+    (void) pthread_mutex_unlock(&g_taskMutex);
+    // the task may already have returned from its entry, as an app task does after its last message
+    (void) pthread_cancel(thread);
+    (void) pthread_join(thread, nullptr);
+    return LOS_OK;
+}
+
+UINT32 LOS_CurTaskIDGet(void)
+{
+    return g_currentTaskId;
+}
+
+void LOS_TaskLock(void)
+{
+    pthread_t self = pthread_self();
+    (void) pthread_mutex_lock(&g_schedMutex);
+    while (g_schedCount > 0 && !pthread_equal(g_schedOwner, self)) {
+        (void) pthread_cond_wait(&g_schedCond, &g_schedMutex);
+    }
+    g_schedOwner = self;
+    g_schedCount++;
+    (void) pthread_mutex_unlock(&g_schedMutex);
+}
+
+void LOS_TaskUnlock(void)
+{
+    (void) pthread_mutex_lock(&g_schedMutex);
+    // like the kernel, an unlock without a lock is ignored
+    if (g_schedCount > 0 && pthread_equal(g_schedOwner, pthread_self())) {
+        if (--g_schedCount == 0) {
+            (void) pthread_cond_broadcast(&g_schedCond);
+        }
+    }
+    (void) pthread_mutex_unlock(&g_schedMutex);
+}
+
+void LP_TaskBegin()
+{
+}
+
+void LP_TaskEnd()
+{
+}
+
+osMessageQueueId_t osMessageQueueNew(uint32_t msgCount, uint32_t msgSize, const osMessageQueueAttr_t *attr)
+{
+    if (msgCount == 0 || msgSize == 0) {
+        return nullptr;
+    }
+    auto queue = static_cast<HostQueue *>(calloc(1, sizeof(HostQueue)));
+    if (queue == nullptr) {
+        return nullptr;
+    }
+    queue->buffer = static_cast<uint8_t *>(calloc(msgCount, msgSize));
+    if (queue->buffer == nullptr) {
+        free(queue);
+        return nullptr;
+    }
+    (void) pthread_mutex_init(&queue->mutex, nullptr);
+    (void) pthread_cond_init(&queue->notEmpty, nullptr);
+    (void) pthread_cond_init(&queue->notFull, nullptr);
+    queue->msgSize = msgSize;
+    queue->capacity = msgCount;
+    return queue;
+}
+
+osStatus_t osMessageQueuePut(osMessageQueueId_t queueId, const void *msg, uint8_t msgPrio, uint32_t timeout)
+{
+    auto queue = static_cast<HostQueue *>(queueId);
+    if (queue == nullptr || msg == nullptr) {
+        return osErrorParameter;
+    }
+    (void) pthread_mutex_lock(&queue->mutex);
+    while (queue->count == queue->capacity) {
+        if (timeout == 0 || !WaitCond(&queue->notFull, &queue->mutex, timeout)) {
+            (void) pthread_mutex_unlock(&queue->mutex);
+            return (timeout == 0) ? osErrorResource : osErrorTimeout;
+        }
+    }
+    uint32_t tail = (queue->head + queue->count) % queue->capacity;
+    (void) memcpy_s(queue->buffer + tail * queue->msgSize, queue->msgSize, msg, queue->msgSize);
+    queue->count++;
+    (void) pthread_cond_signal(&queue->notEmpty);
+    (void) pthread_mutex_unlock(&queue->mutex);
+    return osOK;
+}
+
+osStatus_t osMessageQueueGet(osMessageQueueId_t queueId, void *msg, uint8_t *msgPrio, uint32_t timeout)
+{
+    auto queue = static_cast<HostQueue *>(queueId);
+    if (queue == nullptr || msg == nullptr) {
+        return osErrorParameter;
+    }
+    osStatus_t status = osOK;
+    int cancelState = PTHREAD_CANCEL_DISABLE;
+    (void) pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, &cancelState);
+    pthread_testcancel();
+    (void) pthread_mutex_lock(&queue->mutex);
+    pthread_cleanup_push(UnlockMutex, &queue->mutex);
+    while (queue->count == 0) {
+        if (timeout == 0 || !WaitCond(&queue->notEmpty, &queue->mutex, timeout)) {
+            status = (timeout == 0) ? osErrorResource : osErrorTimeout;
+            break;
+        }
+    }
+    if (status == osOK) {
+        (void) memcpy_s(msg, queue->msgSize, queue->buffer + queue->head * queue->msgSize, queue->msgSize);
+        queue->head = (queue->head + 1) % queue->capacity;
+        queue->count--;
+        (void) pthread_cond_signal(&queue->notFull);
+    }
+    pthread_cleanup_pop(1);
+    (void) pthread_setcancelstate(cancelState, nullptr);
+    if (msgPrio != nullptr) {
+        *msgPrio = 0;
+    }
+    return status;
+}
+
+uint32_t osMessageQueueGetCount(osMessageQueueId_t queueId)
+{
+    auto queue = static_cast<HostQueue *>(queueId);
+    if (queue == nullptr) {
+        return 0;
+    }
+    (void) pthread_mutex_lock(&queue->mutex);
+    uint32_t count = queue->count;
+    (void) pthread_mutex_unlock(&queue->mutex);
+    return count;
+}
+
+osStatus_t osMessageQueueDelete(osMessageQueueId_t queueId)
+{
+    auto queue = static_cast<HostQueue *>(queueId);
+    if (queue == nullptr) {
+        return osErrorParameter;
+    }
+    (void) pthread_cond_destroy(&queue->notFull);
+    (void) pthread_cond_destroy(&queue->notEmpty);
+    (void) pthread_mutex_destroy(&queue->mutex);
+    free(queue->buffer);
+    free(queue);
+    return osOK;
+}
+
+osMutexId_t osMutexNew(const osMutexAttr_t *attr)
+{
+    auto mutex = static_cast<pthread_mutex_t *>(malloc(sizeof(pthread_mutex_t)));
+    if (mutex == nullptr) {
+        return nullptr;
+    }
+    pthread_mutexattr_t mutexAttr;
+    (void) pthread_mutexattr_init(&mutexAttr);
+    (void) pthread_mutexattr_settype(&mutexAttr, PTHREAD_MUTEX_RECURSIVE);
+    (void) pthread_mutex_init(mutex, &mutexAttr);
+    (void) pthread_mutexattr_destroy(&mutexAttr);
+    return mutex;
+}
+
+osStatus_t osMutexAcquire(osMutexId_t mutexId, uint32_t timeout)
+{
+    if (mutexId == nullptr) {
+        return osErrorParameter;
+    }
+    return (pthread_mutex_lock(static_cast<pthread_mutex_t *>(mutexId)) == 0) ? osOK : osError;
+}
+
+osStatus_t osMutexRelease(osMutexId_t mutexId)
+{
+    if (mutexId == nullptr) {
+        return osErrorParameter;
+    }
+    return (pthread_mutex_unlock(static_cast<pthread_mutex_t *>(mutexId)) == 0) ? osOK : osError;
+}
+
+osStatus_t osMutexDelete(osMutexId_t mutexId)
+{
+    if (mutexId == nullptr) {
+        return osErrorParameter;
+    }
+    (void) pthread_mutex_destroy(static_cast<pthread_mutex_t *>(mutexId));
+    free(mutexId);
+    return osOK;
+}
+
+osStatus_t osDelay(uint32_t ticks)
+{
+    (void) usleep(static_cast<useconds_t>(ticks * (NS_PER_TICK / 1000)));
+    return osOK;
+}
+
+uint32_t osKernelGetTickCount(void)
+{
+    return static_cast<uint32_t>((GetMonotonicNs() - g_bootNs) / NS_PER_TICK);
+}
+
+uint32_t osKernelGetTickFreq(void)
+{
+    return TICKS_PER_SECOND;
+}
+}
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <cstring>
+
+#include "cmsis_os2.h"
+#include "iunknown.h"
+#include "los_task.h"
+#include "ohos_errno.h"
+#include "ohos_init.h"
+#include "samgr_lite.h"
+
+namespace {
+    constexpr int16 MAX_HOST_SERVICES = 8;
+    constexpr int16 MAX_HOST_FEATURES = 4;
+    constexpr uint16 MAX_INIT_CALLS = 32;
+    constexpr uint16 INIT_LAYERS = 2;
+
+    // a samgr message remembers which feature of the service it is for
+    struct HostMessage {
+        Request request;
+        int16 featureId;
+    };
+
+    struct HostFeature {
+        Feature *feature;
+        IUnknown *publicApi;
+    };
+
+    struct HostService {
+        Service *service;
+        IUnknown *defaultApi;
+        HostFeature features[MAX_HOST_FEATURES];
+        int16 featureNum;
+        Identity identity;
+    };
+
+    HostService g_services[MAX_HOST_SERVICES];
+    int16 g_serviceNum = 0;
+    InitCall g_initCalls[INIT_LAYERS][MAX_INIT_CALLS];
+    uint16 g_initCallNum[INIT_LAYERS] = { 0 };
+
+    HostService *FindService(const char *name)
+    {
+        if (name == nullptr) {
+            return nullptr;
+        }
+        for (int16 index = 0; index < g_serviceNum; index++) {
+            Service *service = g_services[index].service;
+            if (strcmp(service->GetName(service), name) == 0) {
+                return &g_services[index];
+            }
+        }
+        return nullptr;
+    }
+
+    HostFeature *FindFeature(HostService *hostService, const char *name)
+    {
+        if (hostService == nullptr || name == nullptr) {
+            return nullptr;
+        }
+        for (int16 index = 0; index < hostService->featureNum; index++) {
+            Feature *feature = hostService->features[index].feature;
+            if (strcmp(feature->GetName(feature), name) == 0) {
+                return &hostService->features[index];
+            }
+        }
+        return nullptr;
+    }
+
+    BOOL RegisterService(Service *service)
+    {
+        if (service == nullptr || g_serviceNum >= MAX_HOST_SERVICES || FindService(service->GetName(service))) {
+            return FALSE;
+        }
+        g_services[g_serviceNum] = {};
+        g_services[g_serviceNum].service = service;
+        g_serviceNum++;
+        return TRUE;
+    }
+
+    BOOL RegisterFeature(const char *serviceName, Feature *feature)
+    {
+        HostService *hostService = FindService(serviceName);
+        if (hostService == nullptr || feature == nullptr || hostService->featureNum >= MAX_HOST_FEATURES) {
+            return FALSE;
+        }
+        hostService->features[hostService->featureNum++] = { feature, nullptr };
+        return TRUE;
+    }
+
+    BOOL RegisterFeatureApi(const char *serviceName, const char *featureName, IUnknown *publicApi)
+    {
+        HostService *hostService = FindService(serviceName);
+        if (hostService == nullptr || publicApi == nullptr) {
+            return FALSE;
+        }
+        if (featureName == nullptr) {
+            hostService->defaultApi = publicApi;
+            return TRUE;
+        }
+        HostFeature *hostFeature = FindFeature(hostService, featureName);
+        if (hostFeature == nullptr) {
+            return FALSE;
+        }
+        hostFeature->publicApi = publicApi;
+        return TRUE;
+    }
+
+    BOOL RegisterDefaultFeatureApi(const char *serviceName, IUnknown *publicApi)
+    {
+        return RegisterFeatureApi(serviceName, nullptr, publicApi);
+    }
+
+    IUnknown *GetFeatureApi(const char *serviceName, const char *featureName)
+    {
+        HostService *hostService = FindService(serviceName);
+        if (hostService == nullptr) {
+            return nullptr;
+        }
+        if (featureName == nullptr) {
+            return hostService->defaultApi;
+        }
+        HostFeature *hostFeature = FindFeature(hostService, featureName);
+        return (hostFeature == nullptr) ? nullptr : hostFeature->publicApi;
+    }
+
+    IUnknown *GetDefaultFeatureApi(const char *serviceName)
+    {
+        return GetFeatureApi(serviceName, nullptr);
+    }
+
+    void *RunService(UINT32 arg)
+    {
+        auto hostService = reinterpret_cast<HostService *>(arg);
+        Service *service = hostService->service;
+        HostMessage message = {};
+        while (true) {
+            if (osMessageQueueGet(hostService->identity.queueId, &message, nullptr, osWaitForever) != osOK) {
+                continue;
+            }
+            if (message.featureId < 0 || message.featureId >= hostService->featureNum) {
+                (void) service->MessageHandle(service, &message.request);
+                continue;
+            }
+            Feature *feature = hostService->features[message.featureId].feature;
+            (void) feature->OnMessage(feature, &message.request);
+        }
+        return nullptr;
+    }
+
+    SamgrLite g_samgr = {
+        .RegisterService = RegisterService,
+        .UnregisterService = nullptr,
+        .RegisterFeature = RegisterFeature,
+        .UnregisterFeature = nullptr,
+        .RegisterFeatureApi = RegisterFeatureApi,
+        .UnregisterFeatureApi = nullptr,
+        .RegisterDefaultFeatureApi = RegisterDefaultFeatureApi,
+        .UnregisterDefaultFeatureApi = nullptr,
+        .GetDefaultFeatureApi = GetDefaultFeatureApi,
+        .GetFeatureApi = GetFeatureApi,
+    };
+}
+
+extern "C" {
+void SliteHostAddInitCall(InitCall call, int layer)
+{
+    if (call == nullptr || layer < 0 || layer >= INIT_LAYERS || g_initCallNum[layer] >= MAX_INIT_CALLS) {
+        return;
+    }
+    g_initCalls[layer][g_initCallNum[layer]++] = call;
+}
+
+SamgrLite *SAMGR_GetInstance(void)
+{
+    return &g_samgr;
+}
+
+void SAMGR_Bootstrap(void)
+{
+    // run the collected SYSEX init calls, services before their features, as the board does at boot
+    for (uint16 layer = 0; layer < INIT_LAYERS; layer++) {
+        for (uint16 index = 0; index < g_initCallNum[layer]; index++) {
+            g_initCalls[layer][index]();
+        }
+        g_initCallNum[layer] = 0;
+    }
+    for (int16 index = 0; index < g_serviceNum; index++) {
+        HostService &hostService = g_services[index];
+        if (hostService.identity.queueId != nullptr) {
+            continue;
+        }
+        Service *service = hostService.service;
+        TaskConfig config = service->GetTaskConfig(service);
+        hostService.identity.serviceId = index;
+        hostService.identity.featureId = -1;
+        hostService.identity.queueId = osMessageQueueNew(config.queueSize, sizeof(HostMessage), nullptr);
+        if (hostService.identity.queueId == nullptr) {
+            continue;
+        }
+        (void) service->Initialize(service, hostService.identity);
+        for (int16 featureIndex = 0; featureIndex < hostService.featureNum; featureIndex++) {
+            Identity featureIdentity = hostService.identity;
+            featureIdentity.featureId = featureIndex;
+            Feature *feature = hostService.features[featureIndex].feature;
+            feature->OnInitialize(feature, service, featureIdentity);
+        }
+        TSK_INIT_PARAM_S taskParam = {};
+        taskParam.pfnTaskEntry = RunService;
+        taskParam.uwArg = reinterpret_cast<UINT32>(&hostService);
+        taskParam.uwStackSize = config.stackSize;
+        UINT32 taskId = 0;
+        (void) LOS_TaskCreate(&taskId, &taskParam);
+    }
+}
+
+int32 SAMGR_SendRequest(const Identity *identity, const Request *request, [[maybe_unused]] Handler handler)
+{
+    if (identity == nullptr || request == nullptr || identity->queueId == nullptr) {
+        return EC_INVALID;
+    }
+    // replies are not delivered on the host, the AMS never asks for one
+    HostMessage message = { *request, identity->featureId };
+    return (osMessageQueuePut(identity->queueId, &message, 0, 0) == osOK) ? EC_SUCCESS : EC_BUSBUSY;
+}
+
+int IUNKNOWN_QueryInterface(IUnknown *iUnknown, int ver, void **target)
+{
+    if (iUnknown == nullptr || target == nullptr) {
+        return EC_INVALID;
+    }
+    auto entry = reinterpret_cast<IUnknownEntry *>(
+        reinterpret_cast<uint8_t *>(iUnknown) - offsetof(IUnknownEntry, iUnknown));
+    if ((entry->ver & static_cast<uint16>(ver)) != static_cast<uint16>(ver)) {
+        return EC_INVALID;
+    }
+    *target = iUnknown;
+    (void) iUnknown->AddRef(iUnknown);
+    return EC_SUCCESS;
+}
+
+int IUNKNOWN_AddRef(IUnknown *iUnknown)
+{
+    if (iUnknown == nullptr) {
+        return EC_INVALID;
+    }
+    auto entry = reinterpret_cast<IUnknownEntry *>(
+        reinterpret_cast<uint8_t *>(iUnknown) - offsetof(IUnknownEntry, iUnknown));
+    return ++entry->ref;
+}
+
+int IUNKNOWN_Release(IUnknown *iUnknown)
+{
+    if (iUnknown == nullptr) {
+        return EC_INVALID;
+    }
+    auto entry = reinterpret_cast<IUnknownEntry *>(
+        reinterpret_cast<uint8_t *>(iUnknown) - offsetof(IUnknownEntry, iUnknown));
+    return --entry->ref;
+}
+}